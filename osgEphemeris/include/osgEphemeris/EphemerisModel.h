@@ -98,6 +98,16 @@ class OSGEPHEMERIS_EXPORT EphemerisModel : public osg::Group
                                  STAR_FIELD
         };
 
+        /** How heavenly bodies are reflected below the horizon when there is no ground plane */
+        enum ReflectionMode {
+            /** Reflect all members (default) */
+            FullReflection,
+            /** Draw nothing below the horizon */
+            NoReflection,
+            /** Reflect a low tesselation moon and the brightest stars only */
+            ReducedReflection
+        };
+
         /** The default constructor */
         EphemerisModel();
 
@@ -319,11 +329,42 @@ class OSGEPHEMERIS_EXPORT EphemerisModel : public osg::Group
         void setSkyDomeMirrorSouthernHemisphere( bool flag ) { _skyDomeMirrorSouthernHemisphere = flag; }
         bool getSkyDomeMirrorSouthernHemisphere() { return _skyDomeMirrorSouthernHemisphere; }
 
+        /**
+          When the southern hemisphere of the SkyDome is used and mirrored, draw it
+          by instancing the northern hemisphere under a Z mirror transform.  Like the
+          other SkyDome settings, this takes effect when the SkyDome is created.
+          */
+        void setSkyDomeInstanceSouthernHemisphere( bool flag ) { _skyDomeInstanceSouthernHemisphere = flag; }
+        bool getSkyDomeInstanceSouthernHemisphere() { return _skyDomeInstanceSouthernHemisphere; }
+
         /**
           Return a pointer to the GroundPlane
         */
         GroundPlane* getGroundPlane();
 
+        /**
+          Set how the moon, planets and stars are reflected below the horizon when
+          the ground plane is not a member.  FullReflection draws them all a second
+          time, mirrored.  Channels that never look below the horizon can use
+          NoReflection, and ReducedReflection mirrors a low tesselation moon and
+          the stars brighter than the reflection star magnitude limit only.
+          */
+        void setReflectionMode( ReflectionMode mode );
+        ReflectionMode getReflectionMode() const { return _reflectionMode; }
+
+        /**
+          Set the faintest magnitude of the stars reflected in ReducedReflection mode.
+          Defaults to 2.0.
+          */
+        void setReflectionStarMagnitudeLimit( double magnitude );
+        double getReflectionStarMagnitudeLimit() const { return _reflectionStarMagnitudeLimit; }
+
+        /**
+          Return a pointer to the SkyDome, or NULL if SKY_DOME is not one of
+          the members set with setMembers().
+        */
+        SkyDome* getSkyDome() { return _skyDome.get(); }
+
         /**
           * Effect an update.  Used internally by the internal UpdateCallback
           */
@@ -367,6 +408,11 @@ class OSGEPHEMERIS_EXPORT EphemerisModel : public osg::Group
           Connect clipped or unclipped geometry, depending on if reflections are needed
           */
         void _makeConnections();
+
+        /**
+          Build the reduced subgraph reflected in ReducedReflection mode
+          */
+        void _createReflectionGroup();
         unsigned int _members;
         double _scale;
         osg::Vec3 _center;
@@ -375,6 +421,9 @@ class OSGEPHEMERIS_EXPORT EphemerisModel : public osg::Group
         unsigned int _moonLightNum;
         bool _skyDomeUseSouthernHemisphere;
         bool _skyDomeMirrorSouthernHemisphere;
+        bool _skyDomeInstanceSouthernHemisphere;
+        ReflectionMode _reflectionMode;
+        double _reflectionStarMagnitudeLimit;
 
         class UpdateCallback  : public osg::NodeCallback
         {
@@ -446,6 +495,9 @@ class OSGEPHEMERIS_EXPORT EphemerisModel : public osg::Group
         osg::ref_ptr<osg::MatrixTransform> _clipReverseTx;
 
         osg::ref_ptr<osg::Group> _memberGroup;
+        osg::ref_ptr<osg::Group> _reflectionGroup;
+        osg::ref_ptr<osg::MatrixTransform> _reflectionMoonTx;
+        osg::ref_ptr<osg::MatrixTransform> _reflectionStarFieldTx;
 
         osg::Vec3d _sunVec;
 
@@ -8,6 +8,8 @@
 
 typedef signed __int32          int32_t;
 typedef unsigned __int32        uint32_t;
+typedef signed __int64          int64_t;
+typedef unsigned __int64        uint64_t;
 
   #  else
 
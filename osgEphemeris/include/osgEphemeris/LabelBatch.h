@@ -0,0 +1,114 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#ifndef OSG_EPHEMERIS_LABEL_BATCH_DEF
+#define OSG_EPHEMERIS_LABEL_BATCH_DEF
+
+#include <string>
+#include <vector>
+
+#include <osg/Camera>
+#include <osg/Group>
+#include <osg/Geometry>
+#include <osg/StateSet>
+#include <osg/Uniform>
+#include <osg/observer_ptr>
+#include <OpenThreads/Mutex>
+
+#include <osgEphemeris/Export.h>
+
+namespace osgEphemeris {
+
+/** \class LabelBatch
+    \brief A set of text labels drawn as a single geometry.
+
+    Each label is anchored at a point in the coordinate system of the 
+    LabelBatch, with its text to the right of and above the anchor, facing
+    the screen and sized in pixels regardless of distance.  The glyphs of all
+    labels come from one texture atlas per font, shared by every LabelBatch,
+    so a LabelBatch costs one drawable and one draw however many labels it
+    holds.  Labels whose anchors are behind the eye are not drawn.
+
+    Only the printable ASCII characters are available.
+    */
+class OSGEPHEMERIS_EXPORT LabelBatch : public osg::Group
+{
+    public:
+        LabelBatch( const std::string &fontName=_defaultFontName );
+
+        /**
+          Add a label, and return its index.
+          \param text          - The text of the label
+          \param position      - The anchor of the label
+          \param characterSize - The height of the characters, in pixels
+          \param color         - The color of the text
+          */
+        unsigned int addLabel( const std::string &text, const osg::Vec3 &position,
+                               float characterSize, const osg::Vec4 &color );
+
+        /** Move the anchor of a label */
+        void setLabelPosition( unsigned int label, const osg::Vec3 &position );
+
+        unsigned int getNumLabels() const { return _labels.size(); }
+
+        virtual void traverse( osg::NodeVisitor & );
+
+    protected:
+        virtual ~LabelBatch();
+
+        // The glyph texture of a font
+        class GlyphAtlas;
+
+        struct Label {
+            unsigned int firstVertex;
+            unsigned int numVertices;
+        };
+
+        osg::ref_ptr<GlyphAtlas> _atlas;
+        std::vector<Label> _labels;
+        osg::ref_ptr<osg::Geometry> _geometry;
+        osg::ref_ptr<osg::Vec3Array> _anchors;
+        osg::ref_ptr<osg::Vec2Array> _texCoords;
+        osg::ref_ptr<osg::Vec2Array> _offsets;
+        osg::ref_ptr<osg::Vec4Array> _colors;
+        osg::ref_ptr<osg::DrawArrays> _quads;
+
+        // A StateSet holding the viewport size for each camera that culls the
+        // labels.  Deleted cameras are dropped.
+        struct CameraStateSet
+        {
+            osg::observer_ptr<osg::Camera> camera;
+            osg::ref_ptr<osg::StateSet> stateSet;
+            osg::ref_ptr<osg::Uniform> viewportSize;
+        };
+        std::vector<CameraStateSet> _cameraStateSets;
+        OpenThreads::Mutex _cameraStateSetsMutex;
+
+        static const std::string _defaultFontName;
+        static std::string _vertexShaderProgram;
+        static std::string _fragmentShaderProgram;
+
+        void _buildStateSet();
+};
+
+}
+
+#endif
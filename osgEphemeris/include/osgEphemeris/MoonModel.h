@@ -23,6 +23,13 @@
 #define OSG_EPHEMERIS_MOON_MODEL_DEF
 
 #include <string>
+#include <vector>
+
+#include <osg/Camera>
+#include <osg/Image>
+#include <osg/observer_ptr>
+#include <OpenThreads/Mutex>
+
 #include <osgEphemeris/Export.h>
 #include <osgEphemeris/Sphere.h>
 
@@ -51,6 +58,15 @@ class OSGEPHEMERIS_EXPORT MoonModel : public Sphere
           */
         void setSunPosition( osg::Vec3 sun );
 
+        /**
+          Return the number of texture levels the moon can be drawn with.  During
+          cull the level is picked for each camera from the moon's size on
+          screen, and the textures of a level are only made when first needed.
+          */
+        unsigned int getNumTextureLevels() const { return _textureLevels.size(); }
+
+        virtual void traverse( osg::NodeVisitor &nv );
+
     protected:
 
         static const double _moonRadius;
@@ -62,6 +78,29 @@ class OSGEPHEMERIS_EXPORT MoonModel : public Sphere
 
         osg::ref_ptr<osg::Uniform> _light;
 
+        struct TextureLevel
+        {
+            unsigned int width;
+            osg::ref_ptr<osg::Image> baseImage;
+            osg::ref_ptr<osg::Image> bumpImage;
+            osg::ref_ptr<osg::StateSet> stateSet;
+        };
+
+        // Finest first.  The coarsest level is bound by the model's own StateSet.
+        std::vector<TextureLevel> _textureLevels;
+
+        // The level last used by each camera.  Deleted cameras are dropped.
+        struct CameraTextureLevel
+        {
+            osg::observer_ptr<osg::Camera> camera;
+            unsigned int level;
+        };
+        std::vector<CameraTextureLevel> _cameraTextureLevels;
+        OpenThreads::Mutex _textureLevelsMutex;
+
+        static const unsigned int _minTextureLevelWidth;
+        static const float _textureLevelHysteresis;
+
         static unsigned int  _moonImageLoLodWidth;
         static unsigned int _moonImageLoLodHeight;
         static unsigned int  _moonImageInternalTextureFormat;
@@ -80,6 +119,9 @@ class OSGEPHEMERIS_EXPORT MoonModel : public Sphere
         static unsigned int _moonNormalImageHiLodHeight;
         static unsigned char _moonNormalImageHiLodData[];
 
+        void _buildTextureLevels();
+        osg::StateSet *_getTextureLevelStateSet( unsigned int level );
+        unsigned int _selectTextureLevel( osg::Camera *camera, float pixelSize );
         void _buildStateSet();
 };
 
@@ -25,6 +25,7 @@
 #include <osg/Group>
 #include <osgEphemeris/Export.h>
 #include <osgEphemeris/EphemerisData.h>
+#include <osgEphemeris/LabelBatch.h>
 
 namespace osgEphemeris {
 
@@ -47,6 +48,7 @@ class OSGEPHEMERIS_EXPORT Planets : public osg::Group
         osg::ref_ptr<osg::MatrixTransform> _saturnTx;
         osg::ref_ptr<osg::MatrixTransform> _uranusTx;
         osg::ref_ptr<osg::MatrixTransform> _neptuneTx;
+        osg::ref_ptr<LabelBatch> _labels;
 };
 
 }
@@ -0,0 +1,129 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#ifndef OSG_EPHEMERIS_RESOURCE_PACK_DEF
+#define OSG_EPHEMERIS_RESOURCE_PACK_DEF
+
+#include <string>
+#include <vector>
+
+#include <osg/Referenced>
+#include <osg/Image>
+#include <OpenThreads/Mutex>
+
+#include <osgEphemeris/Export.h>
+#include <osgEphemeris/IntTypes.h>
+
+namespace osgEphemeris {
+
+/** \struct ResourcePackHeader
+    \brief The header at the start of a resource pack file, followed by
+           numImages ResourcePackImage entries.
+    */
+struct ResourcePackHeader
+{
+    char magic[8];
+    /** Written as 0x01020304, to detect files of the other byte order */
+    uint32_t byteOrder;
+    uint32_t version;
+    uint32_t numImages;
+    uint32_t entrySize;
+};
+
+/** \struct ResourcePackImage
+    \brief The entry of one image in a resource pack.  The pixels of all its
+           mipmap levels are stored together, in the layout of osg::Image.
+    */
+struct ResourcePackImage
+{
+    enum { MaxNameLength = 32, MaxMipmapLevels = 16 };
+
+    char name[MaxNameLength];
+    uint32_t width;
+    uint32_t height;
+    uint32_t internalTextureFormat;
+    uint32_t pixelFormat;
+    uint32_t dataType;
+    /** Offset of the pixels from the start of the file, and their size */
+    uint32_t offset;
+    uint32_t size;
+    /** Number of mipmap levels after the first, and the offset of each from the pixels */
+    uint32_t numMipmaps;
+    uint32_t mipmapOffsets[MaxMipmapLevels];
+};
+
+/** \class ResourcePack
+    \brief A read only, memory mapped file of images.
+
+    The images used by the library, such as the textures of the moon and the
+    sun, can be kept in a resource pack rather than compiled in.  Images are
+    stored with their mipmaps already made, and may be block compressed, so
+    textures are loaded straight from the mapped pages of the file.  Resource
+    packs are written by the makeResourcePack tool.
+    */
+class OSGEPHEMERIS_EXPORT ResourcePack : public osg::Referenced
+{
+    public:
+        /**
+          Map the resource pack in fileName.  valid() returns false if the
+          file can not be mapped or is not a resource pack.
+          */
+        ResourcePack( const std::string &fileName );
+
+        bool valid() const { return _header != 0L; }
+
+        /**
+          Return the image called name, or 0L if the pack has none.  The image
+          uses the mapped pixels in place, and holds a reference to the pack.
+          */
+        osg::Image *readImage( const std::string &name );
+
+        /**
+          Get the resource pack used by the library, mapping it on first use.  
+          It is the file named by the OSGEPHEMERIS_RESOURCE_PACK environment
+          variable, or else osgEphemeris.pack on the data file path.  Returns
+          0L if there is no such pack.
+          */
+        static ResourcePack *getDefault();
+
+        /**
+          Write images, with their mipmaps, as a resource pack
+          */
+        static bool write( const std::string &fileName,
+                           const std::vector<std::string> &names,
+                           const std::vector< osg::ref_ptr<osg::Image> > &images );
+
+        static const uint32_t Version = 1;
+
+    protected:
+        virtual ~ResourcePack();
+
+        void *_start;
+        size_t _length;
+        const ResourcePackHeader *_header;
+        const ResourcePackImage *_images;
+
+        static const char _magic[8];
+};
+
+}
+
+#endif
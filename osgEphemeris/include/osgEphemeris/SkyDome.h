@@ -22,15 +22,22 @@
 #ifndef OSG_EPHEMERIS_SKY_DOME_DEF
 #define OSG_EPHEMERIS_SKY_DOME_DEF
 
+#include <vector>
+
+#include <OpenThreads/Mutex>
+#include <OpenThreads/ReadWriteMutex>
+
 #include <osg/Drawable>
 #include <osg/Texture1D>
 #include <osg/Texture2D>
 #include <osg/TexGen>
+#include <osg/Uniform>
 
 #include <osg/MatrixTransform>
 
 #include <osgEphemeris/Export.h>
 #include <osgEphemeris/Sphere.h>
+#include <osgEphemeris/SkyModel.h>
 
 namespace osgEphemeris {
 
@@ -43,13 +50,210 @@ namespace osgEphemeris {
 class OSGEPHEMERIS_EXPORT SkyDome:  public Sphere
 {
     public:
+        enum SkyUpdateMode
+        {
+            /** Compute rows of the sky texture for a limited time on each call to setSunPos() (default). */
+            IncrementalUpdate,
+            /** Compute the whole sky texture on each call to setSunPos(), in parallel. */
+            FullFrameUpdate
+        };
+
         /**
           Default Constructor
+          \param instanceSouthernHemisphere When both hemispheres are used and the
+                 southern hemisphere mirrors the northern one, draw the southern
+                 hemisphere as the northern geode under a Z mirror transform instead
+                 of building separate geometry for it.
+          */
+        SkyDome( bool useBothHemispheres=true, bool MirrorInBothHemispheres=true,
+                 bool instanceSouthernHemisphere=false );
+
+        /** Return true if the southern hemisphere is an instance of the northern one */
+        bool getInstanceSouthernHemisphere() const { return _southernMirrorTransform.valid(); }
+
+        /**
+          Set how the sky texture is refreshed when the sun moves.  IncrementalUpdate
+          spreads a refresh over several frames, which can show banding when the sun
+          moves quickly.  FullFrameUpdate computes every row on a pool of worker threads
+          into a back buffer, which is then copied to the texture image in one step, so
+          the displayed sky always corresponds to a single sun position.
+          */
+        void setSkyUpdateMode( SkyUpdateMode mode );
+        SkyUpdateMode getSkyUpdateMode() const { return _skyUpdateMode; }
+
+        /**
+          Set the time, in microseconds, spent computing rows of the sky texture on each
+          call to setSunPos() in IncrementalUpdate mode.  Rows nearest the sun and the
+          horizon are computed first.  At least one row is computed on each call.
+          Defaults to 500.
+          */
+        void setSkyUpdateTimeBudget( double microseconds ) { _skyUpdateTimeBudget = microseconds; }
+        double getSkyUpdateTimeBudget() const { return _skyUpdateTimeBudget; }
+
+        /**
+          Set the number of calls to setSunPos() a row of the sky texture may stay out
+          of date in IncrementalUpdate mode.  Rows that reach this age are computed
+          whatever the time budget.  Defaults to 32.
+          */
+        void setMaxSkyRowAge( unsigned int frames ) { _maxSkyRowAge = frames < 1 ? 1 : frames; }
+        unsigned int getMaxSkyRowAge() const { return _maxSkyRowAge; }
+
+        /** Time in microseconds spent computing the sky texture in the last call to setSunPos() */
+        double getSkyUpdateTime() const { return _skyUpdateTime; }
+        /** Number of rows of the sky texture computed in the last call to setSunPos() */
+        unsigned int getNumSkyRowsUpdated() const { return _numSkyRowsUpdated; }
+        /** Age, in calls to setSunPos(), of the oldest out of date row of the sky texture */
+        unsigned int getOldestSkyRowAge() const { return _oldestSkyRowAge; }
+        /** Mean age, in calls to setSunPos(), of the out of date rows of the sky texture */
+        double getMeanSkyRowAge() const { return _meanSkyRowAge; }
+
+        /**
+          Set the number of threads used to compute the sky texture in FullFrameUpdate
+          mode, including the calling thread.  0 (the default) uses one thread per processor.
+          */
+        void setNumSkyUpdateThreads( unsigned int numThreads );
+        unsigned int getNumSkyUpdateThreads() const { return _numSkyUpdateThreads; }
+
+        /**
+          Use a precomputed table of sky colors, indexed by sun altitude, texel zenith
+          angle and angle from the sun, instead of evaluating the sky model for every
+          texel.  The table is built for the current turbidity when enabled, and rebuilt
+          when setTurbidity() changes it.  Defaults to false.
+          */
+        void setUseSkyLookupTable( bool flag );
+        bool getUseSkyLookupTable() const { return _useSkyLookupTable; }
+
+        /**
+          Set the size of the sky texture.  Rows are spread between the zenith and
+          the horizon according to the sky texture mapping, and columns evenly in
+          azimuth.  Defaults to 128x128.
+          */
+        void setSkyTextureSize( unsigned int width, unsigned int height );
+        unsigned int getSkyTextureWidth() const { return _skyTextureWidth; }
+        unsigned int getSkyTextureHeight() const { return _skyTextureHeight; }
+
+        /**
+          Set how rows of the sky texture are spread in altitude.  HorizonWeightedAltitude
+          puts more rows near the horizon, where most of the color variation is, so a
+          smaller texture can be used for the same quality.  Defaults to LinearAltitude.
+          */
+        void setSkyTextureMapping( SkyTexCoordMapping mapping );
+        SkyTexCoordMapping getSkyTextureMapping() const { return _skyTexCoordMapping; }
+
+        /**
+          Set the model used to compute the color of the sky.  The model's turbidity
+          and sun altitude are set by the SkyDome.  Defaults to a WelshSkyModel.
+          */
+        void setSkyModel( SkyModel *model );
+        SkyModel *getSkyModel() { return _skyModel.get(); }
+        const SkyModel *getSkyModel() const { return _skyModel.get(); }
+
+        /**
+          Keep up to numImages complete sky textures in a least recently used cache,
+          so that returning to a recent sky, as when scrubbing time back and forth,
+          shows it complete immediately.  While the cache is enabled, the sun position
+          and turbidity the sky is computed for are quantized to the cache step and
+          to tenths of turbidity, and the skies for the next few steps in the
+          direction the sun last moved are computed ahead on a background thread.
+          0 (the default) disables the cache.
+          */
+        void setSkyImageCacheSize( unsigned int numImages );
+        unsigned int getSkyImageCacheSize() const { return _skyImageCacheSize; }
+
+        /** Set the sun position step, in degrees, of the sky image cache.  Defaults to 0.1. */
+        void setSkyImageCacheStep( double degrees );
+        double getSkyImageCacheStep() const { return _skyImageCacheStep; }
+
+        /** Set the number of skies computed ahead of the sun by the sky image cache.  Defaults to 4. */
+        void setNumSkyImagePrefetch( unsigned int num ) { _numSkyImagePrefetch = num; }
+        unsigned int getNumSkyImagePrefetch() const { return _numSkyImagePrefetch; }
+
+        /**
+          Compute the radiance of the sky in n directions, given in SkyDome coordinates
+          with Z up, with the sky model and the sun position and turbidity the sky
+          texture is currently computed for.  Directions need not be normalized.
+          Directions below the horizon return the sky mirrored about the horizon, as
+          the SkyDome draws it.  If toneMapped is true the results are the colors
+          written to the sky texture, in the range 0 to 1.  This does not touch the
+          scene graph and may be called from any thread, concurrently with updates.
+          */
+        void computeSkyRadiance( unsigned int n, const osg::Vec3 *directions, osg::Vec3 *radiance,
+                                 bool toneMapped=false ) const;
+
+        /**
+          Number of bytes of sky texture data uploaded to the GPU, summed over all
+          graphics contexts, during the most recently drawn frame.  Only the rows
+          that changed since a context last drew the sky are uploaded.
+          */
+        unsigned int getSkyTextureBytesUploaded() const;
+        /** Total number of bytes of sky texture data uploaded since the SkyDome was created */
+        double getSkyTextureTotalBytesUploaded() const;
+
+        /**
+          Choose the tesselation of the dome from the viewports and fields of view it
+          is drawn in.  The finest latitude step of each frame's views is measured
+          during cull, and the coarsest tesselation whose latitude step covers no
+          more than the auto tesselation pixel size is applied in the next update
+          traversal.  When disabled (the default) the dome stays at the tesselation
+          last set with setTesselation(), initially TessHigh.
           */
-        SkyDome( bool useBothHemispheres=true, bool MirrorInBothHemispheres=true );
+        void setAutoTesselation( bool flag );
+        bool getAutoTesselation() const { return _autoTesselation; }
+
+        /**
+          Set the largest size, in pixels, that one latitude step of the dome may
+          cover on screen when auto tesselation is enabled.  Defaults to 64.
+          */
+        void setAutoTesselationPixelSize( double pixels ) { _autoTesselationPixelSize = pixels; }
+        double getAutoTesselationPixelSize() const { return _autoTesselationPixelSize; }
+
+        /**
+          Spherical harmonic coefficients, to order 2, of the irradiance due to the
+          sky texture, for lighting diffuse surfaces to match the sky.  The nine
+          coefficients are in the order (l,m) = (0,0), (1,-1), (1,0), (1,1), (2,-2),
+          (2,-1), (2,0), (2,1), (2,2) of the real basis over directions in SkyDome
+          coordinates, with Z up.  Only the sky above the horizon contributes.
+          Recomputed once every row of the sky texture has been rewritten since the
+          last time, so with IncrementalUpdate and a moving sun the coefficients lag
+          the texture by at most one pass over its rows.
+          */
+        osg::Vec3 getSkyIrradianceSH( unsigned int index ) const { return _skyIrradianceSH[index]; }
+
+        /**
+          An array uniform "skyIrradianceSH" of nine vec3s holding the coefficients
+          returned by getSkyIrradianceSH().  The irradiance at normal n is the sum of
+          each coefficient times the corresponding basis function evaluated at n.
+          */
+        osg::Uniform *getSkyIrradianceSHUniform() { return _skyIrradianceSHUniform.get(); }
+
+        /**
+          Mean luminance of the sky texture above the horizon, weighted by solid angle,
+          for driving automatic exposure.  Recomputed along with the irradiance.
+          */
+        float getSkyMeanLuminance() const { return _skyMeanLuminance; }
+
+        /** A float uniform "skyMeanLuminance" holding getSkyMeanLuminance() */
+        osg::Uniform *getSkyMeanLuminanceUniform() { return _skyMeanLuminanceUniform.get(); }
 
         void setSunPos( double azimuth, double altitude );
         void setTurbidity( float t );
+
+        /**
+          Set the distance in degrees, in either azimuth or altitude, that the sun must
+          move from the position the sky texture was last computed for before the sky
+          texture is recomputed.  Smaller moves still reposition the sun itself.
+          Defaults to 0.05 degrees.
+          */
+        void setSunPositionThreshold( double degrees ) { _sunPositionThreshold = degrees; }
+        double getSunPositionThreshold() const { return _sunPositionThreshold; }
+
+        /**
+          Set the change in turbidity below which setTurbidity() is ignored.
+          Defaults to 0.01.
+          */
+        void setTurbidityThreshold( float threshold ) { _turbidityThreshold = threshold; }
+        float getTurbidityThreshold() const { return _turbidityThreshold; }
+
         virtual void traverse(osg::NodeVisitor&);
         static double getMeanDistanceToMoon() { return _meanDistanceToMoon; }
 
@@ -58,12 +262,20 @@ class OSGEPHEMERIS_EXPORT SkyDome:  public Sphere
 
     protected:
 
+        virtual ~SkyDome();
+
         static const double _meanDistanceToMoon;
 
         double _sunAzimuth;
         double _sunAltitude;
         double _sunFudgeScale;
 
+        // Sun position the sky texture is computed for
+        double _skySunAzimuth;
+        double _skySunAltitude;
+        double _sunPositionThreshold;
+        float _turbidityThreshold;
+
         unsigned int _skyTextureUnit;
         osg::ref_ptr<osg::Texture2D> _skyTexture;
 
@@ -74,21 +286,11 @@ class OSGEPHEMERIS_EXPORT SkyDome:  public Sphere
         osg::ref_ptr<osg::TexGen> _sunTexGenSouth;
 
         bool _mirrorInSouthernHemisphere;
+        // Draws the northern geode mirrored in Z as the southern hemisphere
+        osg::ref_ptr<osg::MatrixTransform> _southernMirrorTransform;
 
-        class SectorUpdateCallback: public osg::Drawable::UpdateCallback
-        {
-            public:
-                SectorUpdateCallback( double &sunAz, double min, double max, unsigned int sunTextureUnit );
-                //virtual bool cull(osg::NodeVisitor* nv, osg::Drawable *dbl, osg::State*) const ;
-                virtual void update(osg::NodeVisitor* nv, osg::Drawable* dbl);
-
-            protected:
-                double &_sunAz;
-                double _min, _max;
-                unsigned int _sunTextureUnit;
-                bool _withinDeg( double x, double min, double max ) const;
-        };
-
+        void _updateSunSectors();
+        static bool _withinDeg( double x, double min, double max );
 
         static double _range( double x, double r )
         {
@@ -105,75 +307,120 @@ class OSGEPHEMERIS_EXPORT SkyDome:  public Sphere
         static unsigned int  _sunImagePixelFormat;
         static unsigned char _sunImageData[];
 
-/* Sky luminance model adapted from:
- * A. J. Preetham, Peter, Shirley, Brian, Smits, "A Practical Analytic
- * Model for Daylight"
- * An implementation of Preetham is included here, but commented out.  This is
- * because the horizon and sunset colors from this model were very wrong.  Perhaps
- * this is a problem with the implementation, or perhaps the model.  The model in
- * use here is an empirical model by Terry Welsh, which is heavily influenced by
- * the Preetham model.
- */
-        // Turbitity
-        // The fraction of scattering due to haze rather than molecules
-        // 2 = quite a clear day
-        // 20 = hazy day
-        // Reasonable values are 1 - 60
-        float _T;
-
-        // Angle between sun direction and zenith
-        float _theta_sun, _theta_sun_0_1, _cos_theta_sun, _sin_theta_sun, _cos_theta_sun_squared;
- 
-        // Altitude at which total darkness occurs
-        float _dark_alt;
-        // How overall sky brightness varies with altitude
-        float _day_exp;
-        float _light_due_to_alt;  // in range {0,1}
-        
-        // sunset attenuation factor
-        float _sunset_atten;
- 
-        // Luminance distribution function coefficients.
-        // xyY is an accurate color representation designed by
-        // the Commission Internationale de l'Eclairage (CIE).
-        // Y is luminance, and x and y describe chromaticity (or color).
-        float _Ax, _Bx, _Cx, _Dx, _Ex;
-        float _Ay, _By, _Cy, _Dy, _Ey;
-        float _AY, _BY, _CY, _DY, _EY;
-
-        // Zenith color values in CIE xyY format
-        float _xz, _yz, _Yz;
-
-        // Terry's RGB coefficients
-        // A = horizon intensity
-        // B = horizon falloff
-        // C = circumsolar intensity
-        // D = circumsolar falloff
-        // E = overall (linear) component
-        float _Ar, _Br, _Cr, _Dr, _Er;
-        float _Ag, _Bg, _Cg, _Dg, _Eg;
-        float _Ab, _Bb, _Cb, _Db, _Eb;
-        float _horiz_atten_r, _solar_atten_r;
-        float _horiz_atten_g, _solar_atten_g;
-        float _horiz_atten_b, _solar_atten_b;
-
-        int _current_tex_row;
-
-        virtual void _updateDistributionCoefficients();
-        void _updateZenithxyY();
-        inline float _xDistributionFunction(const float theta, const float cos_theta,
-                                           const float gamma, const float cos_gamma_sq);
-        inline float _yDistributionFunction(const float theta, const float cos_theta,
-                                           const float gamma, const float cos_gamma_sq);
-        inline float _YDistributionFunction(const float theta, const float cos_theta,
-                                           const float gamma, const float cos_gamma_sq);
-        inline float   _RedFunction(const float theta, const float theta_0_1,
-                                          const float gamma, const float gamma_1_0);
-        inline float _GreenFunction(const float theta, const float theta_0_1,
-                                          const float gamma, const float gamma_1_0);
-        inline float  _BlueFunction(const float theta, const float theta_0_1,
-                                          const float gamma, const float gamma_1_0);
+        // Computes sky radiance for the sky texture and lookup table
+        osg::ref_ptr<SkyModel> _skyModel;
+        // Held for writing while the sky model or the sky sun position change,
+        // and for reading by computeSkyRadiance()
+        mutable OpenThreads::ReadWriteMutex _skyModelMutex;
+
+        // Rows of the sky texture not yet recomputed since the sky last changed
+        int _num_stale_rows;
+        std::vector<bool> _skyRowStale;
+        // Update frame since which each stale row has been out of date
+        std::vector<unsigned int> _skyRowStaleSince;
+        // Rows in the order IncrementalUpdate recomputes them, and the next to consider
+        std::vector<unsigned int> _skyRowOrder;
+        unsigned int _skyRowOrderCursor;
+        // Counts updates of the sky lighting.  Each row records the count when it
+        // was last rewritten, and rows not rewritten since the last update are
+        // counted, so that the lighting follows a sky that is never all current.
+        unsigned int _skyLightingGeneration;
+        std::vector<unsigned int> _skyRowLightingGeneration;
+        unsigned int _numSkyRowsPendingLighting;
+        // Counts calls to _computeSkyTexture()
+        unsigned int _skyUpdateFrame;
+        double _skyUpdateTimeBudget;
+        unsigned int _maxSkyRowAge;
+        double _skyUpdateTime;
+        unsigned int _numSkyRowsUpdated;
+        unsigned int _oldestSkyRowAge;
+        double _meanSkyRowAge;
+
+        unsigned int _skyTextureWidth;
+        unsigned int _skyTextureHeight;
+
+        SkyUpdateMode _skyUpdateMode;
+        unsigned int _numSkyUpdateThreads;
+
+        class SkyTextureThreadPool;
+        osg::ref_ptr<SkyTextureThreadPool> _skyTextureThreadPool;
+        std::vector<unsigned char> _skyBackBuffer;
+
+        class SkyTextureSubload;
+        osg::ref_ptr<SkyTextureSubload> _skyTextureSubload;
+
+        bool _useSkyLookupTable;
+        std::vector<float> _skyLookupTable;
+        std::vector<float> _skyLookupSlice;
+
+        // Sectors whose drawables currently have the sun texture enabled
+        unsigned int _sunSectorMask;
+        osg::ref_ptr<osg::StateSet> _sunSectorStateSet;
+
+        bool _autoTesselation;
+        double _autoTesselationPixelSize;
+        // Largest number of pixels per degree of the views culled since the last update
+        double _maxPixelsPerDegree;
+        OpenThreads::Mutex _pixelsPerDegreeMutex;
+
+        osg::Vec3 _skyIrradianceSH[9];
+        osg::ref_ptr<osg::Uniform> _skyIrradianceSHUniform;
+        float _skyMeanLuminance;
+        osg::ref_ptr<osg::Uniform> _skyMeanLuminanceUniform;
+
+        void _computeSkyLighting( const unsigned char *data );
+
+        // Quantized sky state, identifying an image in the sky image cache
+        struct SkyImageKey
+        {
+            int altitude;
+            int azimuth;
+            int turbidity;
+
+            bool operator == ( const SkyImageKey &rhs ) const
+            {
+                return altitude == rhs.altitude && azimuth == rhs.azimuth && turbidity == rhs.turbidity;
+            }
+            bool operator < ( const SkyImageKey &rhs ) const
+            {
+                if( altitude != rhs.altitude ) return altitude < rhs.altitude;
+                if( azimuth != rhs.azimuth ) return azimuth < rhs.azimuth;
+                return turbidity < rhs.turbidity;
+            }
+        };
+
+        unsigned int _skyImageCacheSize;
+        double _skyImageCacheStep;
+        unsigned int _numSkyImagePrefetch;
+        SkyImageKey _skyImageKey;
+
+        class SkyImageCache;
+        osg::ref_ptr<SkyImageCache> _skyImageCache;
+
+        SkyImageKey _makeSkyImageKey( double azimuth, double altitude, float turbidity ) const;
+        void _clearSkyImageCache();
+        bool _loadCachedSkyImage();
+        void _prefetchSkyImages( const SkyImageKey &from, const SkyImageKey &to );
+        void _skyTextureComplete( const unsigned char *data );
+
+        void _updateTesselation();
+
+        void _markSkyStale();
+        void _setSkyRowsCurrent();
+        void _updateSkyRow( osg::Image *image, unsigned int row );
+        void _updateSkyRowAgeStats();
+        osg::Image *_createSkyImage();
+        static void _toneMap( unsigned int n, float *r, float *g, float *b );
+        void _buildSkyLookupTable();
+        void _updateSkyLookupSlice();
+        void _computeSkyLookupSlice( double sunAltitude, std::vector<float> &slice ) const;
         void _computeSkyTexture();
+        void _computeSkyRows( unsigned char *data, int firstRow, int endRow );
+        static void _computeSkyRows( const SkyModel *model, const float *lookupSlice,
+                                     unsigned int textureWidth, unsigned int textureHeight,
+                                     SkyTexCoordMapping mapping,
+                                     double sunAzimuth, double sunAltitude,
+                                     unsigned char *data, int firstRow, int endRow );
 };
 
 }
@@ -0,0 +1,170 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#ifndef OSG_EPHEMERIS_SKY_MODEL_DEF
+#define OSG_EPHEMERIS_SKY_MODEL_DEF
+
+#include <osg/Referenced>
+
+#include <osgEphemeris/Export.h>
+
+namespace osgEphemeris {
+
+    /** \class SkyModel
+        \brief Interface to the model used by SkyDome to compute the color of the sky.
+
+        A sky model computes linear RGB sky radiance for a batch of view directions
+        at once, for the current turbidity and sun altitude.  Each direction is given
+        by the cosines of its angle from the zenith and of its angle from the sun, so
+        models never deal with azimuth.  The result is tone mapped by the SkyDome.
+
+        computeRadiance() only reads the model, and may be called from several threads
+        at once.  The setters may not be called concurrently with it.
+      */
+
+class OSGEPHEMERIS_EXPORT SkyModel : public osg::Referenced
+{
+    public:
+        SkyModel();
+
+        /**
+          Set the turbidity, the fraction of scattering due to haze rather than
+          molecules.  2 is quite a clear day, 20 a hazy day.  Clamped to {1, 60}.
+          */
+        void setTurbidity( float T );
+        float getTurbidity() const { return _T; }
+
+        /** Set the altitude of the sun above the horizon, in degrees */
+        void setSunAltitude( double altitude );
+        double getSunAltitude() const { return _sunAltitude; }
+
+        /**
+          Compute the radiance of n directions into r, g and b.  cosTheta holds the
+          cosine of the angle between each direction and the zenith, and cosGamma the
+          cosine of the angle between each direction and the sun.
+          */
+        virtual void computeRadiance( unsigned int n,
+                                      const float *cosTheta, const float *cosGamma,
+                                      float *r, float *g, float *b ) const = 0;
+
+        /** Return a new model of the same type and state */
+        virtual SkyModel *clone() const = 0;
+
+    protected:
+        virtual ~SkyModel() {}
+
+        /** Called when the turbidity changes */
+        virtual void _updateTurbidity() = 0;
+        /** Called when the sun altitude changes */
+        virtual void _updateSunAltitude() = 0;
+
+        float _T;
+        double _sunAltitude;
+
+        // Overall sky brightness due to sun altitude, in the range {0, 1}
+        float _lightDueToAltitude;
+        void _updateLightDueToAltitude();
+};
+
+    /** \class WelshSkyModel
+        \brief Empirical sky model by Terry Welsh, loosely based on Preetham.  This
+               is the default model used by SkyDome.
+      */
+
+class OSGEPHEMERIS_EXPORT WelshSkyModel : public SkyModel
+{
+    public:
+        WelshSkyModel();
+
+        virtual void computeRadiance( unsigned int n,
+                                      const float *cosTheta, const float *cosGamma,
+                                      float *r, float *g, float *b ) const;
+
+        virtual SkyModel *clone() const { return new WelshSkyModel( *this ); }
+
+    protected:
+        virtual void _updateTurbidity();
+        virtual void _updateSunAltitude();
+
+        // Terry's RGB coefficients
+        // A = horizon intensity
+        // B = horizon falloff
+        // C = circumsolar intensity
+        // D = circumsolar falloff
+        // E = overall (linear) component
+        float _Ar, _Br, _Cr, _Dr, _Er;
+        float _Ag, _Bg, _Cg, _Dg, _Eg;
+        float _Ab, _Bb, _Cb, _Db, _Eb;
+        float _horiz_atten_r, _solar_atten_r;
+        float _horiz_atten_g, _solar_atten_g;
+        float _horiz_atten_b, _solar_atten_b;
+
+        // sunset attenuation factor
+        float _sunset_atten;
+};
+
+    /** \class PreethamSkyModel
+        \brief A. J. Preetham, Peter Shirley, Brian Smits, "A Practical Analytic
+               Model for Daylight".
+
+        The model is only defined for directions and suns above the horizon.  Zenith
+        angles are limited to just under 90 degrees, the sun is kept at or above the
+        horizon for the zenith color, and the sky is darkened with sun altitude the
+        same way as WelshSkyModel, which gives usable twilight and horizon colors.
+      */
+
+class OSGEPHEMERIS_EXPORT PreethamSkyModel : public SkyModel
+{
+    public:
+        PreethamSkyModel();
+
+        virtual void computeRadiance( unsigned int n,
+                                      const float *cosTheta, const float *cosGamma,
+                                      float *r, float *g, float *b ) const;
+
+        virtual SkyModel *clone() const { return new PreethamSkyModel( *this ); }
+
+    protected:
+        virtual void _updateTurbidity();
+        virtual void _updateSunAltitude();
+
+        void _updateSunAngle();
+        void _updateZenithxyY();
+
+        // Angle between sun direction and zenith
+        float _theta_sun, _cos_theta_sun_squared;
+
+        // Luminance distribution function coefficients.
+        // xyY is an accurate color representation designed by
+        // the Commission Internationale de l'Eclairage (CIE).
+        // Y is luminance, and x and y describe chromaticity (or color).
+        float _Ax, _Bx, _Cx, _Dx, _Ex;
+        float _Ay, _By, _Cy, _Dy, _Ey;
+        float _AY, _BY, _CY, _DY, _EY;
+
+        // Zenith color values in CIE xyY format, divided by the
+        // distribution function at the zenith
+        float _xz, _yz, _Yz;
+};
+
+}
+
+#endif
@@ -24,6 +24,7 @@
 
 #include <osg/Geode>
 #include <osg/LOD>
+#include <osg/MatrixTransform>
 
 #include <osgEphemeris/Export.h>
 
@@ -32,6 +33,15 @@ namespace osgEphemeris {
 /** \class Sphere
     \brief A geometric sphere containing a northern and southern hemisphere.
 
+    The vertex arrays and primitive sets are built at unit radius and shared by
+    every Sphere in the process with the same tesselation, orientation and
+    texture coordinates.  Each Sphere has its own Geometry objects, so drawables
+    can carry their own state, and scales them to its radius with a transform.
+
+    The hemisphere Geodes are therefore not children of the Sphere itself.  The
+    Sphere has a single MatrixTransform child, scaling unit radius to the radius
+    of the Sphere, and the Geodes are its children.  Use getNorthernHemisphere()
+    and getSouthernHemisphere() rather than walking the children of the Sphere.
     */
            
 
@@ -57,6 +67,15 @@ class OSGEPHEMERIS_EXPORT Sphere : public osg::Group
             BothHemispheres = 3
         };
 
+        /** How altitude maps to the t texture coordinate when sky texture coordinates are used */
+        enum SkyTexCoordMapping {
+            /** t is proportional to altitude */
+            LinearAltitude,
+            /** t is 2x - x^2 of the altitude x as a fraction of 90 degrees, giving
+                twice as many texels per degree at the horizon as LinearAltitude */
+            HorizonWeightedAltitude
+        };
+
         bool _skyTexCoords;
 
         Sphere( double radius=_defaultRadius,
@@ -71,13 +90,42 @@ class OSGEPHEMERIS_EXPORT Sphere : public osg::Group
         osg::Geode *getSouthernHemisphere() { return _southernHemisphere.get(); }
         static double getDefaultRadius();
 
+        /**
+          Set the altitude mapping of sky texture coordinates, switching existing
+          geometry to the matching texture coordinates.  Has no effect unless the
+          Sphere was constructed with sky texture coordinates.
+          */
+        void setSkyTexCoordMapping( SkyTexCoordMapping mapping );
+        SkyTexCoordMapping getSkyTexCoordMapping() const { return _skyTexCoordMapping; }
+
+        /**
+          Switch existing geometry to a different tesselation resolution.  The
+          hemispheres keep their Geometry objects and state, only the shared
+          arrays and primitive sets are replaced.
+          */
+        void setTesselation( TesselationResolution tr );
+        TesselationResolution getTesselation() const { return _tesselation; }
+
     protected:
 
+        SkyTexCoordMapping _skyTexCoordMapping;
+        TesselationResolution _tesselation;
+        Orientation _orientation;
+
+        osg::ref_ptr<osg::MatrixTransform> _radiusTransform;
         osg::ref_ptr<osg::Geode> _northernHemisphere;
         osg::ref_ptr<osg::Geode> _southernHemisphere;
 
         static const double _defaultRadius;
-        
+
+        void _applySharedGeometry( osg::Geode *geode, int hemisphere );
+
+        /**
+          The texture coordinates of the point on the sphere with unit vector
+          normal, in the given sector of four.  t follows the sky texture
+          coordinate mapping.  The shared geometry no longer uses this, it is
+          kept for subclasses that build geometry of their own.
+          */
         osg::Vec2 makeTexCoord(osg::Vec3 &normal, unsigned int sector);
 };
 
@@ -0,0 +1,129 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#ifndef OSG_EPHEMERIS_STAR_CATALOG_DEF
+#define OSG_EPHEMERIS_STAR_CATALOG_DEF
+
+#include <string>
+#include <vector>
+
+#include <osg/Referenced>
+
+#include <osgEphemeris/Export.h>
+#include <osgEphemeris/IntTypes.h>
+
+namespace osgEphemeris {
+
+/** \struct StarCatalogRecord
+    \brief One star of a binary star catalog.  Angles are in radians, epoch 2000.
+    */
+struct StarCatalogRecord
+{
+    float rightAscension;
+    float declination;
+    float magnitude;
+    /** B-V color index */
+    float colorIndex;
+};
+
+/** \struct StarCatalogHeader
+    \brief The header at the start of a binary star catalog file, followed
+           immediately by numStars StarCatalogRecords sorted by magnitude,
+           brightest first.
+
+    From version 2 the records are followed by the names of the stars, as
+    numStars + 1 uint32_t offsets and then the characters of the names, not
+    terminated.  Star i is named by characters offset[i] up to offset[i+1].
+    Version 1 catalogs, which have no names, are still read.
+    */
+struct StarCatalogHeader
+{
+    char magic[8];
+    /** Written as 0x01020304, to detect files of the other byte order */
+    uint32_t byteOrder;
+    uint32_t version;
+    uint32_t numStars;
+    uint32_t recordSize;
+};
+
+/** \class StarCatalog
+    \brief A read only, memory mapped binary star catalog.
+
+    The records of the catalog are used where they lie in the mapped file, so
+    loading costs little more than reading the pages that are touched.  Binary
+    catalogs are written by StarCatalog::write(), and from the text format read
+    by StarField by the makeStarCatalog tool.
+    */
+class OSGEPHEMERIS_EXPORT StarCatalog : public osg::Referenced
+{
+    public:
+        /**
+          Map the binary star catalog in fileName.  valid() returns false if the
+          file can not be mapped or is not a binary star catalog.
+          */
+        StarCatalog( const std::string &fileName );
+
+        bool valid() const { return _records != 0L; }
+
+        unsigned int getNumStars() const { return _numStars; }
+        const StarCatalogRecord *getStars() const { return _records; }
+
+        /** Return false for version 1 catalogs, which have no star names */
+        bool hasStarNames() const { return _nameOffsets != 0L; }
+
+        /**
+          Return the name of star number star, or an empty string if the star
+          has no name or the catalog has no names.
+          */
+        std::string getStarName( unsigned int star ) const;
+
+        /**
+          Return true if fileName starts with the magic number of a binary star catalog
+          */
+        static bool isStarCatalogFile( const std::string &fileName );
+
+        /**
+          Write records, which are sorted by magnitude first, as a binary star
+          catalog.  names, if not empty, holds the name of each record.
+          */
+        static bool write( const std::string &fileName, const std::vector<StarCatalogRecord> &records,
+                           const std::vector<std::string> &names = std::vector<std::string>() );
+
+        static const char *getMagic() { return _magic; }
+        static const uint32_t Version = 2;
+
+    protected:
+        virtual ~StarCatalog();
+
+        void *_start;
+        size_t _length;
+        unsigned int _numStars;
+        const StarCatalogRecord *_records;
+        const uint32_t *_nameOffsets;
+        const char *_names;
+        size_t _namesLength;
+
+        static const char _magic[8];
+};
+
+}
+
+#endif
@@ -26,11 +26,16 @@
 #include <sstream>
 #include <vector>
 
+#include <osg/Array>
 #include <osg/MatrixTransform>
 #include <osg/Geode>
 #include <osg/Uniform>
+#include <OpenThreads/Mutex>
 
 #include <osgEphemeris/Export.h>
+#include <osgEphemeris/StarIndex.h>
+#include <osgEphemeris/StarCatalog.h>
+#include <osgEphemeris/LabelBatch.h>
 
 namespace osgEphemeris {
 
@@ -42,7 +47,8 @@ namespace osgEphemeris {
     Each point represents the projection of a star in the sky on to a sphere
     with radius as specified in the constructor.  Each point represents the 
     position of the star and is rendered with a brightness that approximates
-    the corresponding magnitude as specified in a database of stars.
+    the corresponding magnitude as specified in a database of stars, tinted by
+    its B-V colour index where the database gives one.
 
     The current database of stars come from The Yale Bright Star Catalogue, 
     from the YBS.edb file of XEphem 3.5.2.  
@@ -59,7 +65,9 @@ class OSGEPHEMERIS_EXPORT StarField: public osg::MatrixTransform
     public:
         /**
           Constructor.
-          \param fileName - The name of the file containing the catalogue of stars
+          \param fileName - The name of the file containing the catalogue of stars, either
+                             as a binary StarCatalog or as text lines of
+                             "name,right ascension,declination,magnitude[,B-V]"
           \param radius   - The radius of the projection sphere 
           */
         StarField( const std::string &fileName="", double radius=_defaultRadius );
@@ -69,6 +77,54 @@ class OSGEPHEMERIS_EXPORT StarField: public osg::MatrixTransform
           */
         unsigned int getNumStars();
 
+        /**
+          Get the number of tiles the Star Field is partitioned into.  Stars
+          are grouped into tiles on the faces of a cube, each a separate
+          drawable so that those outside the view frustum are culled.
+          */
+        unsigned int getNumTiles();
+
+        /**
+          Create a Geode drawing only the stars at least as bright as the
+          given magnitude.  It shares the star field's vertex arrays and state,
+          and is positioned in the star field's coordinate system.
+          */
+        osg::Geode *createBrightStarGeode( double limitingMagnitude );
+
+        /**
+          Get a spatial index of the stars, for finding those within a cone or
+          frustum without scanning the whole catalog.  Star directions are in
+          the star field's coordinate system, before the rotation of its matrix,
+          and are computed from the catalogue at full precision, not decoded
+          from the packed star vertices.  Stars are numbered as in the 
+          catalogue, as for getStar().  The index is built on first use, and
+          may be shared between threads.
+          */
+        const StarIndex *getStarIndex();
+
+        /**
+          Get star number star of the catalogue.  Stars are numbered in the
+          order of the catalogue, brightest first, for text catalogues once
+          sorted by magnitude.  Returns false if there is no such star.
+          */
+        bool getStar( unsigned int star, StarCatalogRecord &record ) const;
+
+        /**
+          Get the name of star number star of the catalogue, or an empty string
+          if it has none.  Binary catalogues written before version 2 of the
+          format have no names.
+          */
+        std::string getStarName( unsigned int star ) const;
+
+        /**
+          Show or hide the names of the brightest stars, and of Polaris.  Labels
+          are built the first time they are shown, as a single LabelBatch.  A
+          binary catalogue without names shows no labels, with a warning.
+          */
+        void setStarLabels( bool flag );
+
+        bool getStarLabels() const;
+
         /**
           Set the SunAltitude.  This is used to determine brightness of the 
           stars according to daylight scatter in the atmosphere.  When the sun is 
@@ -76,25 +132,66 @@ class OSGEPHEMERIS_EXPORT StarField: public osg::MatrixTransform
           */
         virtual void setSunAltitude(  double altitude );
 
+        /**
+          Get the magnitude of the faintest star drawn in a view with the given
+          vertical field of view, in degrees.  This is limited by the brightness 
+          of the sky for the current sun altitude, and deepened for views narrower
+          than 45 degrees, as through a telescope.  Only stars as bright as this
+          are drawn, so no stars are drawn in daylight.
+          */
+        double getLimitingMagnitude( double fovy ) const;
+
+        virtual void traverse(osg::NodeVisitor&);
+
     protected:
         struct StarData {
             std::string name;
             double right_ascension;
             double declination;
             double magnitude;
+            // B-V colour index
+            double color_index;
 
             StarData( std::stringstream &ss );
+
+            bool operator < ( const StarData &rhs ) const { return magnitude < rhs.magnitude; }
         };
 
         std::vector<StarData> _stars;
+        // Magnitude of each star of the geometry, grouped by tile and
+        // brightest first within each tile
+        std::vector<float> _magnitudes;
+        // Index in _magnitudes of the first star of each tile drawable,
+        // followed by the total number of stars
+        std::vector<unsigned int> _tileOffsets;
+        static const unsigned int _starsPerTile;
         double _radius;
         static const double _defaultRadius;
         osg::ref_ptr<osg::Geode> _starGeode;
-        osg::ref_ptr<osg::Geode> _starLabelsGeode;
+        osg::ref_ptr<LabelBatch> _starLabels;
+        // Brightness limited levels of the star geode, and the magnitude of
+        // the faintest star each draws.  The last level is _starGeode.
+        std::vector< osg::ref_ptr<osg::Geode> > _starLevels;
+        std::vector<float> _starLevelMagnitudes;
+        float _brightestMagnitude;
+        double _sunLimitingMagnitude;
+        bool _defaultStarField;
+        static const double _referenceFieldOfView;
+        static const double _nightLimitingMagnitude;
+        static const double _twilightLimitingMagnitude;
+        osg::ref_ptr<StarIndex> _starIndex;
+        OpenThreads::Mutex _starIndexMutex;
+        // The records of a binary or the default catalogue.  A text catalogue
+        // is kept in _stars instead.
+        osg::ref_ptr<StarCatalog> _catalog;
+        const StarCatalogRecord *_records;
+        unsigned int _numRecords;
 
         bool _parseFile( const std::string fileName );
         void _parseStream( std::istream & );
         void _buildGeometry(void);
+        void _buildGeometry( const StarCatalogRecord *stars, unsigned int numStars );
+        void _buildStarGeode( const std::vector<osg::Vec3> &directions, const std::vector<float> &colorIndices );
         void _buildLabels(void);
 
         static std::string _vertexShaderProgram;
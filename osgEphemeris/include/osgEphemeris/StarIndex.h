@@ -0,0 +1,120 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#ifndef OSG_EPHEMERIS_STAR_INDEX_DEF
+#define OSG_EPHEMERIS_STAR_INDEX_DEF
+
+#include <vector>
+
+#include <osg/Referenced>
+#include <osg/Vec3>
+#include <osg/Polytope>
+
+#include <osgEphemeris/Export.h>
+
+namespace osgEphemeris {
+
+/** \class StarIndex
+    \brief A spatial index of star directions, for finding the stars that fall
+           within a cone or a frustum.
+
+    The unit sphere is divided into a grid of cells on the faces of a cube,
+    each face a quadtree of cells.  Queries descend the quadtrees, skipping 
+    cells outside the query region and taking whole cells inside it without
+    testing each star, so their cost follows the number of stars found rather
+    than the size of the catalog.
+
+    Stars are numbered in the order they are given to the constructor, so
+    the indices returned by queries are those of the caller's catalog.  They
+    are returned in ascending order, which is brightest first for catalogs
+    sorted by magnitude.
+    */
+class OSGEPHEMERIS_EXPORT StarIndex : public osg::Referenced
+{
+    public:
+        /**
+          Build the index.  Star i of the index is element i of directions and magnitudes.
+          \param directions - The direction of each star.  They need not be of unit length.
+          \param magnitudes - The magnitude of each star.
+          */
+        StarIndex( const std::vector<osg::Vec3> &directions, const std::vector<float> &magnitudes );
+
+        unsigned int getNumStars() const { return _magnitudes.size(); }
+
+        /** Get the unit direction of a star */
+        const osg::Vec3 &getDirection( unsigned int star ) const { return _directions[_slots[star]]; }
+
+        /** Get the magnitude of a star */
+        float getMagnitude( unsigned int star ) const { return _magnitudes[_slots[star]]; }
+
+        /**
+          Find the stars at least as bright as limitingMagnitude within halfAngle
+          radians of axis.  The indices of the stars found replace the contents
+          of stars, in ascending order.
+          */
+        void queryCone( const osg::Vec3 &axis, double halfAngle, double limitingMagnitude,
+                        std::vector<unsigned int> &stars ) const;
+
+        /**
+          Find the stars at least as bright as limitingMagnitude whose unit 
+          directions lie inside every plane of frustum.  For a view frustum with
+          the eye at the center of the sphere, the side planes are enough.  The 
+          indices of the stars found replace the contents of stars, in ascending order.
+          */
+        void queryFrustum( const osg::Polytope &frustum, double limitingMagnitude,
+                           std::vector<unsigned int> &stars ) const;
+
+    protected:
+        virtual ~StarIndex() {}
+
+        // A cone or frustum being queried
+        struct Region;
+
+        // Number of cells along each edge of a cube face, a power of two
+        unsigned int _resolution;
+        unsigned int _depth;
+        // Index in the cell ordered arrays of the first star of each cell, in
+        // face then Morton order so that each quadtree node is a contiguous
+        // range, followed by the total number of stars
+        std::vector<unsigned int> _cellStart;
+        // The stars of each cell in turn, brightest first within each cell
+        std::vector<unsigned int> _cellStars;
+        std::vector<osg::Vec3> _directions;
+        std::vector<float> _magnitudes;
+        // Index in the cell ordered arrays of each star
+        std::vector<unsigned int> _slots;
+        float _brightestMagnitude;
+        // Largest angle from the center of a quadtree node to its edge, at each level
+        std::vector<double> _levelRadius;
+        static const unsigned int _starsPerCell;
+
+        unsigned int _cell( const osg::Vec3 &direction ) const;
+        void _query( const Region &region, double limitingMagnitude, std::vector<unsigned int> &stars ) const;
+        void _queryNode( const Region &region, unsigned int face, unsigned int level,
+                         unsigned int i, unsigned int j, double limitingMagnitude,
+                         std::vector<unsigned int> &stars ) const;
+        void _addCells( unsigned int firstCell, unsigned int endCell, double limitingMagnitude,
+                        std::vector<unsigned int> &stars ) const;
+};
+
+}
+
+#endif
@@ -0,0 +1,343 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+/*
+ * makeResourcePack - writes the moon and sun images used by osgEphemeris to
+ * a resource pack, with their mipmaps, for osgEphemeris::ResourcePack.  With
+ * -dxt, RGB images are stored DXT1 compressed.
+ *
+ * Given only the name of the pack, the images are those compiled into the
+ * library, which are also linked into this tool so that libraries built 
+ * without them can still be given a complete pack.  Otherwise the moon, moon
+ * normal and sun images are read from the files given.
+ *
+ * Point the OSGEPHEMERIS_RESOURCE_PACK environment variable at the pack, or
+ * install it as osgEphemeris.pack on the data file path.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include <string>
+#include <vector>
+
+#include <osg/Image>
+#include <osgDB/ReadFile>
+
+#include <osgEphemeris/ResourcePack.h>
+#include <osgEphemeris/MoonModel.h>
+#include <osgEphemeris/SkyDome.h>
+
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+
+// Append the levels of an 8 bit per component image, each a box filtered
+// half of the one before, down to 1x1.
+static osg::Image *makeMipmaps( const osg::Image *image )
+{
+    const unsigned int components = image->getPixelSizeInBits() / 8;
+    unsigned int w = image->s();
+    unsigned int h = image->t();
+
+    std::vector<unsigned char> data( image->data(), image->data() + w * h * components );
+    osg::Image::MipmapDataType mipmaps;
+    unsigned int level = 0;
+    while( w > 1 || h > 1 )
+    {
+        const unsigned int nw = w > 1 ? w/2 : 1;
+        const unsigned int nh = h > 1 ? h/2 : 1;
+        const unsigned int next = data.size();
+        data.resize( next + nw * nh * components );
+
+        for( unsigned int y = 0; y < nh; y++ )
+        {
+            const unsigned int y0 = std::min( y*2, h-1 ), y1 = std::min( y*2+1, h-1 );
+            for( unsigned int x = 0; x < nw; x++ )
+            {
+                const unsigned int x0 = std::min( x*2, w-1 ), x1 = std::min( x*2+1, w-1 );
+                for( unsigned int c = 0; c < components; c++ )
+                {
+                    unsigned int sum = data[level + (y0*w + x0)*components + c] +
+                                       data[level + (y0*w + x1)*components + c] +
+                                       data[level + (y1*w + x0)*components + c] +
+                                       data[level + (y1*w + x1)*components + c];
+                    data[next + (y*nw + x)*components + c] = (unsigned char)((sum + 2) / 4);
+                }
+            }
+        }
+
+        mipmaps.push_back( next );
+        level = next;
+        w = nw;
+        h = nh;
+    }
+
+    unsigned char *pixels = new unsigned char[data.size()];
+    memcpy( pixels, &data.front(), data.size() );
+
+    osg::Image *out = new osg::Image;
+    out->setImage( image->s(), image->t(), 1,
+                   image->getInternalTextureFormat(),
+                   image->getPixelFormat(),
+                   GL_UNSIGNED_BYTE,
+                   pixels,
+                   osg::Image::USE_NEW_DELETE );
+    out->setMipmapLevels( mipmaps );
+    return out;
+}
+
+static unsigned short toRGB565( const unsigned char *c )
+{
+    return (unsigned short)(((c[0] >> 3) << 11) | ((c[1] >> 2) << 5) | (c[2] >> 3));
+}
+
+static void fromRGB565( unsigned short v, int *c )
+{
+    c[0] = ((v >> 11) & 31) * 255 / 31;
+    c[1] = ((v >>  5) & 63) * 255 / 63;
+    c[2] = ( v        & 31) * 255 / 31;
+}
+
+// Compress one 4x4 block of RGB pixels, using the darkest and brightest
+// pixels as the end points.
+static void compressBlock( const unsigned char block[16][3], unsigned char *out )
+{
+    unsigned int lo = 0, hi = 0;
+    int minLum = 0x7fffffff, maxLum = -1;
+    for( unsigned int i = 0; i < 16; i++ )
+    {
+        int lum = block[i][0]*2 + block[i][1]*4 + block[i][2];
+        if( lum < minLum ) { minLum = lum; lo = i; }
+        if( lum > maxLum ) { maxLum = lum; hi = i; }
+    }
+
+    unsigned short c0 = toRGB565( block[hi] );
+    unsigned short c1 = toRGB565( block[lo] );
+    if( c0 < c1 )
+        std::swap( c0, c1 );
+
+    // c0 > c1 selects the four colour mode; a flat block uses index 0 only
+    int palette[4][3];
+    fromRGB565( c0, palette[0] );
+    fromRGB565( c1, palette[1] );
+    for( unsigned int c = 0; c < 3; c++ )
+    {
+        palette[2][c] = (2*palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2*palette[1][c]) / 3;
+    }
+
+    unsigned int indices = 0;
+    if( c0 != c1 )
+    {
+        for( unsigned int i = 0; i < 16; i++ )
+        {
+            unsigned int best = 0;
+            int bestDistance = 0x7fffffff;
+            for( unsigned int p = 0; p < 4; p++ )
+            {
+                int distance = 0;
+                for( unsigned int c = 0; c < 3; c++ )
+                {
+                    int d = int(block[i][c]) - palette[p][c];
+                    distance += d*d;
+                }
+                if( distance < bestDistance )
+                {
+                    bestDistance = distance;
+                    best = p;
+                }
+            }
+            indices |= best << (i*2);
+        }
+    }
+
+    out[0] = (unsigned char)(c0 & 0xff);
+    out[1] = (unsigned char)(c0 >> 8);
+    out[2] = (unsigned char)(c1 & 0xff);
+    out[3] = (unsigned char)(c1 >> 8);
+    for( unsigned int i = 0; i < 4; i++ )
+        out[4+i] = (unsigned char)((indices >> (i*8)) & 0xff);
+}
+
+// DXT1 compress every level of a mipmapped RGB image
+static osg::Image *compressDXT1( osg::Image *image )
+{
+    std::vector<unsigned char> data;
+    osg::Image::MipmapDataType mipmaps;
+
+    unsigned int w = image->s();
+    unsigned int h = image->t();
+    for( unsigned int level = 0; level < image->getNumMipmapLevels(); level++ )
+    {
+        if( level > 0 )
+            mipmaps.push_back( data.size() );
+
+        const unsigned char *src = image->getMipmapData( level );
+        for( unsigned int by = 0; by < h; by += 4 )
+        {
+            for( unsigned int bx = 0; bx < w; bx += 4 )
+            {
+                // Pixels past the edge of small levels repeat the last row or column
+                unsigned char block[16][3];
+                for( unsigned int i = 0; i < 16; i++ )
+                {
+                    const unsigned int x = std::min( bx + i%4, w-1 );
+                    const unsigned int y = std::min( by + i/4, h-1 );
+                    memcpy( block[i], src + (y*w + x)*3, 3 );
+                }
+
+                unsigned char out[8];
+                compressBlock( block, out );
+                data.insert( data.end(), out, out + 8 );
+            }
+        }
+
+        w = w > 1 ? w/2 : 1;
+        h = h > 1 ? h/2 : 1;
+    }
+
+    unsigned char *pixels = new unsigned char[data.size()];
+    memcpy( pixels, &data.front(), data.size() );
+
+    osg::Image *out = new osg::Image;
+    out->setImage( image->s(), image->t(), 1,
+                   GL_COMPRESSED_RGB_S3TC_DXT1_EXT,
+                   GL_COMPRESSED_RGB_S3TC_DXT1_EXT,
+                   GL_UNSIGNED_BYTE,
+                   pixels,
+                   osg::Image::USE_NEW_DELETE );
+    out->setMipmapLevels( mipmaps );
+    return out;
+}
+
+// The compiled in images are protected members of the classes that use
+// them, reached through subclasses that are never instantiated.
+struct EmbeddedMoonImages : public osgEphemeris::MoonModel
+{
+    static osg::Image *moon()
+    {
+        osg::Image *image = new osg::Image;
+        image->setImage( _moonImageHiLodWidth, _moonImageHiLodHeight, 1,
+                         _moonImageInternalTextureFormat,
+                         _moonImagePixelFormat,
+                         GL_UNSIGNED_BYTE,
+                         _moonImageHiLodData,
+                         osg::Image::NO_DELETE );
+        return image;
+    }
+
+    static osg::Image *moonNormal()
+    {
+        osg::Image *image = new osg::Image;
+        image->setImage( _moonNormalImageHiLodWidth, _moonNormalImageHiLodHeight, 1,
+                         _moonNormalImageInternalTextureFormat,
+                         _moonNormalImagePixelFormat,
+                         GL_UNSIGNED_BYTE,
+                         _moonNormalImageHiLodData,
+                         osg::Image::NO_DELETE );
+        return image;
+    }
+};
+
+struct EmbeddedSunImage : public osgEphemeris::SkyDome
+{
+    static osg::Image *sun()
+    {
+        osg::Image *image = new osg::Image;
+        image->setImage( _sunImageWidth, _sunImageHeight, 1,
+                         _sunImageInternalTextureFormat,
+                         _sunImagePixelFormat,
+                         GL_UNSIGNED_BYTE,
+                         _sunImageData,
+                         osg::Image::NO_DELETE );
+        return image;
+    }
+};
+
+int main( int argc, char **argv )
+{
+    bool dxt = false;
+    int arg = 1;
+    if( arg < argc && strcmp( argv[arg], "-dxt" ) == 0 )
+    {
+        dxt = true;
+        arg++;
+    }
+
+    const bool embedded = argc - arg == 1;
+    if( !embedded && argc - arg != 4 )
+    {
+        fprintf( stderr, "usage: %s [-dxt] [<moon image> <moon normal image> <sun image>] <resource pack>\n", argv[0] );
+        return 1;
+    }
+    const char *packFile = argv[argc-1];
+
+    const char *names[3] = { "moon", "moonNormal", "sun" };
+
+    std::vector<std::string> packNames;
+    std::vector< osg::ref_ptr<osg::Image> > packImages;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        const char *fileName = embedded ? names[i] : argv[arg+i];
+        osg::ref_ptr<osg::Image> image;
+        if( embedded )
+        {
+            switch( i )
+            {
+                case 0:  image = EmbeddedMoonImages::moon(); break;
+                case 1:  image = EmbeddedMoonImages::moonNormal(); break;
+                default: image = EmbeddedSunImage::sun(); break;
+            }
+        }
+        else
+            image = osgDB::readImageFile( fileName );
+
+        if( !image.valid() )
+        {
+            fprintf( stderr, "Unable to read image \"%s\"\n", fileName );
+            return 1;
+        }
+        if( image->getDataType() != GL_UNSIGNED_BYTE ||
+            (image->getPixelFormat() != GL_RGB && image->getPixelFormat() != GL_RGBA) )
+        {
+            fprintf( stderr, "\"%s\" is not an RGB or RGBA image of unsigned bytes\n", fileName );
+            return 1;
+        }
+
+        image = makeMipmaps( image.get() );
+
+        // The alpha of the sun image is its shape, so only RGB images are compressed
+        if( dxt && image->getPixelFormat() == GL_RGB )
+            image = compressDXT1( image.get() );
+
+        packNames.push_back( names[i] );
+        packImages.push_back( image );
+    }
+
+    if( !osgEphemeris::ResourcePack::write( packFile, packNames, packImages ))
+        return 1;
+
+    printf( "%s: %u images\n", packFile, (unsigned int)packImages.size() );
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+/*
+ * makeStarCatalog - converts a star catalog in the text format read by
+ * osgEphemeris::StarField to the binary format of osgEphemeris::StarCatalog.
+ *
+ * Each line of the text format is
+ *
+ *     name,right ascension,declination,magnitude[,B-V color index]
+ *
+ * with angles in radians.  Empty lines and lines starting with '#' are skipped.
+ * The names are kept in the binary catalog, for star labels.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include <osgEphemeris/StarCatalog.h>
+
+static bool parseField( char *&ptr, float &value )
+{
+    char *end;
+    value = float(strtod( ptr, &end ));
+    if( end == ptr )
+        return false;
+    ptr = end;
+    while( *ptr == ' ' || *ptr == '\t' )
+        ptr++;
+    if( *ptr == ',' )
+        ptr++;
+    return true;
+}
+
+int main( int argc, char **argv )
+{
+    if( argc != 3 )
+    {
+        fprintf( stderr, "usage: %s <text catalog> <binary catalog>\n", argv[0] );
+        return 1;
+    }
+
+    FILE *fp = fopen( argv[1], "r" );
+    if( fp == NULL )
+    {
+        perror( argv[1] );
+        return 1;
+    }
+
+    std::vector<osgEphemeris::StarCatalogRecord> records;
+    std::vector<std::string> names;
+    char line[1024];
+    unsigned int lineNumber = 0;
+    while( fgets( line, sizeof(line), fp ) != NULL )
+    {
+        lineNumber++;
+        if( line[0] == '#' || line[0] == '\n' || line[0] == '\r' || line[0] == 0 )
+            continue;
+
+        char *ptr = strchr( line, ',' );
+        if( ptr == NULL )
+        {
+            fprintf( stderr, "%s:%u: no fields\n", argv[1], lineNumber );
+            continue;
+        }
+        const std::string name( line, ptr );
+        ptr++;
+
+        osgEphemeris::StarCatalogRecord record;
+        if( !parseField( ptr, record.rightAscension ) ||
+            !parseField( ptr, record.declination ) ||
+            !parseField( ptr, record.magnitude ))
+        {
+            fprintf( stderr, "%s:%u: expected right ascension, declination and magnitude\n",
+                     argv[1], lineNumber );
+            continue;
+        }
+        if( !parseField( ptr, record.colorIndex ))
+            record.colorIndex = 0.0f;
+
+        records.push_back( record );
+        names.push_back( name );
+    }
+    fclose( fp );
+
+    if( !osgEphemeris::StarCatalog::write( argv[2], records, names ))
+        return 1;
+
+    printf( "%s: %u stars\n", argv[2], (unsigned int)records.size() );
+    return 0;
+}
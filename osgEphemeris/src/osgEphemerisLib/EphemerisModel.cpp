@@ -50,6 +50,9 @@ EphemerisModel::EphemerisModel():
     _moonLightNum(1),
     _skyDomeUseSouthernHemisphere(true),
     _skyDomeMirrorSouthernHemisphere( true ),
+    _skyDomeInstanceSouthernHemisphere( false ),
+    _reflectionMode(FullReflection),
+    _reflectionStarMagnitudeLimit(2.0),
     _sunFudgeScale(1.0),
     _moonFudgeScale(1.0)
 {
@@ -248,7 +251,8 @@ void EphemerisModel::_createMoonLightSource()
 
 void EphemerisModel::_createSkyDome()
 {
-    _skyDome = new SkyDome( _skyDomeUseSouthernHemisphere, _skyDomeMirrorSouthernHemisphere );
+    _skyDome = new SkyDome( _skyDomeUseSouthernHemisphere, _skyDomeMirrorSouthernHemisphere,
+                            _skyDomeInstanceSouthernHemisphere );
 }
 
 void EphemerisModel::_createGroundPlane()
@@ -274,18 +278,81 @@ void EphemerisModel::_createStarField()
 
 void EphemerisModel::_makeConnections()
 {
+    _skyTx->removeChild( _memberGroup.get() );
+    _skyTx->removeChild( _clipNodeBottom.get() );
+    _skyTx->removeChild( _clipNodeTop.get() );
+
     if(_members & GROUND_PLANE)
     {
-        _skyTx->removeChild( _clipNodeTop.get() );
-        _skyTx->removeChild( _clipNodeBottom.get() );
         _skyTx->addChild( _memberGroup.get() );
+        return;
     }
-    else
+
+    _clipReverseTx->removeChildren( 0, _clipReverseTx->getNumChildren() );
+    switch( _reflectionMode )
+    {
+        case FullReflection:
+            _clipReverseTx->addChild( _memberGroup.get() );
+            _skyTx->addChild( _clipNodeBottom.get() );
+            break;
+
+        case ReducedReflection:
+            if( !_reflectionGroup.valid() )
+                _createReflectionGroup();
+            _clipReverseTx->addChild( _reflectionGroup.get() );
+            _skyTx->addChild( _clipNodeBottom.get() );
+            break;
+
+        case NoReflection:
+            break;
+    }
+    _skyTx->addChild( _clipNodeTop.get() );
+}
+
+void EphemerisModel::_createReflectionGroup()
+{
+    _reflectionGroup = new osg::Group;
+
+    // The reflected moon shares the moon's state, so the phase follows the moon
+    if( _moon.valid() )
     {
-        _skyTx->removeChild( _memberGroup.get() );
-        _skyTx->addChild( _clipNodeBottom.get() );
-        _skyTx->addChild( _clipNodeTop.get() );
+        osg::ref_ptr<Sphere> moon = new Sphere( MoonModel::getMoonRadius(), Sphere::TessLow );
+        moon->setStateSet( _moon->getStateSet() );
+
+        _reflectionMoonTx = new osg::MatrixTransform;
+        if( _moonTx.valid() )
+            _reflectionMoonTx->setMatrix( _moonTx->getMatrix() );
+        _reflectionMoonTx->addChild( moon.get() );
+        _reflectionGroup->addChild( _reflectionMoonTx.get() );
     }
+
+    if( _starField.valid() )
+    {
+        _reflectionStarFieldTx = new osg::MatrixTransform;
+        if( _starFieldTx.valid() )
+            _reflectionStarFieldTx->setMatrix( _starFieldTx->getMatrix() );
+        _reflectionStarFieldTx->addChild( _starField->createBrightStarGeode( _reflectionStarMagnitudeLimit ));
+        _reflectionGroup->addChild( _reflectionStarFieldTx.get() );
+    }
+}
+
+void EphemerisModel::setReflectionMode( ReflectionMode mode )
+{
+    _reflectionMode = mode;
+    if( _inited )
+        _makeConnections();
+}
+
+void EphemerisModel::setReflectionStarMagnitudeLimit( double magnitude )
+{
+    _reflectionStarMagnitudeLimit = magnitude;
+
+    // Rebuilt with the new limit when next needed
+    _reflectionGroup = 0L;
+    _reflectionMoonTx = 0L;
+    _reflectionStarFieldTx = 0L;
+    if( _inited )
+        _makeConnections();
 }
 
 void EphemerisModel::setSunLightNum( unsigned int lightNum )
@@ -481,6 +548,8 @@ void EphemerisModel::_updateStars()
         osg::Matrix::rotate( -osg::DegreesToRadians((90.0 - _ephemerisData->latitude)), osg::Vec3(1, 0, 0))
         );
     }
+    if( _reflectionStarFieldTx.valid() && _starFieldTx.valid() )
+        _reflectionStarFieldTx->setMatrix( _starFieldTx->getMatrix() );
 }
 
 void EphemerisModel::_updateMoon()
@@ -493,6 +562,8 @@ void EphemerisModel::_updateMoon()
 
     if( _moonTx.valid() )
         _moonTx->setMatrix( mat );
+    if( _reflectionMoonTx.valid() )
+        _reflectionMoonTx->setMatrix( mat );
 
     // Phase of the moon
     osg::Matrix mati;
@@ -0,0 +1,154 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#ifndef OSG_EPHEMERIS_FAST_MATH_DEF
+#define OSG_EPHEMERIS_FAST_MATH_DEF
+
+#include <string.h>
+
+#include <osgEphemeris/IntTypes.h>
+
+namespace osgEphemeris {
+
+// Polynomial approximations of the math functions used by the sky models.
+// Unlike the C library functions they are inlined, never touch errno and 
+// have no branches, so that the compiler can vectorize the loops that call
+// them.  Each is good to a few parts in ten million over its domain.
+
+inline float fastAsFloat( int32_t i )
+{
+    float f;
+    memcpy( &f, &i, sizeof(f) );
+    return f;
+}
+
+inline int32_t fastAsInt( float f )
+{
+    int32_t i;
+    memcpy( &i, &f, sizeof(i) );
+    return i;
+}
+
+// condition ? a : b, with integer masks.  GCC will not turn a floating
+// point ?: into a select when either side may trap, and so leaves a branch.
+inline float fastSelect( bool condition, float a, float b )
+{
+    const int32_t mask = -int32_t(condition);
+    return fastAsFloat( (fastAsInt( a ) & mask) | (fastAsInt( b ) & ~mask) );
+}
+
+inline float fastMin( float a, float b ) { return fastSelect( a < b, a, b ); }
+inline float fastMax( float a, float b ) { return fastSelect( a > b, a, b ); }
+
+// Square root of x >= 0, from a reciprocal square root estimate refined by
+// Newton's method.  fastSqrt(0) is 0.
+inline float fastSqrt( float x )
+{
+    float y = fastAsFloat( 0x5f3759df - (fastAsInt( x ) >> 1) );
+    y = y * (1.5f - 0.5f * x * y * y);
+    y = y * (1.5f - 0.5f * x * y * y);
+    y = y * (1.5f - 0.5f * x * y * y);
+    return x * y;
+}
+
+// 2^x, with x clamped to the range of normal floats.  After Cephes exp2f.
+inline float fastExp2( float x )
+{
+    x = fastMax( fastMin( x, 127.0f ), -126.0f );
+
+    // x = n + f, with n the nearest integer and |f| <= 0.5
+    const float t = x + 0.5f;
+    int32_t n = int32_t(t);
+    n -= t < float(n) ? 1 : 0;
+    const float f = x - float(n);
+
+    float p = 1.535336188319500e-4f;
+    p = p * f + 1.339887440266574e-3f;
+    p = p * f + 9.618437357674640e-3f;
+    p = p * f + 5.550332471162809e-2f;
+    p = p * f + 2.402264791363012e-1f;
+    p = p * f + 6.931472028550421e-1f;
+    p = p * f + 1.0f;
+
+    return p * fastAsFloat( (n + 127) << 23 );
+}
+
+// e^x
+inline float fastExp( float x )
+{
+    return fastExp2( x * 1.44269504f );
+}
+
+// log2(x) for x > 0.  Zero and denormals give -127.  After Cephes logf.
+inline float fastLog2( float x )
+{
+    const int32_t bits = fastAsInt( x );
+    float e = float(((bits >> 23) & 0xff) - 127);
+    float m = fastAsFloat( (bits & 0x007fffff) | 0x3f800000 );
+
+    // m in [sqrt(1/2), sqrt(2))
+    const bool high = m > 1.41421356f;
+    m = fastSelect( high, m * 0.5f, m );
+    e = fastSelect( high, e + 1.0f, e );
+
+    const float z = m - 1.0f;
+    float p = 7.0376836292e-2f;
+    p = p * z - 1.1514610310e-1f;
+    p = p * z + 1.1676998740e-1f;
+    p = p * z - 1.2420140846e-1f;
+    p = p * z + 1.4249322787e-1f;
+    p = p * z - 1.6668057665e-1f;
+    p = p * z + 2.0000714765e-1f;
+    p = p * z - 2.4999993993e-1f;
+    p = p * z + 3.3333331174e-1f;
+    const float z2 = z * z;
+    const float ln = z + z2 * z * p - 0.5f * z2;
+
+    return ln * 1.44269504f + e;
+}
+
+// x^y for x >= 0 and y > 0
+inline float fastPow( float x, float y )
+{
+    return fastSelect( x > 0.0f, fastExp2( y * fastLog2( x )), 0.0f );
+}
+
+// acos(x) for x in [-1,1].  Abramowitz and Stegun 4.4.46.
+inline float fastAcos( float x )
+{
+    const float a = fastMin( fastSelect( x < 0.0f, -x, x ), 1.0f );
+
+    float p = -0.0012624911f;
+    p = p * a + 0.0066700901f;
+    p = p * a - 0.0170881256f;
+    p = p * a + 0.0308918810f;
+    p = p * a - 0.0501743046f;
+    p = p * a + 0.0889789874f;
+    p = p * a - 0.2145988016f;
+    p = p * a + 1.5707963050f;
+
+    const float r = fastSqrt( 1.0f - a ) * p;
+    return fastSelect( x < 0.0f, 3.14159265f - r, r );
+}
+
+}
+
+#endif
@@ -0,0 +1,370 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <map>
+#include <string.h>
+#include <osg/Texture2D>
+#include <osg/BlendFunc>
+#include <osg/Depth>
+#include <osgText/Font>
+#include <osgUtil/CullVisitor>
+#include <OpenThreads/ScopedLock>
+
+#include <osgEphemeris/LabelBatch.h>
+
+using namespace osgEphemeris;
+
+const std::string LabelBatch::_defaultFontName = "fonts/arial.ttf";
+
+class LabelBatch::GlyphAtlas : public osg::Referenced
+{
+    public:
+        struct Glyph {
+            bool valid;
+            // Texture coordinates of the lower left and upper right corners
+            osg::Vec2 texMin, texMax;
+            // Size, offset of the lower left corner from the pen position
+            // and advance of the pen, in pixels of the font resolution
+            osg::Vec2 size;
+            osg::Vec2 bearing;
+            float advance;
+        };
+
+        enum {
+            FirstCharacter = 32,
+            LastCharacter  = 126,
+            Resolution     = 64,
+            Width          = 512
+        };
+
+        GlyphAtlas( const std::string &fontName );
+
+        const Glyph &getGlyph( unsigned char c ) const
+        {
+            return (c >= FirstCharacter && c <= LastCharacter) ? _glyphs[c - FirstCharacter] : _glyphs[0];
+        }
+
+        osg::Texture2D *getTexture() { return _texture.get(); }
+
+        // The atlas for fontName, shared by every LabelBatch using it
+        static GlyphAtlas *get( const std::string &fontName );
+
+    private:
+        Glyph _glyphs[LastCharacter - FirstCharacter + 1];
+        osg::ref_ptr<osg::Texture2D> _texture;
+};
+
+LabelBatch::GlyphAtlas::GlyphAtlas( const std::string &fontName )
+{
+    for( unsigned int c = FirstCharacter; c <= LastCharacter; c++ )
+        _glyphs[c - FirstCharacter].valid = false;
+
+    _texture = new osg::Texture2D;
+    _texture->setFilter( osg::Texture::MIN_FILTER, osg::Texture::LINEAR );
+    _texture->setFilter( osg::Texture::MAG_FILTER, osg::Texture::LINEAR );
+    _texture->setWrap( osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE );
+    _texture->setWrap( osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE );
+
+    osg::ref_ptr<osgText::Font> font = osgText::readFontFile( fontName );
+    if( !font.valid() )
+    {
+        std::cerr << "LabelBatch... unable to load font \"" << fontName << "\"" << std::endl;
+        return;
+    }
+
+    // Pack the glyphs in rows, with a pixel between them so that filtering
+    // does not bleed from one to the next
+    std::vector< osg::ref_ptr<osgText::Glyph> > glyphs( LastCharacter - FirstCharacter + 1 );
+    std::vector<osg::Vec2> origins( glyphs.size() );
+    int x = 1, y = 1, rowHeight = 0;
+    for( unsigned int c = FirstCharacter; c <= LastCharacter; c++ )
+    {
+        osgText::Glyph *glyph = font->getGlyph( osgText::FontResolution( Resolution, Resolution ), c );
+        if( glyph == 0L )
+            continue;
+        glyphs[c - FirstCharacter] = glyph;
+
+        if( x + glyph->s() + 1 > Width )
+        {
+            x = 1;
+            y += rowHeight + 1;
+            rowHeight = 0;
+        }
+        origins[c - FirstCharacter].set( x, y );
+        x += glyph->s() + 1;
+        if( glyph->t() > rowHeight )
+            rowHeight = glyph->t();
+    }
+
+    int height = 1;
+    while( height < y + rowHeight + 1 )
+        height <<= 1;
+
+    osg::ref_ptr<osg::Image> image = new osg::Image;
+    image->allocateImage( Width, height, 1, GL_ALPHA, GL_UNSIGNED_BYTE );
+    memset( image->data(), 0, image->getImageSizeInBytes() );
+
+    for( unsigned int i = 0; i < glyphs.size(); i++ )
+    {
+        osgText::Glyph *glyph = glyphs[i].get();
+        if( glyph == 0L )
+            continue;
+
+        const int gx = int(origins[i].x());
+        const int gy = int(origins[i].y());
+        if( glyph->getPixelFormat() == GL_ALPHA && glyph->getDataType() == GL_UNSIGNED_BYTE )
+        {
+            for( int row = 0; row < glyph->t(); row++ )
+                memcpy( image->data( gx, gy + row ), glyph->data( 0, row ), glyph->s() );
+        }
+
+        Glyph &g = _glyphs[i];
+        g.valid   = true;
+        g.texMin.set( float(gx) / Width, float(gy) / height );
+        g.texMax.set( float(gx + glyph->s()) / Width, float(gy + glyph->t()) / height );
+        g.size.set( glyph->s(), glyph->t() );
+        g.bearing = glyph->getHorizontalBearing();
+        g.advance = glyph->getHorizontalAdvance();
+    }
+
+    _texture->setImage( image.get() );
+}
+
+LabelBatch::GlyphAtlas *LabelBatch::GlyphAtlas::get( const std::string &fontName )
+{
+    typedef std::map< std::string, osg::ref_ptr<GlyphAtlas> > AtlasMap;
+    static OpenThreads::Mutex mutex;
+    // Never deleted, so that no atlas texture is released during static
+    // destruction after OSG's GL object managers are gone
+    static AtlasMap *atlases = 0L;
+
+    OpenThreads::ScopedLock<OpenThreads::Mutex> lock( mutex );
+    if( atlases == 0L )
+        atlases = new AtlasMap;
+    osg::ref_ptr<GlyphAtlas> &atlas = (*atlases)[fontName];
+    if( !atlas.valid() )
+        atlas = new GlyphAtlas( fontName );
+    return atlas.get();
+}
+
+std::string LabelBatch::_vertexShaderProgram = 
+    "uniform vec2 viewportSize;"
+    "varying vec2 uv;"
+    "void main()"
+    "{"
+    "    vec4 clip = gl_ModelViewProjectionMatrix * gl_Vertex;"
+    // Offset each corner from its anchor in pixels, and push labels whose
+    // anchor is behind the eye out of the clip volume
+    "    if( clip.w > 0.0 )"
+    "        clip.xy += gl_MultiTexCoord1.xy * 2.0 / viewportSize * clip.w;"
+    "    else"
+    "        clip = vec4( 0.0, 0.0, -2.0, 1.0 );"
+    "    gl_Position = clip;"
+    "    gl_FrontColor = gl_Color;"
+    "    uv = gl_MultiTexCoord0.st;"
+    "}";
+
+std::string LabelBatch::_fragmentShaderProgram = 
+    "uniform sampler2D glyphs;"
+    "varying vec2 uv;"
+    "void main( void )"
+    "{"
+    "    gl_FragColor = vec4( gl_Color.rgb, gl_Color.a * texture2D( glyphs, uv ).a );"
+    "}";
+
+LabelBatch::LabelBatch( const std::string &fontName ):
+    _atlas(GlyphAtlas::get( fontName ))
+{
+    _anchors   = new osg::Vec3Array;
+    _texCoords = new osg::Vec2Array;
+    _offsets   = new osg::Vec2Array;
+    _colors    = new osg::Vec4Array;
+    _quads     = new osg::DrawArrays( osg::PrimitiveSet::QUADS, 0, 0 );
+
+    _geometry = new osg::Geometry;
+    _geometry->setVertexArray( _anchors.get() );
+    _geometry->setTexCoordArray( 0, _texCoords.get() );
+    _geometry->setTexCoordArray( 1, _offsets.get() );
+    _geometry->setColorArray( _colors.get() );
+    _geometry->setColorBinding( osg::Geometry::BIND_PER_VERTEX );
+    _geometry->addPrimitiveSet( _quads.get() );
+
+    // Anchors are moved every frame by setLabelPosition(), so the geometry
+    // is drawn from vertex buffer objects that are updated in place, rather
+    // than from a display list that would be recompiled each time
+    _geometry->setDataVariance( osg::Object::DYNAMIC );
+    _geometry->setUseDisplayList( false );
+    _geometry->setUseVertexBufferObjects( true );
+
+    osg::ref_ptr<osg::Geode> geode = new osg::Geode;
+    geode->addDrawable( _geometry.get() );
+    addChild( geode.get() );
+
+    _buildStateSet();
+}
+
+LabelBatch::~LabelBatch()
+{
+}
+
+void LabelBatch::_buildStateSet()
+{
+    osg::ref_ptr<osg::StateSet> sset = new osg::StateSet;
+
+    osg::ref_ptr<osg::Program> program = new osg::Program;
+    program->addShader( new osg::Shader(osg::Shader::VERTEX, _vertexShaderProgram ));
+    program->addShader( new osg::Shader(osg::Shader::FRAGMENT, _fragmentShaderProgram ));
+    sset->setAttributeAndModes( program.get(), osg::StateAttribute::ON );
+
+    sset->setTextureAttributeAndModes( 0, _atlas->getTexture() );
+    sset->addUniform( new osg::Uniform( "glyphs", 0 ));
+
+    sset->setMode( GL_LIGHTING, osg::StateAttribute::OFF );
+    sset->setMode( GL_CULL_FACE, osg::StateAttribute::OFF );
+    sset->setAttributeAndModes( new osg::BlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA ));
+    sset->setAttributeAndModes( new osg::Depth( osg::Depth::LESS, 0.0, 1.0, false ));
+    sset->setRenderingHint( osg::StateSet::TRANSPARENT_BIN );
+
+    setStateSet( sset.get() );
+}
+
+unsigned int LabelBatch::addLabel( const std::string &text, const osg::Vec3 &position,
+                                   float characterSize, const osg::Vec4 &color )
+{
+    Label label;
+    label.firstVertex = _anchors->size();
+
+    const float scale = characterSize / GlyphAtlas::Resolution;
+    float pen = 0.0f;
+    for( std::string::const_iterator p = text.begin(); p != text.end(); p++ )
+    {
+        const GlyphAtlas::Glyph &glyph = _atlas->getGlyph( (unsigned char)*p );
+        if( !glyph.valid )
+            continue;
+
+        const float x0 = (pen + glyph.bearing.x()) * scale;
+        const float y0 = glyph.bearing.y() * scale;
+        const float x1 = x0 + glyph.size.x() * scale;
+        const float y1 = y0 + glyph.size.y() * scale;
+        pen += glyph.advance;
+
+        _offsets->push_back( osg::Vec2( x0, y0 ));
+        _offsets->push_back( osg::Vec2( x1, y0 ));
+        _offsets->push_back( osg::Vec2( x1, y1 ));
+        _offsets->push_back( osg::Vec2( x0, y1 ));
+
+        _texCoords->push_back( osg::Vec2( glyph.texMin.x(), glyph.texMin.y() ));
+        _texCoords->push_back( osg::Vec2( glyph.texMax.x(), glyph.texMin.y() ));
+        _texCoords->push_back( osg::Vec2( glyph.texMax.x(), glyph.texMax.y() ));
+        _texCoords->push_back( osg::Vec2( glyph.texMin.x(), glyph.texMax.y() ));
+
+        for( unsigned int i = 0; i < 4; i++ )
+        {
+            _anchors->push_back( position );
+            _colors->push_back( color );
+        }
+    }
+
+    label.numVertices = _anchors->size() - label.firstVertex;
+    _labels.push_back( label );
+
+    _quads->setCount( _anchors->size() );
+    _quads->dirty();
+    _anchors->dirty();
+    _texCoords->dirty();
+    _offsets->dirty();
+    _colors->dirty();
+    _geometry->dirtyBound();
+
+    return _labels.size() - 1;
+}
+
+void LabelBatch::setLabelPosition( unsigned int label, const osg::Vec3 &position )
+{
+    if( label >= _labels.size() )
+        return;
+
+    const Label &l = _labels[label];
+    for( unsigned int i = l.firstVertex; i < l.firstVertex + l.numVertices; i++ )
+        (*_anchors)[i] = position;
+
+    _anchors->dirty();
+    _geometry->dirtyBound();
+}
+
+void LabelBatch::traverse( osg::NodeVisitor &nv )
+{
+    osgUtil::CullVisitor *cv = dynamic_cast<osgUtil::CullVisitor *>(&nv);
+    if( cv == 0L || cv->getViewport() == 0L )
+    {
+        osg::Group::traverse( nv );
+        return;
+    }
+
+    // The shader needs the size of the viewport to place the glyphs in pixels
+    const osg::Vec2 size( cv->getViewport()->width(), cv->getViewport()->height() );
+    osg::Camera *camera = cv->getCurrentCamera();
+    osg::ref_ptr<osg::StateSet> sset;
+    {
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _cameraStateSetsMutex );
+
+        unsigned int n = 0;
+        CameraStateSet *css = 0L;
+        for( unsigned int i = 0; i < _cameraStateSets.size(); i++ )
+        {
+            if( !_cameraStateSets[i].camera.valid() )
+                continue;
+            _cameraStateSets[n] = _cameraStateSets[i];
+            if( _cameraStateSets[n].camera.get() == camera )
+                css = &_cameraStateSets[n];
+            n++;
+        }
+        _cameraStateSets.resize( n );
+
+        if( css == 0L )
+        {
+            CameraStateSet entry;
+            entry.camera = camera;
+            entry.viewportSize = new osg::Uniform( "viewportSize", size );
+            entry.viewportSize->setDataVariance( osg::Object::DYNAMIC );
+            entry.stateSet = new osg::StateSet;
+            entry.stateSet->setDataVariance( osg::Object::DYNAMIC );
+            entry.stateSet->addUniform( entry.viewportSize.get() );
+            sset = entry.stateSet;
+            if( camera != 0L )
+                _cameraStateSets.push_back( entry );
+        }
+        else
+        {
+            // Only changes when the window is resized
+            osg::Vec2 current;
+            css->viewportSize->get( current );
+            if( current != size )
+                css->viewportSize->set( size );
+            sset = css->stateSet;
+        }
+    }
+
+    cv->pushStateSet( sset.get() );
+    osg::Group::traverse( nv );
+    cv->popStateSet();
+}
@@ -0,0 +1,88 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include <fcntl.h>
+#include <sys/types.h>
+
+#include "MappedFile.h"
+
+bool osgEphemeris::mapFile( const std::string &fileName, size_t minLength, void *&start, size_t &length )
+{
+#ifdef _WIN32
+    HANDLE hFile = CreateFile( fileName.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                               0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0 );
+    if( hFile == INVALID_HANDLE_VALUE )
+        return false;
+
+    DWORD size = GetFileSize( hFile, 0 );
+    HANDLE hFileMap = 0;
+    if( size != INVALID_FILE_SIZE && size >= minLength )
+        hFileMap = CreateFileMapping( hFile, NULL, PAGE_READONLY, 0, 0, NULL );
+    CloseHandle( hFile );
+    if( hFileMap == 0 )
+        return false;
+
+    start = MapViewOfFile( hFileMap, FILE_MAP_READ, 0, 0, 0 );
+    CloseHandle( hFileMap );
+    if( start == 0L )
+        return false;
+    length = size;
+#else
+    int fd;
+    if( (fd = open( fileName.c_str(), O_RDONLY )) < 0 )
+        return false;
+
+    struct stat st;
+    if( fstat( fd, &st ) < 0 || size_t(st.st_size) < minLength )
+    {
+        close( fd );
+        return false;
+    }
+
+    void *s = mmap( 0L, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if( s == MAP_FAILED )
+        return false;
+    start = s;
+    length = st.st_size;
+#endif
+    return true;
+}
+
+void osgEphemeris::unmapFile( void *start, size_t length )
+{
+    if( start == 0L )
+        return;
+#ifdef _WIN32
+    (void)length;
+    UnmapViewOfFile( start );
+#else
+    munmap( start, length );
+#endif
+}
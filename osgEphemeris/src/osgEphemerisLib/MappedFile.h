@@ -0,0 +1,38 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#ifndef OSG_EPHEMERIS_MAPPED_FILE_DEF
+#define OSG_EPHEMERIS_MAPPED_FILE_DEF
+
+#include <string>
+#include <stddef.h>
+
+namespace osgEphemeris {
+
+// Map fileName read only.  Fails if the file can not be mapped or is shorter
+// than minLength.
+bool mapFile( const std::string &fileName, size_t minLength, void *&start, size_t &length );
+
+void unmapFile( void *start, size_t length );
+
+}
+
+#endif
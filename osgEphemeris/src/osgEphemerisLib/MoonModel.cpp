@@ -19,17 +19,23 @@
  -------------------------------------------------------------------------------
  */
 
+#include <algorithm>
 #include <iostream>
 #include <osgDB/ReadFile>
 #include <osgDB/FileUtils>
 #include <osg/StateSet>
 #include <osg/Texture2D>
+#include <osgUtil/CullVisitor>
+#include <OpenThreads/ScopedLock>
 
 #include <osgEphemeris/MoonModel.h>
+#include <osgEphemeris/ResourcePack.h>
 
 using namespace osgEphemeris;
 
 const double MoonModel::_moonRadius = 3476000.0 * 0.5; // Diameter of moon * 0.5 = moon radius;
+const unsigned int MoonModel::_minTextureLevelWidth = 64;
+const float MoonModel::_textureLevelHysteresis = 1.25f;
 
 MoonModel::MoonModel():
     Sphere( _moonRadius,
@@ -85,6 +91,213 @@ std::string MoonModel::_fragmentShaderProgram =
     "    gl_FragColor = vec4(vec3(diffuse) * decalColor, 1.0);"
     "}";
 
+// An image of one mipmap level of image and the levels below it, sharing
+// its pixels.
+static osg::Image *mipmapImage( osg::Image *image, unsigned int level )
+{
+    if( level == 0 )
+        return image;
+
+    osg::Image *out = new osg::Image;
+    out->setImage( std::max( image->s() >> level, 1 ),
+                   std::max( image->t() >> level, 1 ), 1,
+                   image->getInternalTextureFormat(),
+                   image->getPixelFormat(),
+                   image->getDataType(),
+                   image->getMipmapData( level ),
+                   osg::Image::NO_DELETE,
+                   image->getPacking() );
+
+    const osg::Image::MipmapDataType &mipmaps = image->getMipmapLevels();
+    osg::Image::MipmapDataType below;
+    for( unsigned int i = level; i < mipmaps.size(); i++ )
+        below.push_back( mipmaps[i] - mipmaps[level-1] );
+    out->setMipmapLevels( below );
+
+    out->setUserData( image );
+    return out;
+}
+
+static osg::Texture2D *makeTexture( osg::Image *image )
+{
+    osg::Texture2D *texture = new osg::Texture2D;
+    texture->setWrap( osg::Texture::WRAP_S, osg::Texture::REPEAT );
+    texture->setWrap( osg::Texture::WRAP_T, osg::Texture::REPEAT );
+    texture->setFilter( osg::Texture::MAG_FILTER, osg::Texture::LINEAR);
+    texture->setFilter( osg::Texture::MIN_FILTER, osg::Texture::LINEAR_MIPMAP_LINEAR );
+    texture->setImage( image );
+    return texture;
+}
+
+// Build the pyramid of texture levels, from the mipmaps of the resource pack
+// images or else from the two levels compiled into the library.  No texture
+// is made here; each level's pixels are only touched once it is drawn.
+void MoonModel::_buildTextureLevels()
+{
+    _textureLevels.clear();
+
+    osg::ref_ptr<osg::Image> base, bump;
+    ResourcePack *pack = ResourcePack::getDefault();
+    if( pack != 0L )
+    {
+        base = pack->readImage( "moon" );
+        bump = pack->readImage( "moonNormal" );
+    }
+
+    if( base.valid() && bump.valid() )
+    {
+        for( unsigned int level = 0; level < base->getNumMipmapLevels() && level < bump->getNumMipmapLevels(); level++ )
+        {
+            const unsigned int width = base->s() >> level;
+            if( level > 0 && width < _minTextureLevelWidth )
+                break;
+
+            TextureLevel t;
+            t.width = width;
+            t.baseImage = mipmapImage( base.get(), level );
+            t.bumpImage = mipmapImage( bump.get(), level );
+            _textureLevels.push_back( t );
+        }
+        return;
+    }
+
+#ifndef OSGEPHEMERIS_NO_EMBEDDED_IMAGES
+    TextureLevel hi;
+    hi.width = _moonImageHiLodWidth;
+    hi.baseImage = new osg::Image;
+    hi.baseImage->setImage( 
+            _moonImageHiLodWidth, 
+            _moonImageHiLodHeight, 1,
+            _moonImageInternalTextureFormat,
+            _moonImagePixelFormat,
+            GL_UNSIGNED_BYTE,
+            _moonImageHiLodData,
+            osg::Image::NO_DELETE );
+    hi.bumpImage = new osg::Image;
+    hi.bumpImage->setImage( 
+            _moonNormalImageHiLodWidth, 
+            _moonNormalImageHiLodHeight, 1,
+            _moonNormalImageInternalTextureFormat,
+            _moonNormalImagePixelFormat,
+            GL_UNSIGNED_BYTE,
+            _moonNormalImageHiLodData,
+            osg::Image::NO_DELETE );
+    _textureLevels.push_back( hi );
+
+    TextureLevel lo;
+    lo.width = _moonImageLoLodWidth;
+    lo.baseImage = new osg::Image;
+    lo.baseImage->setImage( 
+            _moonImageLoLodWidth, 
+            _moonImageLoLodHeight, 1,
+            _moonImageInternalTextureFormat,
+            _moonImagePixelFormat,
+            GL_UNSIGNED_BYTE,
+            _moonImageLoLodData,
+            osg::Image::NO_DELETE );
+    lo.bumpImage = new osg::Image;
+    lo.bumpImage->setImage( 
+            _moonNormalImageLoLodWidth, 
+            _moonNormalImageLoLodHeight, 1,
+            _moonNormalImageInternalTextureFormat,
+            _moonNormalImagePixelFormat,
+            GL_UNSIGNED_BYTE,
+            _moonNormalImageLoLodData,
+            osg::Image::NO_DELETE );
+    _textureLevels.push_back( lo );
+#else
+    std::cerr << "MoonModel: no moon images in the resource pack" << std::endl;
+#endif
+}
+
+// Return the StateSet that binds the textures of level over those of the
+// coarsest level, making it the first time.  Call with _textureLevelsMutex held.
+osg::StateSet *MoonModel::_getTextureLevelStateSet( unsigned int level )
+{
+    if( level + 1 >= _textureLevels.size() )
+        return 0L;
+
+    TextureLevel &t = _textureLevels[level];
+    if( !t.stateSet.valid() )
+    {
+        t.stateSet = new osg::StateSet;
+        t.stateSet->setTextureAttributeAndModes( _baseTextureUnit, makeTexture( t.baseImage.get() ));
+        t.stateSet->setTextureAttributeAndModes( _bumpTextureUnit, makeTexture( t.bumpImage.get() ));
+    }
+    return t.stateSet.get();
+}
+
+// Pick the coarsest level with at least a texel per pixel across the moon,
+// starting from the level last used by camera.  Call with
+// _textureLevelsMutex held.
+unsigned int MoonModel::_selectTextureLevel( osg::Camera *camera, float pixelSize )
+{
+    // The visible half of the moon spans half the width of its texture
+    const float width = 2.0f * pixelSize;
+
+    // Forget cameras that have been deleted, so that a new camera never
+    // inherits the level of an old one
+    unsigned int n = 0;
+    for( unsigned int i = 0; i < _cameraTextureLevels.size(); i++ )
+    {
+        if( _cameraTextureLevels[i].camera.valid() )
+            _cameraTextureLevels[n++] = _cameraTextureLevels[i];
+    }
+    _cameraTextureLevels.resize( n );
+
+    CameraTextureLevel *last = 0L;
+    for( unsigned int i = 0; i < _cameraTextureLevels.size(); i++ )
+    {
+        if( _cameraTextureLevels[i].camera.get() == camera )
+            last = &_cameraTextureLevels[i];
+    }
+    unsigned int level = last != 0L ? last->level : _textureLevels.size() - 1;
+
+    while( level > 0 && _textureLevels[level].width < width )
+        level--;
+
+    // Only go coarser with some margin, so that a moon whose size is near
+    // the width of a level does not switch back and forth
+    while( level + 1 < _textureLevels.size() && _textureLevels[level+1].width >= width * _textureLevelHysteresis )
+        level++;
+
+    if( last != 0L )
+        last->level = level;
+    else if( camera != 0L )
+    {
+        CameraTextureLevel entry;
+        entry.camera = camera;
+        entry.level = level;
+        _cameraTextureLevels.push_back( entry );
+    }
+    return level;
+}
+
+void MoonModel::traverse( osg::NodeVisitor &nv )
+{
+    osgUtil::CullVisitor *cv = dynamic_cast<osgUtil::CullVisitor *>(&nv);
+    if( cv == 0L || _textureLevels.size() < 2 )
+    {
+        Sphere::traverse( nv );
+        return;
+    }
+
+    // pixelSize() is about the diameter of the moon on screen, with the field
+    // of view and the fudge scale of the transform above it taken into account.
+    osg::ref_ptr<osg::StateSet> sset;
+    {
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _textureLevelsMutex );
+        unsigned int level = _selectTextureLevel( cv->getCurrentCamera(), cv->pixelSize( getBound() ));
+        sset = _getTextureLevelStateSet( level );
+    }
+
+    if( sset.valid() )
+        cv->pushStateSet( sset.get() );
+    Sphere::traverse( nv );
+    if( sset.valid() )
+        cv->popStateSet();
+}
+
 void MoonModel::_buildStateSet()
 {
     osg::ref_ptr<osg::StateSet> sset = new osg::StateSet;
@@ -108,46 +321,17 @@ void MoonModel::_buildStateSet()
     sset->setAttributeAndModes( program.get(), osg::StateAttribute::ON );
 
     //osg::ref_ptr<osg::Image> baseImage = osgDB::readImageFile( "moon.jpg" );
-
-    osg::ref_ptr<osg::Image> baseImage = new osg::Image;
-    baseImage->setImage( 
-            _moonImageHiLodWidth, 
-            _moonImageHiLodHeight, 1,
-            _moonImageInternalTextureFormat,
-            _moonImagePixelFormat,
-            GL_UNSIGNED_BYTE,
-            _moonImageHiLodData,
-            osg::Image::NO_DELETE );
-
-
-    osg::ref_ptr<osg::Texture2D> baseTexture = new osg::Texture2D;
-    baseTexture->setWrap( osg::Texture::WRAP_S, osg::Texture::REPEAT );
-    baseTexture->setWrap( osg::Texture::WRAP_T, osg::Texture::REPEAT );
-    baseTexture->setFilter( osg::Texture::MAG_FILTER, osg::Texture::LINEAR);
-    baseTexture->setFilter( osg::Texture::MIN_FILTER, osg::Texture::LINEAR_MIPMAP_LINEAR );
-    baseTexture->setImage( baseImage.get() );
-    sset->setTextureAttributeAndModes( _baseTextureUnit, baseTexture.get() );
-
-
     //osg::ref_ptr<osg::Image> bumpImage = osgDB::readImageFile( "moon_normal.jpg" );
 
-    osg::ref_ptr<osg::Image> bumpImage = new osg::Image;
-    bumpImage->setImage( 
-            _moonNormalImageHiLodWidth, 
-            _moonNormalImageHiLodHeight, 1,
-            _moonNormalImageInternalTextureFormat,
-            _moonNormalImagePixelFormat,
-            GL_UNSIGNED_BYTE,
-            _moonNormalImageHiLodData,
-            osg::Image::NO_DELETE );
-
-    osg::ref_ptr<osg::Texture2D> bumpTexture = new osg::Texture2D;
-    bumpTexture->setWrap( osg::Texture::WRAP_S, osg::Texture::REPEAT );
-    bumpTexture->setWrap( osg::Texture::WRAP_T, osg::Texture::REPEAT );
-    bumpTexture->setFilter( osg::Texture::MAG_FILTER, osg::Texture::LINEAR);
-    bumpTexture->setFilter( osg::Texture::MIN_FILTER, osg::Texture::LINEAR_MIPMAP_LINEAR );
-    bumpTexture->setImage( bumpImage.get());
-    sset->setTextureAttributeAndModes( _bumpTextureUnit, bumpTexture.get() );
+    // The coarsest level is always bound, and finer levels are pushed over
+    // it during cull as the moon grows on screen.
+    _buildTextureLevels();
+    if( !_textureLevels.empty() )
+    {
+        TextureLevel &t = _textureLevels.back();
+        sset->setTextureAttributeAndModes( _baseTextureUnit, makeTexture( t.baseImage.get() ));
+        sset->setTextureAttributeAndModes( _bumpTextureUnit, makeTexture( t.bumpImage.get() ));
+    }
 
     sset->addUniform( new osg::Uniform("baseMap",   _baseTextureUnit ));
     sset->addUniform( new osg::Uniform("normalMap", _bumpTextureUnit ));
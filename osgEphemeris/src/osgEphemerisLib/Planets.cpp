@@ -24,7 +24,6 @@
 #include <osgEphemeris/SkyDome.h>
 #include <osgEphemeris/Sphere.h>
 #include <osgEphemeris/Planets.h>
-#include <osgText/Text>
 #include <osg/Geode>
 #include <osg/Geometry>
 #include <osg/StateSet>
@@ -49,24 +48,10 @@
 
 using namespace osgEphemeris;
 
-static inline osg::ref_ptr<osgText::Text> makeText( const std::string &textString, osg::Vec3 pos )
-{
-    osg::ref_ptr<osgText::Text> text = new osgText::Text;
-    text->setFont( "fonts/arial.ttf" );
-    text->setFontResolution( 252, 252 );
-    text->setAlignment( osgText::Text::LEFT_BOTTOM );
-    text->setAutoRotateToScreen( true );
-    text->setCharacterSizeMode( osgText::Text::SCREEN_COORDS );
-    text->setColor( osg::Vec4( 1, 0, 0, 1 ));
-    text->setText( textString );
-    text->setCharacterSize( 45.0 );
-    text->setPosition( pos );
-    return text;
-}
-
 static inline osg::Group *makeAPlanet( const std::string &name, const std::string imageName="", double radius=0.0)
 {
     osg::Group * group = new osg::Group;
+    group->setName( name );
     osg::ref_ptr<Sphere> sphere;
 
    if( radius > 0.0 )
@@ -76,9 +61,6 @@ static inline osg::Group *makeAPlanet( const std::string &name, const std::strin
 
     group->addChild( sphere.get() );
 
-    osg::Geode *geode =new osg::Geode;
-    geode->addDrawable( makeText( name, osg::Vec3(0,0,0)).get());
-
     if( !imageName.empty() )
     {
         osg::ref_ptr<osg::Image> image = osgDB::readImageFile( imageName );
@@ -89,8 +71,6 @@ static inline osg::Group *makeAPlanet( const std::string &name, const std::strin
             sphere->getOrCreateStateSet()->setTextureAttributeAndModes( 0, tex.get() );
         }
     }
-    group->addChild( geode );
-
     //group->addChild( new Sphere );
 
     return group;
@@ -135,6 +115,13 @@ Planets::Planets()
     _neptuneTx->addChild( makeAPlanet( "Neptune", "SolarSystem/neptune256128.jpg", radius ));
     addChild( _neptuneTx.get() );
 
+    // All the planet names are drawn as one batch, in the order the planets
+    // are updated
+    const char *names[] = { "Mercury", "Venus", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune" };
+    _labels = new LabelBatch;
+    for( unsigned int i = 0; i < sizeof(names)/sizeof(names[0]); i++ )
+        _labels->addLabel( names[i], osg::Vec3(0,0,0), 45.0f, osg::Vec4( 1, 0, 0, 1 ));
+    addChild( _labels.get() );
 
     setCullingActive(false);
 }
@@ -158,6 +145,14 @@ void Planets::update( EphemerisData *ephemData )
     _saturnTx->setMatrix(   makeMatrix(ephemData, CelestialBodyNames::Saturn)); 
     _uranusTx->setMatrix(   makeMatrix(ephemData, CelestialBodyNames::Uranus)); 
     _neptuneTx->setMatrix(  makeMatrix(ephemData, CelestialBodyNames::Neptune)); 
+
+    _labels->setLabelPosition( 0, _mercuryTx->getMatrix().getTrans() );
+    _labels->setLabelPosition( 1, _venusTx->getMatrix().getTrans() );
+    _labels->setLabelPosition( 2, _marsTx->getMatrix().getTrans() );
+    _labels->setLabelPosition( 3, _jupiterTx->getMatrix().getTrans() );
+    _labels->setLabelPosition( 4, _saturnTx->getMatrix().getTrans() );
+    _labels->setLabelPosition( 5, _uranusTx->getMatrix().getTrans() );
+    _labels->setLabelPosition( 6, _neptuneTx->getMatrix().getTrans() );
 }
 
 
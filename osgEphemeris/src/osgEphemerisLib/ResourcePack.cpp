@@ -0,0 +1,271 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#include <osgDB/FileUtils>
+#include <OpenThreads/ScopedLock>
+
+#include <osgEphemeris/ResourcePack.h>
+
+#include "MappedFile.h"
+
+using namespace osgEphemeris;
+
+const uint32_t ResourcePack::Version;
+const char ResourcePack::_magic[8] = { 'O', 'S', 'G', 'E', 'P', 'A', 'C', 'K' };
+
+// Pixels of each image start on this boundary
+static const uint32_t alignment = 16;
+
+// Size in bytes of one mipmap level, as OpenGL will read it.  Zero if the
+// format is unknown.
+static uint64_t levelSize( const ResourcePackImage &entry, unsigned int level )
+{
+    const uint64_t w = std::max( entry.width >> level, 1u );
+    const uint64_t h = std::max( entry.height >> level, 1u );
+
+    switch( entry.internalTextureFormat )
+    {
+        // Compressed in blocks of 4x4 texels
+        case 0x83F0: // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+        case 0x83F1: // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+            return ((w + 3) / 4) * ((h + 3) / 4) * 8;
+        case 0x83F2: // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+        case 0x83F3: // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+            return ((w + 3) / 4) * ((h + 3) / 4) * 16;
+        default:
+            break;
+    }
+
+    // Images are read with a packing of 1
+    const unsigned int bits = osg::Image::computePixelSizeInBits( entry.pixelFormat, entry.dataType );
+    return (w * bits + 7) / 8 * h;
+}
+
+// Check that every mipmap level of an image lies within its pixels, so that
+// a truncated or corrupt pack can not make OpenGL read past the mapping
+static bool validEntry( const ResourcePackImage &entry )
+{
+    if( entry.width == 0 || entry.height == 0 || entry.width > 65536 || entry.height > 65536 )
+        return false;
+
+    uint64_t offset = 0;
+    for( unsigned int level = 0; level <= entry.numMipmaps; level++ )
+    {
+        if( level > 0 )
+        {
+            // Levels follow each other in order
+            if( entry.mipmapOffsets[level-1] < offset )
+                return false;
+            offset = entry.mipmapOffsets[level-1];
+        }
+
+        const uint64_t size = levelSize( entry, level );
+        if( size == 0 || offset + size > entry.size )
+            return false;
+        offset += size;
+    }
+    return true;
+}
+
+ResourcePack::ResourcePack( const std::string &fileName ):
+    _start(0L),
+    _length(0),
+    _header(0L),
+    _images(0L)
+{
+    if( !mapFile( fileName, sizeof(ResourcePackHeader), _start, _length ))
+        return;
+
+    const ResourcePackHeader *header = (const ResourcePackHeader *)_start;
+    if( memcmp( header->magic, _magic, sizeof(_magic) ) != 0 ||
+        header->byteOrder != 0x01020304 ||
+        header->version != Version ||
+        header->entrySize != sizeof(ResourcePackImage) ||
+        (_length - sizeof(ResourcePackHeader)) / sizeof(ResourcePackImage) < header->numImages )
+    {
+        std::cerr << "ResourcePack: \"" << fileName << "\" is not a resource pack of version "
+                  << Version << " for this platform." << std::endl;
+        return;
+    }
+
+    const ResourcePackImage *images = (const ResourcePackImage *)(header + 1);
+    for( unsigned int i = 0; i < header->numImages; i++ )
+    {
+        if( images[i].offset > _length || images[i].size > _length - images[i].offset ||
+            images[i].numMipmaps >= ResourcePackImage::MaxMipmapLevels )
+        {
+            std::cerr << "ResourcePack: \"" << fileName << "\" is truncated or corrupt." << std::endl;
+            return;
+        }
+    }
+
+    _header = header;
+    _images = images;
+}
+
+ResourcePack::~ResourcePack()
+{
+    unmapFile( _start, _length );
+}
+
+osg::Image *ResourcePack::readImage( const std::string &name )
+{
+    if( _header == 0L )
+        return 0L;
+
+    for( unsigned int i = 0; i < _header->numImages; i++ )
+    {
+        const ResourcePackImage &entry = _images[i];
+        if( strncmp( entry.name, name.c_str(), ResourcePackImage::MaxNameLength ) != 0 )
+            continue;
+
+        if( !validEntry( entry ))
+        {
+            std::cerr << "ResourcePack: image \"" << name << "\" is truncated or corrupt." << std::endl;
+            return 0L;
+        }
+
+        osg::Image *image = new osg::Image;
+        image->setImage( entry.width, entry.height, 1,
+                         entry.internalTextureFormat,
+                         entry.pixelFormat,
+                         entry.dataType,
+                         (unsigned char *)_start + entry.offset,
+                         osg::Image::NO_DELETE, 1 );
+
+        if( entry.numMipmaps > 0 )
+        {
+            osg::Image::MipmapDataType mipmaps( entry.mipmapOffsets, entry.mipmapOffsets + entry.numMipmaps );
+            image->setMipmapLevels( mipmaps );
+        }
+
+        // The pixels are only valid while the pack is mapped
+        image->setUserData( this );
+        return image;
+    }
+
+    return 0L;
+}
+
+ResourcePack *ResourcePack::getDefault()
+{
+    static OpenThreads::Mutex mutex;
+    // Holds a reference that is never released, so that the pack outlives
+    // any images of it still referenced during static destruction
+    static ResourcePack *pack = 0L;
+    static bool mapped = false;
+
+    OpenThreads::ScopedLock<OpenThreads::Mutex> lock( mutex );
+    if( !mapped )
+    {
+        mapped = true;
+
+        std::string fileName;
+        const char *env = getenv( "OSGEPHEMERIS_RESOURCE_PACK" );
+        if( env != 0L )
+            fileName = env;
+        else
+            fileName = osgDB::findDataFile( "osgEphemeris.pack" );
+
+        if( !fileName.empty() )
+        {
+            osg::ref_ptr<ResourcePack> candidate = new ResourcePack( fileName );
+            if( candidate->valid() )
+            {
+                pack = candidate.get();
+                pack->ref();
+            }
+        }
+    }
+    return pack;
+}
+
+bool ResourcePack::write( const std::string &fileName,
+                          const std::vector<std::string> &names,
+                          const std::vector< osg::ref_ptr<osg::Image> > &images )
+{
+    const unsigned int n = std::min( names.size(), images.size() );
+
+
+    ResourcePackHeader header;
+    memcpy( header.magic, _magic, sizeof(_magic) );
+    header.byteOrder = 0x01020304;
+    header.version = Version;
+    header.numImages = n;
+    header.entrySize = sizeof(ResourcePackImage);
+
+    std::vector<ResourcePackImage> entries( n );
+    uint32_t offset = sizeof(ResourcePackHeader) + n * sizeof(ResourcePackImage);
+    for( unsigned int i = 0; i < n; i++ )
+    {
+        const osg::Image *image = images[i].get();
+        const osg::Image::MipmapDataType &mipmaps = image->getMipmapLevels();
+        if( names[i].size() >= ResourcePackImage::MaxNameLength || mipmaps.size() >= ResourcePackImage::MaxMipmapLevels )
+        {
+            std::cerr << "ResourcePack: can not store image \"" << names[i] << "\"." << std::endl;
+            return false;
+        }
+
+        ResourcePackImage &entry = entries[i];
+        memset( &entry, 0, sizeof(entry) );
+        strncpy( entry.name, names[i].c_str(), ResourcePackImage::MaxNameLength );
+        entry.width = image->s();
+        entry.height = image->t();
+        entry.internalTextureFormat = image->getInternalTextureFormat();
+        entry.pixelFormat = image->getPixelFormat();
+        entry.dataType = image->getDataType();
+
+        offset = (offset + alignment - 1) / alignment * alignment;
+        entry.offset = offset;
+        entry.size = image->getTotalSizeInBytesIncludingMipmaps();
+        entry.numMipmaps = mipmaps.size();
+        for( unsigned int m = 0; m < mipmaps.size(); m++ )
+            entry.mipmapOffsets[m] = mipmaps[m];
+
+        offset += entry.size;
+    }
+
+    std::ofstream out( fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+    if( !out )
+    {
+        std::cerr << "ResourcePack: unable to open \"" << fileName << "\" for writing." << std::endl;
+        return false;
+    }
+
+    out.write( (const char *)&header, sizeof(header) );
+    if( n > 0 )
+        out.write( (const char *)&entries.front(), n * sizeof(ResourcePackImage) );
+
+    const char zeros[alignment] = { 0 };
+    for( unsigned int i = 0; i < n; i++ )
+    {
+        out.write( zeros, entries[i].offset - (uint32_t)out.tellp() );
+        out.write( (const char *)images[i]->data(), entries[i].size );
+    }
+    return out.good();
+}
@@ -19,116 +19,538 @@
  -------------------------------------------------------------------------------
  */
 
+#include <algorithm>
 #include <iostream>
+#include <list>
+#include <map>
 #include <stdio.h>
+#include <string.h>
+
+#include <OpenThreads/Thread>
+#include <OpenThreads/Barrier>
+#include <OpenThreads/Condition>
+#include <OpenThreads/Mutex>
+#include <OpenThreads/ScopedLock>
+#include <OpenThreads/ReadWriteMutex>
+#include <OpenThreads/ScopedReadWriteLock>
 
 #include <osgDB/ReadFile>
 
 #include <osgUtil/UpdateVisitor>
+#include <osgUtil/CullVisitor>
 
 #include <osg/Version>
+#include <osg/FrameStamp>
+#include <osg/buffered_value>
 #include <osg/StateSet>
+#include <osg/Viewport>
 #include <osg/BlendFunc>
+#include <osg/CullFace>
 #include <osg/Texture2D>
 #include <osg/TexGen>
 #include <osg/TexEnv>
+#include <osg/Timer>
 
 #include <osgEphemeris/SkyDome.h>
+#include <osgEphemeris/ResourcePack.h>
+
+#include "FastMath.h"
 
 
 using namespace osgEphemeris;
 
 const double SkyDome::_meanDistanceToMoon = 384403000.0;
+// Default sky texture size
 #define SKY_DOME_X_SIZE 128
 #define SKY_DOME_Y_SIZE 128
 
-// Looks like somewhere along the way, OSG stopped calling Drawable Callbacks....
-// So we'll do it ourselves.
-class SkyDomeUpdateCallback: public osg::NodeCallback
+// Dimensions of the optional sky color lookup table.  Sun altitudes below
+// SKY_LUT_MIN_ALT degrees give a black sky.
+#define SKY_LUT_ALT_SIZE    48
+#define SKY_LUT_THETA_SIZE  32
+#define SKY_LUT_GAMMA_SIZE  96
+#define SKY_LUT_MIN_ALT    -17.0
+
+// Computes the sky texture in bands for SkyDome::FullFrameUpdate.  The rows are
+// split evenly between the worker threads and the calling thread, which computes
+// the first band itself and then waits at the barrier for the others.
+class SkyDome::SkyTextureThreadPool : public osg::Referenced
 {
     public:
-        SkyDomeUpdateCallback( SkyDome *skyDome ):
-            _skyDome(skyDome)
+        SkyTextureThreadPool( SkyDome *skyDome, unsigned int numThreads ):
+            _skyDome(skyDome),
+            _numThreads(numThreads < 1 ? 1 : numThreads),
+            _startBarrier(_numThreads),
+            _endBarrier(_numThreads),
+            _data(0L),
+            _done(false)
+        {
+            for( unsigned int i = 1; i < _numThreads; i++ )
+            {
+                Worker *worker = new Worker( this, i );
+                _workers.push_back( worker );
+                worker->start();
+            }
+        }
+
+        unsigned int getNumThreads() const { return _numThreads; }
+
+        void compute( unsigned char *data )
+        {
+            _data = data;
+            _startBarrier.block();
+            _computeBand( 0 );
+            _endBarrier.block();
+            _data = 0L;
+        }
+
+    protected:
+        ~SkyTextureThreadPool()
+        {
+            _done = true;
+            _startBarrier.block();
+            for( unsigned int i = 0; i < _workers.size(); i++ )
+            {
+                _workers[i]->join();
+                delete _workers[i];
+            }
+        }
+
+    private:
+        class Worker : public OpenThreads::Thread
+        {
+            public:
+                Worker( SkyTextureThreadPool *pool, unsigned int band ):
+                    _pool(pool), _band(band) {}
+
+                virtual void run()
+                {
+                    for(;;)
+                    {
+                        _pool->_startBarrier.block();
+                        if( _pool->_done )
+                            break;
+                        _pool->_computeBand( _band );
+                        _pool->_endBarrier.block();
+                    }
+                }
+
+            private:
+                SkyTextureThreadPool *_pool;
+                unsigned int _band;
+        };
+
+        void _computeBand( unsigned int band )
+        {
+            const int height = int(_skyDome->_skyTextureHeight);
+            int firstRow = (height * band) / _numThreads;
+            int endRow   = (height * (band + 1)) / _numThreads;
+            _skyDome->_computeSkyRows( _data, firstRow, endRow );
+        }
+
+        SkyDome *_skyDome;
+        unsigned int _numThreads;
+        OpenThreads::Barrier _startBarrier;
+        OpenThreads::Barrier _endBarrier;
+        std::vector<Worker *> _workers;
+        unsigned char *_data;
+        volatile bool _done;
+};
+
+// Uploads only the rows of the sky texture that changed since a context last
+// saw it, with glTexSubImage2D.  Each row remembers the generation in which it
+// was last written, and each context the generation it last uploaded, so a
+// context that misses frames catches up with all of the rows it missed.
+class SkyDome::SkyTextureSubload : public osg::Texture2D::SubloadCallback
+{
+    public:
+        SkyTextureSubload():
+            _generation(1),
+            _frameNumber(0),
+            _frameBytes(0),
+            _totalBytes(0.0)
         {}
 
-        virtual void operator()(osg::Node* node, osg::NodeVisitor* nv)
+        // Held while the image data is written, and while it is uploaded
+        OpenThreads::Mutex &getMutex() { return _mutex; }
+
+        // Call with the mutex held, after writing rows [firstRow, endRow)
+        void dirtyRows( unsigned int height, unsigned int firstRow, unsigned int endRow )
+        {
+            if( _rowGeneration.size() != height )
+            {
+                _rowGeneration.assign( height, 0 );
+                firstRow = 0;
+                endRow = height;
+            }
+            _generation++;
+            for( unsigned int row = firstRow; row < endRow && row < height; row++ )
+                _rowGeneration[row] = _generation;
+        }
+
+        unsigned int getFrameBytes()
+        {
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+            return _frameBytes;
+        }
+
+        double getTotalBytes()
+        {
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+            return _totalBytes;
+        }
+
+        virtual void load( const osg::Texture2D &texture, osg::State &state ) const
+        {
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+            const osg::Image *image = texture.getImage();
+            if( image == 0L )
+                return;
+
+            glPixelStorei( GL_UNPACK_ALIGNMENT, image->getPacking() );
+            glTexImage2D( GL_TEXTURE_2D, 0, GL_RGB, image->s(), image->t(), 0,
+                image->getPixelFormat(), image->getDataType(), image->data() );
+
+            _contextGeneration[state.getContextID()] = _generation;
+            _countBytes( state, image->getTotalSizeInBytes() );
+        }
+
+        virtual void subload( const osg::Texture2D &texture, osg::State &state ) const
+        {
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+            const osg::Image *image = texture.getImage();
+            unsigned int &contextGeneration = _contextGeneration[state.getContextID()];
+            unsigned int bytes = 0;
+
+            if( image != 0L && contextGeneration != _generation )
+            {
+                glPixelStorei( GL_UNPACK_ALIGNMENT, image->getPacking() );
+
+                // Upload each run of rows written since this context's last upload
+                const unsigned int height = _rowGeneration.size();
+                unsigned int row = 0;
+                while( row < height )
+                {
+                    if( _rowGeneration[row] <= contextGeneration )
+                    {
+                        row++;
+                        continue;
+                    }
+
+                    unsigned int end = row + 1;
+                    while( end < height && _rowGeneration[end] > contextGeneration )
+                        end++;
+
+                    glTexSubImage2D( GL_TEXTURE_2D, 0, 0, row, image->s(), end - row,
+                        image->getPixelFormat(), image->getDataType(), image->data( 0, row ) );
+                    bytes += (end - row) * image->getRowSizeInBytes();
+                    row = end;
+                }
+                contextGeneration = _generation;
+            }
+
+            _countBytes( state, bytes );
+        }
+
+    private:
+        // Called every frame by every context, so the count for a new frame
+        // starts at zero even when nothing is uploaded.
+        void _countBytes( osg::State &state, unsigned int bytes ) const
+        {
+            const osg::FrameStamp *fs = state.getFrameStamp();
+            const unsigned int frameNumber = fs != 0L ? fs->getFrameNumber() : 0;
+            if( frameNumber != _frameNumber )
+            {
+                _frameNumber = frameNumber;
+                _frameBytes = 0;
+            }
+            _frameBytes += bytes;
+            _totalBytes += double(bytes);
+        }
+
+        mutable OpenThreads::Mutex _mutex;
+        unsigned int _generation;
+        std::vector<unsigned int> _rowGeneration;
+        mutable osg::buffered_value<unsigned int> _contextGeneration;
+        mutable unsigned int _frameNumber;
+        mutable unsigned int _frameBytes;
+        mutable double _totalBytes;
+};
+
+// A least recently used cache of complete sky textures, keyed by quantized sky
+// state, with a background thread that computes requested skies ahead of time.
+// Prefetched skies are computed from the same lookup table slice that SkyDome
+// would use for their sun altitude, if it uses one.  clear() advances the generation, so that skies computed for
+// an older texture size, mapping or model are discarded.
+class SkyDome::SkyImageCache : public osg::Referenced
+{
+    public:
+        struct Request
+        {
+            SkyImageKey key;
+            osg::ref_ptr<SkyModel> model;
+            unsigned int width;
+            unsigned int height;
+            SkyTexCoordMapping mapping;
+            double azimuth;
+            double altitude;
+            // Empty unless SkyDome uses its lookup table
+            std::vector<float> lookupSlice;
+        };
+
+        SkyImageCache( unsigned int maxImages ):
+            _maxImages(maxImages),
+            _generation(0),
+            _done(false)
+        {
+            _worker = new Worker( this );
+            _worker->start();
+        }
+
+        void setMaxImages( unsigned int maxImages )
+        {
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+            _maxImages = maxImages;
+            _evict();
+        }
+
+        // Copy the sky for key into data, and make it the most recently used
+        bool get( const SkyImageKey &key, unsigned char *data, unsigned int size )
+        {
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+            ImageMap::iterator p = _images.find( key );
+            if( p == _images.end() || p->second.data.size() != size )
+                return false;
+            _lru.splice( _lru.begin(), _lru, p->second.lru );
+            memcpy( data, &p->second.data.front(), size );
+            return true;
+        }
+
+        void put( const SkyImageKey &key, const unsigned char *data, unsigned int size )
         {
-            _callDrawableCallbacks( _skyDome->getNorthernHemisphere(), nv );
-            _callDrawableCallbacks( _skyDome->getSouthernHemisphere(), nv );
-            traverse(node,nv);
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+            _insert( key, data, size );
+        }
+
+        void clear()
+        {
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+            _generation++;
+            _images.clear();
+            _lru.clear();
+            _requests.clear();
+        }
+
+        // Replace any outstanding requests, skipping skies already cached
+        void prefetch( const std::vector<Request> &requests )
+        {
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+            _requests.clear();
+            for( unsigned int i = 0; i < requests.size(); i++ )
+            {
+                if( _images.find( requests[i].key ) == _images.end() )
+                    _requests.push_back( requests[i] );
+            }
+            _condition.signal();
+        }
+
+    protected:
+        ~SkyImageCache()
+        {
+            {
+                OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+                _done = true;
+                _requests.clear();
+                _condition.signal();
+            }
+            _worker->join();
+            delete _worker;
         }
 
     private:
-        SkyDome* _skyDome;
+        class Worker : public OpenThreads::Thread
+        {
+            public:
+                Worker( SkyImageCache *cache ): _cache(cache) {}
+                virtual void run() { _cache->_run(); }
+
+            private:
+                SkyImageCache *_cache;
+        };
+
+        struct Entry
+        {
+            std::vector<unsigned char> data;
+            std::list<SkyImageKey>::iterator lru;
+        };
+        typedef std::map<SkyImageKey, Entry> ImageMap;
+
+        // Call with the mutex held
+        void _insert( const SkyImageKey &key, const unsigned char *data, unsigned int size )
+        {
+            ImageMap::iterator p = _images.find( key );
+            if( p == _images.end() )
+            {
+                _lru.push_front( key );
+                p = _images.insert( ImageMap::value_type( key, Entry() )).first;
+                p->second.lru = _lru.begin();
+            }
+            else
+                _lru.splice( _lru.begin(), _lru, p->second.lru );
+
+            p->second.data.assign( data, data + size );
+            _evict();
+        }
 
-        void _callDrawableCallbacks( osg::Geode *geode, osg::NodeVisitor *nv )
+        // Call with the mutex held
+        void _evict()
         {
-            if( geode != NULL )
+            while( _images.size() > _maxImages )
             {
-                for( unsigned int i= 0; i < geode->getNumDrawables(); i++ )
+                _images.erase( _lru.back() );
+                _lru.pop_back();
+            }
+        }
+
+        void _run()
+        {
+            for(;;)
+            {
+                Request request;
+                unsigned int generation;
                 {
-                    osg::Drawable *dbl = geode->getDrawable(i);
-                    osg::Drawable::UpdateCallback *updateCallback = dbl->getUpdateCallback();
-                    if( updateCallback != NULL )
-                        updateCallback->update( nv, dbl );
+                    OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+                    while( !_done && _requests.empty() )
+                        _condition.wait( &_mutex );
+                    if( _done )
+                        return;
+                    request = _requests.front();
+                    _requests.pop_front();
+                    generation = _generation;
+                    if( _images.find( request.key ) != _images.end() )
+                        continue;
                 }
+
+                std::vector<unsigned char> data( request.width * request.height * 3 );
+                SkyDome::_computeSkyRows( request.model.get(),
+                                          request.lookupSlice.empty() ? 0L : &request.lookupSlice.front(),
+                                          request.width, request.height, request.mapping,
+                                          request.azimuth, request.altitude,
+                                          &data.front(), 0, int(request.height) );
+
+                OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _mutex );
+                if( generation == _generation )
+                    _insert( request.key, &data.front(), data.size() );
             }
         }
 
+        unsigned int _maxImages;
+        ImageMap _images;
+        // Most recently used first
+        std::list<SkyImageKey> _lru;
+        std::list<Request> _requests;
+        unsigned int _generation;
+        bool _done;
+        OpenThreads::Mutex _mutex;
+        OpenThreads::Condition _condition;
+        Worker *_worker;
 };
 
-SkyDome::SkyDome( bool useBothHemispheres, bool mirrorInSouthernHemisphere ):
+SkyDome::SkyDome( bool useBothHemispheres, bool mirrorInSouthernHemisphere, bool instanceSouthernHemisphere ):
     Sphere( _meanDistanceToMoon,
             Sphere::TessHigh,
             Sphere::InnerOrientation,
-            useBothHemispheres ? Sphere::BothHemispheres : Sphere::NorthernHemisphere,
+            (useBothHemispheres && !(mirrorInSouthernHemisphere && instanceSouthernHemisphere)) ?
+                Sphere::BothHemispheres : Sphere::NorthernHemisphere,
             true ),
+    _sunAzimuth(0.0),
+    _sunAltitude(0.0),
     _sunFudgeScale(1.0),
+    _skySunAzimuth(0.0),
+    _skySunAltitude(0.0),
+    _sunPositionThreshold(0.05),
+    _turbidityThreshold(0.01f),
     _skyTextureUnit(0),
     _sunTextureUnit(1),
     _mirrorInSouthernHemisphere( mirrorInSouthernHemisphere ),
-    _T(2.0f),
-    _current_tex_row(0)
+    _skyModel( new WelshSkyModel ),
+    _num_stale_rows(0),
+    _skyRowOrderCursor(0),
+    _skyLightingGeneration(0),
+    _numSkyRowsPendingLighting(0),
+    _skyUpdateFrame(0),
+    _skyUpdateTimeBudget(500.0),
+    _maxSkyRowAge(32),
+    _skyUpdateTime(0.0),
+    _numSkyRowsUpdated(0),
+    _oldestSkyRowAge(0),
+    _meanSkyRowAge(0.0),
+    _skyTextureWidth(SKY_DOME_X_SIZE),
+    _skyTextureHeight(SKY_DOME_Y_SIZE),
+    _skyUpdateMode(IncrementalUpdate),
+    _numSkyUpdateThreads(0),
+    _useSkyLookupTable(false),
+    _sunSectorMask(0),
+    _autoTesselation(false),
+    _autoTesselationPixelSize(64.0),
+    _maxPixelsPerDegree(0.0),
+    _skyMeanLuminance(0.0f),
+    _skyImageCacheSize(0),
+    _skyImageCacheStep(0.1),
+    _numSkyImagePrefetch(4)
 {
-    unsigned int nsectors = _northernHemisphere->getNumDrawables();
-
-    /*_northernHemisphere->*/setUpdateCallback( new SkyDomeUpdateCallback( this ) );
-
-    // This sets up the "state culling" of the projected texture for the sun.  
-    // We want to avoid projecting the sun texture on any other sphere sectors
-    // than where the sun is positioned, thus avoiding the "back projected" 
-    // anomaly that occurs from projected textures.
-    for( unsigned int sector = 0; sector < nsectors; sector++ )
+    // No sky is cached until the cache is enabled
+    _skyImageKey.altitude = _skyImageKey.azimuth = 0;
+    _skyImageKey.turbidity = -1;
+
+    _skyIrradianceSHUniform = new osg::Uniform( osg::Uniform::FLOAT_VEC3, "skyIrradianceSH", 9 );
+    _skyIrradianceSHUniform->setDataVariance( osg::Object::DYNAMIC );
+    for( unsigned int i = 0; i < 9; i++ )
+        _skyIrradianceSHUniform->setElement( i, _skyIrradianceSH[i] );
+    _skyMeanLuminanceUniform = new osg::Uniform( "skyMeanLuminance", _skyMeanLuminance );
+    _skyMeanLuminanceUniform->setDataVariance( osg::Object::DYNAMIC );
+
+    // The sky texture is mirrored in t about the horizon, and the northern sun
+    // texgen projects the sun to its mirrored position in the mirrored geode,
+    // so the instance looks the same as a separate mirrored hemisphere.  The
+    // mirror reverses winding, as with the reflection in EphemerisModel.
+    if( useBothHemispheres && mirrorInSouthernHemisphere && instanceSouthernHemisphere )
     {
-        double div = 360.0/double(nsectors);
-        double margin = 0.25 * div;
-
-        double min = 90.0 - double(sector+1) * div;
-        double max = 90.0 - double(sector+0) * div;
-
-        min -= margin;
-        max += margin;
+        _southernMirrorTransform = new osg::MatrixTransform;
+        _southernMirrorTransform->setMatrix( osg::Matrix::scale( 1.0, 1.0, -1.0 ));
+        _southernMirrorTransform->getOrCreateStateSet()->setAttributeAndModes(
+                new osg::CullFace(osg::CullFace::FRONT), osg::StateAttribute::ON );
+        _southernMirrorTransform->addChild( _northernHemisphere.get() );
+        _radiusTransform->addChild( _southernMirrorTransform.get() );
+    }
 
-        min = _range( min, 360.0 );
-        max = _range( max, 360.0 );
+    _buildStateSet();
+    _markSkyStale();
 
-        osg::Drawable *dbl = _northernHemisphere->getDrawable(sector);
-        dbl->setStateSet( new osg::StateSet );
+}
 
-        dbl->setUpdateCallback( new SectorUpdateCallback( _sunAzimuth, min, max, _sunTextureUnit));
+SkyDome::~SkyDome()
+{
+    // Stop the worker threads before the members they use go away.
+    _skyTextureThreadPool = 0L;
+    _skyImageCache = 0L;
+}
 
-        if( _southernHemisphere.valid () )
-        {
-            dbl = _southernHemisphere->getDrawable(sector);
-            dbl->setStateSet( new osg::StateSet );
-            dbl->setUpdateCallback( new SectorUpdateCallback( _sunAzimuth, min, max, _sunTextureUnit));
-        }
+void SkyDome::setSkyUpdateMode( SkyUpdateMode mode )
+{
+    _skyUpdateMode = mode;
+    if( _skyUpdateMode == IncrementalUpdate )
+    {
+        _skyTextureThreadPool = 0L;
+        _skyBackBuffer.clear();
     }
+}
 
-    _updateDistributionCoefficients();
-
-    _buildStateSet();
-
+void SkyDome::setNumSkyUpdateThreads( unsigned int numThreads )
+{
+    _numSkyUpdateThreads = numThreads;
+    // Rebuilt with the new size on the next full frame update
+    _skyTextureThreadPool = 0L;
 }
 
 // Alpha in radians
@@ -163,43 +585,482 @@ void SkyDome::setSunPos( double azimuth, double altitude )
     _sunAzimuth = azimuth;
     _sunAltitude = altitude;
 
-    _dark_alt = -0.29;
-    _day_exp = 0.2f;
+    _updateSunSectors();
 
-    _light_due_to_alt = osg::DegreesToRadians(altitude);
-    if(_light_due_to_alt < _dark_alt)
-        _light_due_to_alt = 0.0f;
-    else{
-        // remap {_dark_alt, pi} to {-pi, pi}
-        _light_due_to_alt = ((_light_due_to_alt - _dark_alt) / (osg::PI + _dark_alt))
-            * osg::PI_2 - osg::PI;
-        // clamp to -pi
-        _light_due_to_alt = _light_due_to_alt < -osg::PI ? -osg::PI : _light_due_to_alt;
-        // cosine of this new angle remapped to {0, 1}
-        _light_due_to_alt = cosf(_light_due_to_alt) * 0.5f + 0.5f;
-        // brighten it
-        _light_due_to_alt = powf(_light_due_to_alt, _day_exp);
+    // Only recompute the sky when the sun has moved far enough to change it.
+    // The sun texture itself follows _sunAzimuth/_sunAltitude exactly.
+    double dAz = fabs( _range( azimuth - _skySunAzimuth + 180.0, 360.0 ) - 180.0 );
+    double dAlt = fabs( altitude - _skySunAltitude );
+    if( _skyImageCache.valid() )
+    {
+        // The sky is computed for the quantized sun position, so that a cached
+        // sky is exactly the sky that would be computed.
+        const SkyImageKey key = _makeSkyImageKey( azimuth, altitude, _skyModel->getTurbidity() );
+        if( !(key == _skyImageKey) )
+        {
+            {
+                OpenThreads::ScopedWriteLock lock( _skyModelMutex );
+                _skySunAzimuth = double(key.azimuth) * _skyImageCacheStep;
+                _skySunAltitude = double(key.altitude) * _skyImageCacheStep;
+                _skyModel->setSunAltitude( _skySunAltitude );
+            }
+            if( _useSkyLookupTable )
+                _updateSkyLookupSlice();
+
+            _markSkyStale();
+            _prefetchSkyImages( _skyImageKey, key );
+            _skyImageKey = key;
+            _loadCachedSkyImage();
+        }
+    }
+    else if( dAz >= _sunPositionThreshold || dAlt >= _sunPositionThreshold )
+    {
+        {
+            OpenThreads::ScopedWriteLock lock( _skyModelMutex );
+            _skySunAzimuth = azimuth;
+            _skySunAltitude = altitude;
+            _skyModel->setSunAltitude( _skySunAltitude );
+        }
+        if( _useSkyLookupTable )
+            _updateSkyLookupSlice();
+
+        _markSkyStale();
     }
 
     _computeSkyTexture();
 }
 
+// Attach the sun texture to the sector drawables whose azimuth range, plus a
+// margin, contains the sun.  State only changes when the sun crosses into or
+// out of a sector.
+void SkyDome::_updateSunSectors()
+{
+    if( !_sunSectorStateSet.valid() )
+        return;
+
+    const unsigned int nsectors = _northernHemisphere->getNumDrawables();
+    const double div = 360.0/double(nsectors);
+    const double margin = 0.25 * div;
+    const double sun = _range( _sunAzimuth, 360.0 );
+
+    unsigned int mask = 0;
+    for( unsigned int sector = 0; sector < nsectors; sector++ )
+    {
+        const double min = _range( 90.0 - double(sector+1) * div - margin, 360.0 );
+        const double max = _range( 90.0 - double(sector+0) * div + margin, 360.0 );
+        if( _withinDeg( sun, min, max ))
+            mask |= (1u << sector);
+    }
+
+    const unsigned int changed = mask ^ _sunSectorMask;
+    if( changed == 0 )
+        return;
+    _sunSectorMask = mask;
+
+    for( unsigned int sector = 0; sector < nsectors; sector++ )
+    {
+        if( !(changed & (1u << sector)) )
+            continue;
+
+        osg::StateSet *sset = (mask & (1u << sector)) ? _sunSectorStateSet.get() : 0L;
+        _northernHemisphere->getDrawable(sector)->setStateSet( sset );
+        if( _southernHemisphere.valid() )
+            _southernHemisphere->getDrawable(sector)->setStateSet( sset );
+    }
+}
+
+void SkyDome::_markSkyStale()
+{
+    const unsigned int height = _skyTextureHeight;
+    if( _skyRowStale.size() != height )
+    {
+        _skyRowStale.assign( height, false );
+        _skyRowStaleSince.assign( height, _skyUpdateFrame );
+        _skyRowLightingGeneration.assign( height, _skyLightingGeneration - 1 );
+        _numSkyRowsPendingLighting = height;
+    }
+
+    // Rows already out of date keep their age
+    for( unsigned int row = 0; row < height; row++ )
+    {
+        if( !_skyRowStale[row] )
+        {
+            _skyRowStale[row] = true;
+            _skyRowStaleSince[row] = _skyUpdateFrame;
+        }
+    }
+    _num_stale_rows = int(height);
+
+    // Rows nearest the sun or the horizon first, where changes show most
+    std::vector< std::pair<double, unsigned int> > priority( height );
+    for( unsigned int row = 0; row < height; row++ )
+    {
+        const double v = (double(row) + 0.5) / double(height);
+        const double altitude = 90.0 * ( _skyTexCoordMapping == HorizonWeightedAltitude ?
+                                         1.0 - sqrt(v) : (1.0 - v) );
+        const double distance = std::min( fabs( altitude - _skySunAltitude ), altitude );
+        priority[row] = std::make_pair( distance, row );
+    }
+    std::sort( priority.begin(), priority.end() );
+
+    _skyRowOrder.resize( height );
+    for( unsigned int i = 0; i < height; i++ )
+        _skyRowOrder[i] = priority[i].second;
+    _skyRowOrderCursor = 0;
+}
+
+void SkyDome::_setSkyRowsCurrent()
+{
+    _num_stale_rows = 0;
+    _skyRowStale.assign( _skyTextureHeight, false );
+    _skyRowStaleSince.assign( _skyTextureHeight, _skyUpdateFrame );
+    _skyRowOrderCursor = _skyRowOrder.size();
+}
+
+void SkyDome::_updateSkyRow( osg::Image *image, unsigned int row )
+{
+    {
+        // Only the rows written here are uploaded, by SkyTextureSubload
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _skyTextureSubload->getMutex() );
+        _computeSkyRows( image->data(), int(row), int(row) + 1 );
+        _skyTextureSubload->dirtyRows( _skyTextureHeight, row, row + 1 );
+    }
+    _skyRowStale[row] = false;
+    _num_stale_rows--;
+    _numSkyRowsUpdated++;
+
+    if( _skyRowLightingGeneration[row] != _skyLightingGeneration )
+    {
+        _skyRowLightingGeneration[row] = _skyLightingGeneration;
+        _numSkyRowsPendingLighting--;
+    }
+}
+
+void SkyDome::_updateSkyRowAgeStats()
+{
+    unsigned int oldest = 0;
+    double total = 0.0;
+    for( unsigned int row = 0; row < _skyRowStale.size(); row++ )
+    {
+        if( !_skyRowStale[row] )
+            continue;
+        const unsigned int age = _skyUpdateFrame - _skyRowStaleSince[row];
+        if( age > oldest )
+            oldest = age;
+        total += double(age);
+    }
+    _oldestSkyRowAge = oldest;
+    _meanSkyRowAge = _num_stale_rows > 0 ? total / double(_num_stale_rows) : 0.0;
+}
+
+void SkyDome::setSkyTextureSize( unsigned int width, unsigned int height )
+{
+    if( width < 1 )
+        width = 1;
+    if( height < 1 )
+        height = 1;
+    if( width == _skyTextureWidth && height == _skyTextureHeight )
+        return;
+
+    OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _skyTextureSubload->getMutex() );
+    _skyTextureWidth = width;
+    _skyTextureHeight = height;
+    _skyTexture->setImage( _createSkyImage() );
+    _skyTexture->setTextureSize( _skyTextureWidth, _skyTextureHeight );
+    // Release the texture objects of every context, so that each one is
+    // allocated again at the new size by SkyTextureSubload::load() instead of
+    // receiving rows of the new size in the old allocation.
+    _skyTexture->dirtyTextureObject();
+    _skyTextureSubload->dirtyRows( _skyTextureHeight, 0, _skyTextureHeight );
+    _skyBackBuffer.clear();
+    _markSkyStale();
+    _clearSkyImageCache();
+}
+
+void SkyDome::setSkyTextureMapping( SkyTexCoordMapping mapping )
+{
+    if( mapping == _skyTexCoordMapping )
+        return;
+
+    setSkyTexCoordMapping( mapping );
+    _markSkyStale();
+    _clearSkyImageCache();
+}
+
+void SkyDome::setSkyImageCacheSize( unsigned int numImages )
+{
+    _skyImageCacheSize = numImages;
+    if( _skyImageCacheSize == 0 )
+        _skyImageCache = 0L;
+    else if( _skyImageCache.valid() )
+        _skyImageCache->setMaxImages( _skyImageCacheSize );
+    else
+        _skyImageCache = new SkyImageCache( _skyImageCacheSize );
+
+    // The next setSunPos() quantizes the sky state
+    _skyImageKey.turbidity = -1;
+}
+
+void SkyDome::setSkyImageCacheStep( double degrees )
+{
+    if( degrees <= 0.0 || degrees == _skyImageCacheStep )
+        return;
+
+    _skyImageCacheStep = degrees;
+    _skyImageKey.turbidity = -1;
+    if( _skyImageCache.valid() )
+        _skyImageCache->clear();
+}
+
+SkyDome::SkyImageKey SkyDome::_makeSkyImageKey( double azimuth, double altitude, float turbidity ) const
+{
+    const int numAzimuths = int( floor( 360.0/_skyImageCacheStep + 0.5 ));
+
+    SkyImageKey key;
+    key.altitude = int( floor( altitude/_skyImageCacheStep + 0.5 ));
+    key.azimuth = int( floor( _range( azimuth, 360.0 )/_skyImageCacheStep + 0.5 ));
+    if( key.azimuth >= numAzimuths )
+        key.azimuth -= numAzimuths;
+    key.turbidity = int( floorf( turbidity * 10.0f + 0.5f ));
+    return key;
+}
+
+void SkyDome::_clearSkyImageCache()
+{
+    if( _skyImageCache.valid() )
+        _skyImageCache->clear();
+}
+
+// Show the cached sky for the current key, if there is one
+bool SkyDome::_loadCachedSkyImage()
+{
+    osg::Image *image = _skyTexture->getImage();
+    if( image == 0L )
+        return false;
+
+    {
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _skyTextureSubload->getMutex() );
+        if( !_skyImageCache->get( _skyImageKey, image->data(), _skyTextureWidth * _skyTextureHeight * 3 ))
+            return false;
+        _skyTextureSubload->dirtyRows( _skyTextureHeight, 0, _skyTextureHeight );
+    }
+    _setSkyRowsCurrent();
+    _computeSkyLighting( image->data() );
+    return true;
+}
+
+// Request the skies for the next few keys beyond 'to', continuing the step from 'from'
+void SkyDome::_prefetchSkyImages( const SkyImageKey &from, const SkyImageKey &to )
+{
+    if( _numSkyImagePrefetch == 0 || from.turbidity != to.turbidity )
+        return;
+
+    const int numAzimuths = int( floor( 360.0/_skyImageCacheStep + 0.5 ));
+    const int dAlt = to.altitude - from.altitude;
+    int dAz = to.azimuth - from.azimuth;
+    if( dAz > numAzimuths/2 )
+        dAz -= numAzimuths;
+    else if( dAz < -numAzimuths/2 )
+        dAz += numAzimuths;
+
+    std::vector<SkyImageCache::Request> requests;
+    for( unsigned int k = 1; k <= _numSkyImagePrefetch; k++ )
+    {
+        SkyImageCache::Request request;
+        request.key.altitude = to.altitude + int(k) * dAlt;
+        request.key.azimuth = ((to.azimuth + int(k) * dAz) % numAzimuths + numAzimuths) % numAzimuths;
+        request.key.turbidity = to.turbidity;
+        request.altitude = double(request.key.altitude) * _skyImageCacheStep;
+        request.azimuth = double(request.key.azimuth) * _skyImageCacheStep;
+        if( request.altitude < -90.0 || request.altitude > 90.0 )
+            break;
+
+        request.model = _skyModel->clone();
+        request.model->setSunAltitude( request.altitude );
+        request.width = _skyTextureWidth;
+        request.height = _skyTextureHeight;
+        request.mapping = _skyTexCoordMapping;
+        if( _useSkyLookupTable )
+            _computeSkyLookupSlice( request.altitude, request.lookupSlice );
+        requests.push_back( request );
+    }
+    _skyImageCache->prefetch( requests );
+}
+
+// Called when every row of the sky texture has been computed for the current sky
+void SkyDome::_skyTextureComplete( const unsigned char *data )
+{
+    _computeSkyLighting( data );
+
+    if( _skyImageCache.valid() && _skyImageKey.turbidity >= 0 )
+        _skyImageCache->put( _skyImageKey, data, _skyTextureWidth * _skyTextureHeight * 3 );
+}
+
+osg::Image *SkyDome::_createSkyImage()
+{
+    unsigned char *data = new unsigned char[_skyTextureWidth * _skyTextureHeight * 3];
+    unsigned char *ptr = data;
+    for( unsigned int i = 0; i < _skyTextureWidth * _skyTextureHeight; i++ )
+    {
+        *(ptr++) = 0x30;
+        *(ptr++) = 0x30;
+        *(ptr++) = 0xFF;
+    }
+
+    osg::Image *skyImage = new osg::Image;
+    skyImage->setImage( _skyTextureWidth, _skyTextureHeight, 1, GL_RGB, GL_RGB,
+        GL_UNSIGNED_BYTE, data, osg::Image::USE_NEW_DELETE );
+    return skyImage;
+}
+
 void SkyDome::setTurbidity( float t )
 {
     if(t < 1.0f)
-        _T = 1.0f;
+        t = 1.0f;
     else if(t > 60.0f)
-        _T = 60.0f;
+        t = 60.0f;
+
+    if( _skyImageCache.valid() )
+        t = floorf( t * 10.0f + 0.5f ) / 10.0f;
+
+    if( fabsf( t - _skyModel->getTurbidity() ) < _turbidityThreshold )
+        return;
+
+    {
+        OpenThreads::ScopedWriteLock lock( _skyModelMutex );
+        _skyModel->setTurbidity( t );
+    }
+
+    if( _useSkyLookupTable )
+    {
+        _buildSkyLookupTable();
+        _updateSkyLookupSlice();
+    }
+
+    _markSkyStale();
+
+    if( _skyImageCache.valid() && _skyImageKey.turbidity >= 0 )
+    {
+        _skyImageKey = _makeSkyImageKey( _skySunAzimuth, _skySunAltitude, t );
+        _loadCachedSkyImage();
+    }
+}
+
+void SkyDome::setSkyModel( SkyModel *model )
+{
+    if( model == NULL || model == _skyModel.get() )
+        return;
+
+    model->setTurbidity( _skyModel->getTurbidity() );
+    model->setSunAltitude( _skySunAltitude );
+    {
+        OpenThreads::ScopedWriteLock lock( _skyModelMutex );
+        _skyModel = model;
+    }
+    _clearSkyImageCache();
+
+    if( _useSkyLookupTable )
+    {
+        _buildSkyLookupTable();
+        _updateSkyLookupSlice();
+    }
+    _markSkyStale();
+}
+
+void SkyDome::setUseSkyLookupTable( bool flag )
+{
+    _useSkyLookupTable = flag;
+    _clearSkyImageCache();
+    if( _useSkyLookupTable )
+    {
+        _buildSkyLookupTable();
+        _updateSkyLookupSlice();
+    }
+    else
+    {
+        std::vector<float>().swap( _skyLookupTable );
+        std::vector<float>().swap( _skyLookupSlice );
+    }
+    _markSkyStale();
+}
+
+void SkyDome::setAutoTesselation( bool flag )
+{
+    if( flag == _autoTesselation )
+        return;
+
+    _autoTesselation = flag;
+
+    {
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _pixelsPerDegreeMutex );
+        _maxPixelsPerDegree = 0.0;
+    }
+
+    // Geometry is switched during update, so draw must not overlap it
+    osg::Geode *geodes[2] = { _northernHemisphere.get(), _southernHemisphere.get() };
+    for( int i = 0; i < 2; i++ )
+    {
+        if( geodes[i] == NULL )
+            continue;
+        for( unsigned int j = 0; j < geodes[i]->getNumDrawables(); j++ )
+            geodes[i]->getDrawable(j)->setDataVariance( flag ? osg::Object::DYNAMIC : osg::Object::STATIC );
+    }
+
+    // Request update traversals for traverse(), leaving the update callback
+    // to the application
+    if( flag )
+        setNumChildrenRequiringUpdateTraversal( getNumChildrenRequiringUpdateTraversal() + 1 );
+    else
+        setNumChildrenRequiringUpdateTraversal( getNumChildrenRequiringUpdateTraversal() - 1 );
+}
+
+void SkyDome::_updateTesselation()
+{
+    double ppd;
+    {
+        OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _pixelsPerDegreeMutex );
+        ppd = _maxPixelsPerDegree;
+        _maxPixelsPerDegree = 0.0;
+    }
+
+    // Nothing was culled since the last update
+    if( ppd <= 0.0 )
+        return;
+
+    // Latitude steps of TessLow and TessNormal.  See Sphere.cpp
+    TesselationResolution tr;
+    if( 15.0 * ppd <= _autoTesselationPixelSize )
+        tr = TessLow;
+    else if( 7.5 * ppd <= _autoTesselationPixelSize )
+        tr = TessNormal;
     else
-        _T = t;
+        tr = TessHigh;
 
-    _updateDistributionCoefficients();
+    setTesselation( tr );
 }
 
 void SkyDome::traverse(osg::NodeVisitor&nv)
 {
     if (dynamic_cast<osgUtil::UpdateVisitor*>(&nv))
-                   return;
+    {
+        if( _autoTesselation )
+            _updateTesselation();
+        return;
+    }
+
+    if( _autoTesselation && nv.getVisitorType() == osg::NodeVisitor::CULL_VISITOR )
+    {
+        osgUtil::CullVisitor *cv = dynamic_cast<osgUtil::CullVisitor *>(&nv);
+        double fovy, aspect, zNear, zFar;
+        if( cv != NULL && cv->getViewport() != NULL && cv->getProjectionMatrix() != NULL &&
+            cv->getProjectionMatrix()->getPerspective( fovy, aspect, zNear, zFar ) && fovy > 0.0 )
+        {
+            double ppd = cv->getViewport()->height() / fovy;
+            OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _pixelsPerDegreeMutex );
+            if( ppd > _maxPixelsPerDegree )
+                _maxPixelsPerDegree = ppd;
+        }
+    }
 
     // The sun fills 0.53 degrees of visual angle.  The 1.45 multiplier is because the sun texture includes
     // a partially transparent halo around it so there isn't a hard edge.
@@ -296,23 +1157,21 @@ void SkyDome::_buildStateSet()
         sset->setTextureMode( _skyTextureUnit, GL_TEXTURE_GEN_Q, osg::StateAttribute::OFF );
         sset->setTextureAttributeAndModes( _skyTextureUnit, texGen, osg::StateAttribute::ON );*/
 		  
-        unsigned char *data = new unsigned char[SKY_DOME_X_SIZE * SKY_DOME_Y_SIZE * 3];
-        unsigned char *ptr = data;
-        for( int i = 0; i < SKY_DOME_X_SIZE * SKY_DOME_Y_SIZE; i++ )
-        {
-            *(ptr++) = 0x30;
-            *(ptr++) = 0x30;
-            *(ptr++) = 0xFF;
-        }
-        
-        osg::Image *skyImage = new osg::Image;
-        skyImage->setImage( SKY_DOME_X_SIZE, SKY_DOME_Y_SIZE, 1, GL_RGB, GL_RGB,
-            GL_UNSIGNED_BYTE, data, osg::Image::USE_NEW_DELETE );
+        osg::Image *skyImage = _createSkyImage();
         _skyTexture = new osg::Texture2D;
         _skyTexture->setWrap(osg::Texture2D::WRAP_S, osg::Texture2D::REPEAT);
         _skyTexture->setWrap(osg::Texture2D::WRAP_T, osg::Texture2D::MIRROR);
         _skyTexture->setFilter(osg::Texture2D::MAG_FILTER,osg::Texture2D::LINEAR);
+        // Partial uploads would leave mipmaps stale
+        _skyTexture->setFilter(osg::Texture2D::MIN_FILTER,osg::Texture2D::LINEAR);
+        _skyTexture->setResizeNonPowerOfTwoHint( false );
+        _skyTexture->setInternalFormat( GL_RGB );
         _skyTexture->setImage( skyImage );
+        _skyTexture->setTextureSize( _skyTextureWidth, _skyTextureHeight );
+
+        _skyTextureSubload = new SkyTextureSubload;
+        _skyTextureSubload->dirtyRows( _skyTextureHeight, 0, _skyTextureHeight );
+        _skyTexture->setSubloadCallback( _skyTextureSubload.get() );
         sset->setTextureAttributeAndModes( _skyTextureUnit, _skyTexture.get() );
         //sset->setTextureMode( _skyTextureUnit, GL_TEXTURE_2D, osg::StateAttribute::ON);
     }
@@ -320,15 +1179,24 @@ void SkyDome::_buildStateSet()
     ///////////////////// Sun Texture unit 
     {
         //_sunImage = osgDB::readImageFile( "sun.rgba" );
-        _sunImage = new osg::Image;
-        _sunImage->setImage( 
-            _sunImageWidth, 
-            _sunImageHeight, 1,
-            _sunImageInternalTextureFormat,
-            _sunImagePixelFormat,
-            GL_UNSIGNED_BYTE,
-            _sunImageData,
-            osg::Image::NO_DELETE );
+        ResourcePack *pack = ResourcePack::getDefault();
+        if( pack != 0L )
+            _sunImage = pack->readImage( "sun" );
+
+#ifndef OSGEPHEMERIS_NO_EMBEDDED_IMAGES
+        if( !_sunImage.valid() )
+        {
+            _sunImage = new osg::Image;
+            _sunImage->setImage( 
+                _sunImageWidth, 
+                _sunImageHeight, 1,
+                _sunImageInternalTextureFormat,
+                _sunImagePixelFormat,
+                GL_UNSIGNED_BYTE,
+                _sunImageData,
+                osg::Image::NO_DELETE );
+        }
+#endif
 
 
         if( _sunImage.valid() )
@@ -338,10 +1206,17 @@ void SkyDome::_buildStateSet()
             _sunTexture->setWrap( osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_BORDER);
             _sunTexture->setImage( _sunImage.get() );
 
-            sset->setTextureAttributeAndModes( _sunTextureUnit, _sunTexture.get() );
+            // The sun is only projected on the sectors that contain it, which
+            // turn the texture back on with _sunSectorStateSet.  This avoids
+            // the "back projected" anomaly that occurs from projected textures.
+            sset->setTextureAttribute( _sunTextureUnit, _sunTexture.get() );
+            sset->setTextureMode( _sunTextureUnit, GL_TEXTURE_2D, osg::StateAttribute::OFF );
+
+            _sunSectorStateSet = new osg::StateSet;
+            _sunSectorStateSet->setTextureMode( _sunTextureUnit, GL_TEXTURE_2D, osg::StateAttribute::ON );
         }
-        //else
-        //    std::cerr << "Ephemeris::SkyDome() - Can't find sun texture \"sun.rgba\""<< std::endl;
+        else
+            std::cerr << "Ephemeris::SkyDome() - Can't find sun texture \"sun\""<< std::endl;
 
 
         _sunTexGenNorth = new osg::TexGen;
@@ -369,282 +1244,490 @@ void SkyDome::_buildStateSet()
     }
 }
 
-SkyDome::SectorUpdateCallback::SectorUpdateCallback( double &sunAz, double min, double max, unsigned int sunTextureUnit ):
-    _sunAz(sunAz),
-    _sunTextureUnit(sunTextureUnit)
+bool SkyDome::_withinDeg( double x, double min, double max )
 {
-    _min = _range( min, 360 );
-    _max = _range( max, 360 );
+    if( min > max )
+        return ((x >= min) && (x <= (max+360.0))) || ((x <= max) && (x >= (min-360.0)));
+
+    return ((x >= min) && (x <= max));
 }
 
-void SkyDome::SectorUpdateCallback::update(osg::NodeVisitor* nv, osg::Drawable* dbl) 
+
+void SkyDome::_computeSkyTexture()
 {
-    osg::ref_ptr<osgUtil::UpdateVisitor> updateVisitor = dynamic_cast<osgUtil::UpdateVisitor*>(nv);
+    _skyUpdateFrame++;
+    _skyUpdateTime = 0.0;
+    _numSkyRowsUpdated = 0;
 
-    if( !updateVisitor.valid()  )
+    osg::Image *image = _skyTexture->getImage();
+    // Nothing to do, and nothing to upload, until the sky changes again
+    if( image != 0L && _num_stale_rows > 0 )
     {
-       return;
-    }
+        osg::Timer *timer = osg::Timer::instance();
+        const osg::Timer_t start = timer->tick();
 
-    double sun = _range(_sunAz, 360);
+        if( _skyUpdateMode == FullFrameUpdate )
+        {
+            if( !_skyTextureThreadPool.valid() )
+            {
+                unsigned int numThreads = _numSkyUpdateThreads;
+                if( numThreads == 0 )
+                    numThreads = OpenThreads::GetNumberOfProcessors();
+                _skyTextureThreadPool = new SkyTextureThreadPool( this, numThreads );
+            }
 
-    if( _withinDeg( sun, _min, _max ))
-    {
-        dbl->getStateSet()->setTextureMode( _sunTextureUnit, GL_TEXTURE_2D, osg::StateAttribute::ON);
-    }
-    else
-    {
-        dbl->getStateSet()->setTextureMode( _sunTextureUnit, GL_TEXTURE_2D, osg::StateAttribute::OFF);
-        // For testing, cull geometry
-        //return true;
+            // Compute every row for this sun position into the back buffer, then
+            // swap it into the image all at once.
+            _skyBackBuffer.resize( _skyTextureWidth * _skyTextureHeight * 3 );
+            _skyTextureThreadPool->compute( &_skyBackBuffer.front() );
+            {
+                OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _skyTextureSubload->getMutex() );
+                memcpy( image->data(), &_skyBackBuffer.front(), _skyBackBuffer.size() );
+                _skyTextureSubload->dirtyRows( _skyTextureHeight, 0, _skyTextureHeight );
+            }
+            _numSkyRowsUpdated = _skyTextureHeight;
+            _setSkyRowsCurrent();
+            _skyTextureComplete( &_skyBackBuffer.front() );
+        }
+        else
+        {
+            // Rows that have been out of date too long are computed whatever the budget
+            for( unsigned int row = 0; row < _skyRowStale.size(); row++ )
+            {
+                if( _skyRowStale[row] && _skyUpdateFrame - _skyRowStaleSince[row] >= _maxSkyRowAge )
+                    _updateSkyRow( image, row );
+            }
+
+            // Then rows in priority order while the budget lasts
+            while( _num_stale_rows > 0 && _skyRowOrderCursor < _skyRowOrder.size() )
+            {
+                if( _numSkyRowsUpdated > 0 &&
+                    timer->delta_u( start, timer->tick() ) >= _skyUpdateTimeBudget )
+                    break;
+
+                const unsigned int row = _skyRowOrder[_skyRowOrderCursor++];
+                if( _skyRowStale[row] )
+                    _updateSkyRow( image, row );
+            }
+
+            // A cached sky must be all of one sun position, but the lighting
+            // only waits for every row to have been rewritten once
+            if( _num_stale_rows == 0 )
+                _skyTextureComplete( image->data() );
+            else if( _numSkyRowsPendingLighting == 0 )
+                _computeSkyLighting( image->data() );
+        }
+
+        _skyUpdateTime = timer->delta_u( start, timer->tick() );
     }
 
-    return;
+    _updateSkyRowAgeStats();
 }
 
-bool SkyDome::SectorUpdateCallback::_withinDeg( double x, double min, double max ) const
+unsigned int SkyDome::getSkyTextureBytesUploaded() const
 {
-    if( min > max )
-        return ((x >= min) && (x <= (max+360.0))) || ((x <= max) && (x >= (min-360.0)));
-
-    return ((x >= min) && (x <= max));
+    return _skyTextureSubload->getFrameBytes();
 }
 
-
-void SkyDome::_updateDistributionCoefficients()
+double SkyDome::getSkyTextureTotalBytesUploaded() const
 {
-    // Preetham   
-/*    _Ax = _T * -0.0193f + -0.2592f;
-    _Bx = _T * -0.0665f +  0.0008f;
-    _Cx = _T * -0.0004f +  0.2125f;
-    _Dx = _T * -0.0641f + -0.8989f;
-    _Ex = _T * -0.0033f +  0.0452f;
+    return _skyTextureSubload->getTotalBytes();
+}
 
-    _Ay = _T * -0.0167f + -0.2608f;
-    _By = _T * -0.0950f +  0.0092f;
-    _Cy = _T * -0.0079f +  0.2102f;
-    _Dy = _T * -0.0441f + -1.6537f;
-    _Ey = _T * -0.0109f +  0.0529f;
+// Compute rows [firstRow, endRow) of the sky texture into data, which holds a
+// full _skyTextureWidth x _skyTextureHeight RGB image.  This only reads the sky
+// model, so bands may be computed concurrently.
+void SkyDome::_computeSkyRows( unsigned char *data, int firstRow, int endRow )
+{
+    _computeSkyRows( _skyModel.get(), _useSkyLookupTable ? &_skyLookupSlice.front() : 0L,
+                     _skyTextureWidth, _skyTextureHeight, _skyTexCoordMapping,
+                     _skySunAzimuth, _skySunAltitude, data, firstRow, endRow );
+}
 
-    _AY = _T *  0.1787f + -1.4630f;
-    _BY = _T * -0.3554f +  0.4275f;
-    _CY = _T * -0.0227f +  5.3251f;
-    _DY = _T *  0.1206f + -2.5771f;
-    _EY = _T * -0.0670f +  0.3703f;*/
+// Rows [firstRow, endRow) of a sky texture for the given sun position, from the
+// slice of the lookup table for the sun altitude if there is one, otherwise
+// from the sky model.  Touches no SkyDome state, so the prefetch thread of the
+// sky image cache can use it too.
+void SkyDome::_computeSkyRows( const SkyModel *model, const float *lookupSlice,
+                               unsigned int textureWidth, unsigned int textureHeight,
+                               SkyTexCoordMapping mapping,
+                               double sunAzimuth, double sunAltitude,
+                               unsigned char *data, int firstRow, int endRow )
+{
+    const float altitude = static_cast<float>(osg::DegreesToRadians(sunAltitude));
+    const float azimuth  = static_cast<float>(osg::DegreesToRadians(sunAzimuth));
 
-    _Ar = _T * 0.00367f + 0.09f;
-    _Br = _T * -0.08f + 6.0f;
-    _Cr = 0.5f;
-    _Dr = _T * -0.63333f + 40.0f;
-    _Er = 0.19f;
-    _horiz_atten_r = 0.0f;
-    _solar_atten_r = 0.0f;
+    const int width = int(textureWidth);
+    unsigned char *ptr = data + (firstRow * width * 3);
 
-    _Ag = _T * 0.00367f + 0.11f;
-    _Bg = _T * -0.08f + 6.0f;
-    _Cg = 0.5f;
-    _Dg = _T * -0.63333f + 40.0f;
-    _Eg = 0.17f;
-    _horiz_atten_g = powf(0.2f, 1.0f + 0.1f * _T);
-    _solar_atten_g = powf(0.4f, 1.0f + 0.1f * _T);
+    osg::Vec3f sun_vec( sinf(azimuth) * cosf(altitude),
+                        cosf(azimuth) * cosf(altitude),
+                        sinf(altitude) );
 
-    _Ab = 0.1f;
-    _Bb = _T * -0.11f + 8.0f;
-    _Cb = 0.5f;
-    _Db = _T * -0.63333f + 40.0f;
-    _Eb = 0.4f;
-    _horiz_atten_b = powf(0.3f, 1.0f + 0.1f * _T);
-    _solar_atten_b = powf(0.6f, 1.0f + 0.1f * _T);
-}
+    // Per row inputs and outputs of the sky model
+    std::vector<float> buffer( width * 5 );
+    float *cos_theta = &buffer[0];
+    float *cos_gamma = cos_theta + width;
+    float *R = cos_gamma + width;
+    float *G = R + width;
+    float *B = G + width;
 
-void SkyDome::_updateZenithxyY()
-{
-    const float ths2(_theta_sun * _theta_sun);
-    const float ths3(ths2 * _theta_sun);
-    const float T2(_T * _T);
+    for( int row = firstRow; row < endRow; row++ )
+    {
+        // Inverse of the altitude mapping of Sphere sky texture coordinates
+        const float v( (float(row) + 0.5f) / float(textureHeight) );
+        const float texel_alt( mapping == HorizonWeightedAltitude ?
+            (1.0f - sqrtf(v)) * 1.57079633f :
+            (1.0f - v) * 1.57079633f );
+        const float cos_texel_alt( cosf(texel_alt) );
+        const float sin_texel_alt( sinf(texel_alt) );
+        // theta = angle between zenith and texel
+        const float theta( 1.57079633f - texel_alt );
+        // theta remapped from {0, pi} to {0, 1}
+        const float theta_0_1( theta / 1.57079633f );
+
+        if( lookupSlice != 0L )
+        {
+            // Bilinear lookup in the slice of the table for the current sun altitude
+            float ft = theta_0_1 * float(SKY_LUT_THETA_SIZE - 1);
+            int it = int(ft);
+            if( it > SKY_LUT_THETA_SIZE - 2 )
+                it = SKY_LUT_THETA_SIZE - 2;
+            ft -= float(it);
+            const float *row0 = &lookupSlice[it * SKY_LUT_GAMMA_SIZE * 3];
+            const float *row1 = row0 + SKY_LUT_GAMMA_SIZE * 3;
+
+            for(int i=0; i<width; ++i)
+            {
+                const float texel_azi( -1.57079633f - 
+                    (float(i) + 0.5f) * 6.28318531f / float(width) );
+                osg::Vec3f texel_vec( sinf(texel_azi) * cos_texel_alt,
+                                      cosf(texel_azi) * cos_texel_alt,
+                                      sin_texel_alt );
+                // The table is indexed by sin(gamma/2), which avoids the acos and
+                // puts more samples close to the sun
+                const float cos_gamma( sun_vec * texel_vec );
+                float half = (1.0f - cos_gamma) * 0.5f;
+                float fg = sqrtf( half > 0.0f ? half : 0.0f ) * float(SKY_LUT_GAMMA_SIZE - 1);
+                int ig = int(fg);
+                if( ig > SKY_LUT_GAMMA_SIZE - 2 )
+                    ig = SKY_LUT_GAMMA_SIZE - 2;
+                fg -= float(ig);
+
+                const float *a = row0 + ig * 3;
+                const float *b = row1 + ig * 3;
+                for( int c = 0; c < 3; c++ )
+                {
+                    const float top    = a[c] + (a[c + 3] - a[c]) * fg;
+                    const float bottom = b[c] + (b[c + 3] - b[c]) * fg;
+                    *(ptr++) = (unsigned char)((top + (bottom - top) * ft) * 255.0f);
+                }
+            }
+            continue;
+        }
 
-    _xz = T2 * (0.00166f * ths3 + -0.00375f * ths2 + 0.00209f * _theta_sun)
-        + _T * (-0.02903f * ths3 + 0.06377f * ths2 + -0.03202f * _theta_sun + 0.00394f)
-        + (0.11693f * ths3 + -0.21196f * ths2 + 0.06052f * _theta_sun + 0.25886f);
-    
-    _yz = T2 * (0.00275f * ths3 + -0.0061f * ths2 + 0.00317f * _theta_sun)
-        + _T * (-0.04214f * ths3 + 0.0897f * ths2 + -0.04153f * _theta_sun + 0.00516f)
-        + (0.15346f * ths3 + -0.26756f * ths2 + 0.0667f * _theta_sun + 0.26688f);
+        for(int i=0; i<width; ++i)
+        {
+            const float texel_azi( -1.57079633f - 
+                (float(i) + 0.5f) * 6.28318531f / float(width) );
+            const float cos_texel_azi( cosf(texel_azi) );
+            const float sin_texel_azi( sinf(texel_azi) );
+            osg::Vec3f texel_vec( sin_texel_azi * cos_texel_alt,
+                                  cos_texel_azi * cos_texel_alt,
+                                  sin_texel_alt );
+            cos_theta[i] = sin_texel_alt;
+            // gamma = angle between sun and texel
+            cos_gamma[i] = sun_vec * texel_vec;
+        }
 
-    const float chi( (0.44444444f - (_T * 0.00833333f))
-        * (3.14159265f - (2.0f * _theta_sun)) );
+        // The whole row goes through the sky model in one call
+        model->computeRadiance( width, cos_theta, cos_gamma, R, G, B );
+        _toneMap( width, R, G, B );
 
-    _Yz = (((4.0453f * _T) - 4.971f) * tanf(chi)) - (0.2155f * _T) + 2.4192f;
+        for(int i=0; i<width; ++i)
+        {
+            *(ptr++) = (unsigned char)(R[i] * 255.0f);
+            *(ptr++) = (unsigned char)(G[i] * 255.0f);
+            *(ptr++) = (unsigned char)(B[i] * 255.0f);
+        }
+    }
 }
 
-inline float SkyDome::_xDistributionFunction(const float /*theta*/, const float cos_theta,
-                                            const float gamma, const float cos_gamma_sq)
+// Tone map n colors in place to the range {0, 1}
+void SkyDome::_toneMap( unsigned int n, float *r, float *g, float *b )
 {
-    return _xz
-        * ( (1.0f + (_Ax * expf(_Bx / cos_theta)))
-        * (1.0f + (_Cx * expf(_Dx * gamma)) + (_Ex * cos_gamma_sq)) )
-        / ( (1.0f + (_Ax * expf(_Bx)))
-        * (1.0f + (_Cx * expf(_Dx * _theta_sun)) + (_Ex * _cos_theta_sun_squared)) );
+    const float exposure( 5.0f );
+    for( unsigned int i = 0; i < n; i++ )
+    {
+        const float luminance( r[i] * 0.299f + g[i] * 0.587f + b[i] * 0.114f );
+        const float brightness( 1.0f - fastExp(-luminance * exposure) );
+        const float scale( brightness / (luminance + 0.001f) );
+        const float R( r[i] * scale );
+        const float G( g[i] * scale );
+        const float B( b[i] * scale );
+
+        // Clamp upper bound to 1.0
+        // No need to clamp lower bound to 0.0 because the sky models never go negative
+        r[i] = fastMin( R, 1.0f );
+        g[i] = fastMin( G, 1.0f );
+        b[i] = fastMin( B, 1.0f );
+    }
 }
 
-inline float SkyDome::_yDistributionFunction(const float /*theta*/, const float cos_theta,
-                                            const float gamma, const float cos_gamma_sq)
+void SkyDome::computeSkyRadiance( unsigned int n, const osg::Vec3 *directions, osg::Vec3 *radiance,
+                                  bool toneMapped ) const
 {
-    return _yz
-        * ( (1.0f + (_Ay * expf(_By / cos_theta)))
-        * (1.0f + (_Cy * expf(_Dy * gamma)) + (_Ey * cos_gamma_sq)) )
-        / ( (1.0f + (_Ay * expf(_By)))
-        * (1.0f + (_Cy * expf(_Dy * _theta_sun)) + (_Ey * _cos_theta_sun_squared)) );
-}
+    // Directions go through the sky model in batches
+    const unsigned int batchSize = 256;
+    float cos_theta[batchSize];
+    float cos_gamma[batchSize];
+    float R[batchSize], G[batchSize], B[batchSize];
 
-inline float SkyDome::_YDistributionFunction(const float /*theta*/, const float cos_theta,
-                                            const float gamma, const float cos_gamma_sq)
-{
-    return _Yz
-        * ( (1.0f + (_AY * expf(_BY / cos_theta)))
-        * (1.0f + (_CY * expf(_DY * gamma)) + (_EY * cos_gamma_sq)) )
-        / ( (1.0f + (_AY * expf(_BY)))
-        * (1.0f + (_CY * expf(_DY * _theta_sun)) + (_EY * _cos_theta_sun_squared)) );
-}
+    OpenThreads::ScopedReadLock lock( _skyModelMutex );
 
-inline float SkyDome::_RedFunction(const float /*theta*/, const float theta_0_1,
-                                         const float /*gamma*/, const float gamma_1_0)
-{
-    return ( (_Ar * powf(theta_0_1, _Br) * (1.0f - _horiz_atten_r * _sunset_atten))  // horizon light
-        + (_Cr * powf(gamma_1_0, _Dr) * (1.0f - _solar_atten_r * _sunset_atten))     // circumsolar light
-        + _Er )                            // overall light
-        * _light_due_to_alt;
+    const float altitude = static_cast<float>(osg::DegreesToRadians(_skySunAltitude));
+    const float azimuth  = static_cast<float>(osg::DegreesToRadians(_skySunAzimuth));
+    const osg::Vec3f sun_vec( sinf(azimuth) * cosf(altitude),
+                              cosf(azimuth) * cosf(altitude),
+                              sinf(altitude) );
+
+    for( unsigned int first = 0; first < n; first += batchSize )
+    {
+        const unsigned int count = (n - first < batchSize) ? n - first : batchSize;
+
+        // Directions below the horizon see the mirrored sky.  As in the sky
+        // models, the loops only use FastMath.h and selects, so that they
+        // vectorize.
+        for( unsigned int i = 0; i < count; i++ )
+        {
+            const osg::Vec3f &d = directions[first + i];
+            const float length2 = d.x() * d.x() + d.y() * d.y() + d.z() * d.z();
+            const float inv_length = fastSelect( length2 > 0.0f, 1.0f / fastSqrt( length2 ), 0.0f );
+            const float z = fastSelect( d.z() < 0.0f, -d.z(), d.z() );
+            cos_theta[i] = z * inv_length;
+            cos_gamma[i] = (sun_vec.x() * d.x() + sun_vec.y() * d.y() + sun_vec.z() * z) * inv_length;
+        }
+
+        _skyModel->computeRadiance( count, cos_theta, cos_gamma, R, G, B );
+        if( toneMapped )
+            _toneMap( count, R, G, B );
+
+        for( unsigned int i = 0; i < count; i++ )
+            radiance[first + i].set( R[i], G[i], B[i] );
+    }
 }
 
-inline float SkyDome::_GreenFunction(const float /*theta*/, const float theta_0_1,
-                                           const float /*gamma*/, const float gamma_1_0)
+#define SKY_LIGHTING_LANES 4
+
+// The five azimuth weighted sums of one channel of a row, over n texels, n a
+// multiple of SKY_LIGHTING_LANES.  Each lane keeps its own partial sums, which
+// lets the compiler vectorize the loop without reassociating float additions.
+static void _skyLightingRowSums( int n, const float *col,
+                                 const float *sinA, const float *cosA,
+                                 const float *sinCosA, const float *sin2MinusCos2A,
+                                 float sums[5] )
 {
-    return ( (_Ag * powf(theta_0_1, _Bg) * (1.0f - _horiz_atten_g * _sunset_atten))
-        + (_Cg * powf(gamma_1_0, _Dg) * (1.0f - _solar_atten_g * _sunset_atten))
-        + _Eg )
-        * _light_due_to_alt;
+    float s0[SKY_LIGHTING_LANES], ss[SKY_LIGHTING_LANES], sc[SKY_LIGHTING_LANES];
+    float ssc[SKY_LIGHTING_LANES], sd[SKY_LIGHTING_LANES];
+    for( int j = 0; j < SKY_LIGHTING_LANES; j++ )
+        s0[j] = ss[j] = sc[j] = ssc[j] = sd[j] = 0.0f;
+
+    for( int i = 0; i < n; i += SKY_LIGHTING_LANES )
+    {
+        for( int j = 0; j < SKY_LIGHTING_LANES; j++ )
+        {
+            const float x = col[i + j];
+            s0[j]  += x;
+            ss[j]  += sinA[i + j] * x;
+            sc[j]  += cosA[i + j] * x;
+            ssc[j] += sinCosA[i + j] * x;
+            sd[j]  += sin2MinusCos2A[i + j] * x;
+        }
+    }
+
+    sums[0] = (s0[0] + s0[1]) + (s0[2] + s0[3]);
+    sums[1] = (ss[0] + ss[1]) + (ss[2] + ss[3]);
+    sums[2] = (sc[0] + sc[1]) + (sc[2] + sc[3]);
+    sums[3] = (ssc[0] + ssc[1]) + (ssc[2] + ssc[3]);
+    sums[4] = (sd[0] + sd[1]) + (sd[2] + sd[3]);
 }
 
-inline float SkyDome::_BlueFunction(const float /*theta*/, const float theta_0_1,
-                                          const float /*gamma*/, const float gamma_1_0)
+// Project the sky texture above the horizon onto the spherical harmonics of
+// order 2.  Within a row the direction depends on azimuth only through sin(a)
+// and cos(a), so each row reduces to five weighted sums per channel over its
+// texels, which are then scaled by the altitude terms of each basis function.
+void SkyDome::_computeSkyLighting( const unsigned char *data )
 {
-    return ( (_Ab * powf(theta_0_1, _Bb) * (1.0f - _horiz_atten_b * _sunset_atten))
-        + (_Cb * powf(gamma_1_0, _Db) * (1.0f - _solar_atten_b * _sunset_atten))
-        + _Eb )
-        * _light_due_to_alt;
+    // Every row now has to be rewritten again before the next update
+    _skyLightingGeneration++;
+    _numSkyRowsPendingLighting = _skyTextureHeight;
+
+    const int width = int(_skyTextureWidth);
+    const int height = int(_skyTextureHeight);
+    // Rows are padded with zero texels to a whole number of lanes
+    const int paddedWidth = (width + SKY_LIGHTING_LANES - 1) / SKY_LIGHTING_LANES * SKY_LIGHTING_LANES;
+
+    // Azimuth terms per column, and the row in planar float form
+    std::vector<float> buffer( paddedWidth * 7, 0.0f );
+    float *sinA = &buffer[0];
+    float *cosA = sinA + paddedWidth;
+    float *sinCosA = cosA + paddedWidth;
+    float *sin2MinusCos2A = sinCosA + paddedWidth;
+    float *R = sin2MinusCos2A + paddedWidth;
+    float *G = R + paddedWidth;
+    float *B = G + paddedWidth;
+
+    for( int i = 0; i < width; i++ )
+    {
+        const float texel_azi( -1.57079633f - (float(i) + 0.5f) * 6.28318531f / float(width) );
+        sinA[i] = sinf( texel_azi );
+        cosA[i] = cosf( texel_azi );
+        sinCosA[i] = sinA[i] * cosA[i];
+        sin2MinusCos2A[i] = sinA[i] * sinA[i] - cosA[i] * cosA[i];
+    }
+
+    double L[9][3];
+    for( int k = 0; k < 9; k++ )
+        L[k][0] = L[k][1] = L[k][2] = 0.0;
+    double luminance = 0.0;
+    double totalWeight = 0.0;
+
+    const float dAzimuth = 6.28318531f / float(width);
+    const unsigned char *ptr = data;
+    for( int row = 0; row < height; row++ )
+    {
+        // Same altitude mapping as _computeSkyRows()
+        const float v( (float(row) + 0.5f) / float(height) );
+        float texel_alt, dAltitude;
+        if( _skyTexCoordMapping == HorizonWeightedAltitude )
+        {
+            texel_alt = (1.0f - sqrtf(v)) * 1.57079633f;
+            dAltitude = 0.78539816f / (sqrtf(v) * float(height));
+        }
+        else
+        {
+            texel_alt = (1.0f - v) * 1.57079633f;
+            dAltitude = 1.57079633f / float(height);
+        }
+        const float c( cosf(texel_alt) );
+        const float z( sinf(texel_alt) );
+        // Solid angle of each texel in the row
+        const double w = c * dAltitude * dAzimuth;
+
+        for( int i = 0; i < width; i++ )
+        {
+            R[i] = float(ptr[0]) * (1.0f/255.0f);
+            G[i] = float(ptr[1]) * (1.0f/255.0f);
+            B[i] = float(ptr[2]) * (1.0f/255.0f);
+            ptr += 3;
+        }
+
+        const float *channels[3] = { R, G, B };
+        float s0[3];
+        for( int ch = 0; ch < 3; ch++ )
+        {
+            float sums[5];
+            _skyLightingRowSums( paddedWidth, channels[ch], sinA, cosA, sinCosA, sin2MinusCos2A, sums );
+            s0[ch] = sums[0];
+            const double ss = sums[1], sc = sums[2], ssc = sums[3], sd = sums[4];
+
+            // x = sin(a) c, y = cos(a) c
+            L[0][ch] += w * 0.282095 * s0[ch];
+            L[1][ch] += w * 0.488603 * c * sc;
+            L[2][ch] += w * 0.488603 * z * s0[ch];
+            L[3][ch] += w * 0.488603 * c * ss;
+            L[4][ch] += w * 1.092548 * c * c * ssc;
+            L[5][ch] += w * 1.092548 * c * z * sc;
+            L[6][ch] += w * 0.315392 * (3.0 * z * z - 1.0) * s0[ch];
+            L[7][ch] += w * 1.092548 * c * z * ss;
+            L[8][ch] += w * 0.546274 * c * c * sd;
+        }
+
+        // Luminance is linear in the channels, so it follows from their sums
+        luminance += w * (0.299 * s0[0] + 0.587 * s0[1] + 0.114 * s0[2]);
+        totalWeight += w * double(width);
+    }
+
+    // Convolution of radiance with the clamped cosine, per band
+    static const double A[9] = { osg::PI,
+                                 2.0*osg::PI/3.0, 2.0*osg::PI/3.0, 2.0*osg::PI/3.0,
+                                 osg::PI/4.0, osg::PI/4.0, osg::PI/4.0, osg::PI/4.0, osg::PI/4.0 };
+    for( int k = 0; k < 9; k++ )
+    {
+        _skyIrradianceSH[k].set( A[k] * L[k][0], A[k] * L[k][1], A[k] * L[k][2] );
+        _skyIrradianceSHUniform->setElement( k, _skyIrradianceSH[k] );
+    }
+
+    _skyMeanLuminance = totalWeight > 0.0 ? float(luminance / totalWeight) : 0.0f;
+    _skyMeanLuminanceUniform->set( _skyMeanLuminance );
 }
 
-void SkyDome::_computeSkyTexture()
+// Tabulate the tone mapped sky color over sun altitude, texel zenith angle and
+// sin(gamma/2) for the current turbidity.  A copy of the sky model is swept
+// through the sun altitudes of the table, so that the sky model itself always
+// matches the sky texture for computeSkyRadiance().
+void SkyDome::_buildSkyLookupTable()
 {
-    const float altitude = static_cast<float>(osg::DegreesToRadians(_sunAltitude));
-    const float azimuth  = static_cast<float>(osg::DegreesToRadians(_sunAzimuth));
+    osg::ref_ptr<SkyModel> model = _skyModel->clone();
 
-    _theta_sun = osg::DegreesToRadians(90.0 - _sunAltitude);
-    _theta_sun_0_1 = (90.0 - _sunAltitude) / 90.0f;
-    _cos_theta_sun = cosf(_theta_sun);
-    _cos_theta_sun_squared = _cos_theta_sun * _cos_theta_sun;
-    _sin_theta_sun = sinf(_theta_sun);
+    _skyLookupTable.resize( SKY_LUT_ALT_SIZE * SKY_LUT_THETA_SIZE * SKY_LUT_GAMMA_SIZE * 3 );
+    float *ptr = &_skyLookupTable.front();
 
-    // part of Preetham model
-    //_updateZenithxyY();
+    float cos_theta[SKY_LUT_GAMMA_SIZE];
+    float cos_gamma[SKY_LUT_GAMMA_SIZE];
+    float R[SKY_LUT_GAMMA_SIZE], G[SKY_LUT_GAMMA_SIZE], B[SKY_LUT_GAMMA_SIZE];
 
-    _sunset_atten = powf(_sin_theta_sun, 20.0f);
-
-    osg::Image *image = _skyTexture->getImage();
-    if( image != 0L )
+    for( int g = 0; g < SKY_LUT_GAMMA_SIZE; g++ )
     {
-        unsigned char *ptr = image->data() + (_current_tex_row * SKY_DOME_X_SIZE * 3);
+        // cos(gamma) = 1 - 2 sin^2(gamma/2)
+        const float u( float(g) / float(SKY_LUT_GAMMA_SIZE - 1) );
+        cos_gamma[g] = 1.0f - 2.0f * u * u;
+    }
 
-        osg::Vec3f sun_vec( sinf(azimuth) * cosf(altitude),
-                            cosf(azimuth) * cosf(altitude),
-                            sinf(altitude) );
+    for( int a = 0; a < SKY_LUT_ALT_SIZE; a++ )
+    {
+        model->setSunAltitude( SKY_LUT_MIN_ALT + (90.0 - SKY_LUT_MIN_ALT) * double(a) / double(SKY_LUT_ALT_SIZE - 1) );
 
-        const int end_row( _current_tex_row + 4 );
-        while(_current_tex_row < end_row)
-        //for(int j=0; j<SKY_DOME_Y_SIZE; j++)
+        for( int t = 0; t < SKY_LUT_THETA_SIZE; t++ )
         {
-            const float texel_alt( 1.57079633f - 
-                ((float(_current_tex_row) + 0.5f) * 1.57079633f / float(SKY_DOME_Y_SIZE)) );
-            const float cos_texel_alt( cosf(texel_alt) );
-            const float sin_texel_alt( sinf(texel_alt) );
-            // theta = angle between zenith and texel
-            const float theta( 1.57079633f - texel_alt );
-            // theta remapped from {0, pi} to {0, 1}
-            const float theta_0_1( theta / 1.57079633f );
+            const float theta( float(t) / float(SKY_LUT_THETA_SIZE - 1) * 1.57079633f );
+            for( int g = 0; g < SKY_LUT_GAMMA_SIZE; g++ )
+                cos_theta[g] = cosf(theta);
+
+            model->computeRadiance( SKY_LUT_GAMMA_SIZE, cos_theta, cos_gamma, R, G, B );
+            _toneMap( SKY_LUT_GAMMA_SIZE, R, G, B );
 
-            for(int i=0; i<SKY_DOME_X_SIZE; ++i)
+            for( int g = 0; g < SKY_LUT_GAMMA_SIZE; g++ )
             {
-                const float texel_azi( -1.57079633f - 
-                    (float(i) + 0.5f) * 6.28318531f / float(SKY_DOME_X_SIZE) );
-                const float cos_texel_azi( cosf(texel_azi) );
-                const float sin_texel_azi( sinf(texel_azi) );
-                osg::Vec3f texel_vec( sin_texel_azi * cos_texel_alt,
-                                      cos_texel_azi * cos_texel_alt,
-                                      sin_texel_alt );
-                // gamma = angle between sun and texel
-                const float cos_gamma( sun_vec * texel_vec );
-                const float gamma( acosf(cos_gamma) );
-                //const float cos_gamma_sq( cos_gamma * cos_gamma );
-                // gamma remapped from {0, pi} to {1, 0}
-                const float gamma_1_0( 1.0f - (gamma / 3.14159265f) );
-                // gamma_1_0 weighted such that it is larger for texels that are lower in the sky
-                // This is used for a more realistic--less circular--circumsolar glow
-                const float weighted_gamma_1_0(powf(gamma_1_0, 1.0f - theta_0_1 * 0.9f) );
-
-                // Run all this data through Preetham sky color math model
-                /*const float x( _xDistributionFunction(theta, sin_texel_alt, gamma, cos_gamma_sq) );
-                const float y( _yDistributionFunction(theta, sin_texel_alt, gamma, cos_gamma_sq) );
-                const float Y( _YDistributionFunction(theta, sin_texel_alt, gamma, cos_gamma_sq) );
-
-                // Convert xyY color space to XYZ color space
-                // Conversions from Danny Pascale, "A Review of RGB Color Spaces"
-                const float temp( Y / y );
-                const float X( x * temp );
-                const float Z( (1.0f - x - y) * temp );
-
-                // Convert XYZ color space to sRGB color space
-                float R( X *  3.2405 + -1.5371 * Y + -0.4985 * Z );
-                float G( X * -0.9693 +  1.8760 * Y +  0.0416 * Z );
-                float B( X *  0.0556 + -0.2040 * Y +  1.0572 * Z );*/
-
-                // Our home grown sky color math model
-                float R( _RedFunction(theta, theta_0_1, gamma, weighted_gamma_1_0) );
-                float G( _GreenFunction(theta, theta_0_1, gamma, weighted_gamma_1_0) );
-                float B( _BlueFunction(theta, theta_0_1, gamma, weighted_gamma_1_0) );
-                
-                // tone mapping
-                const float exposure( 5.0f );
-                const float luminance( R * 0.299f + G * 0.587f + B * 0.114f );
-                const float brightness( 1.0f - expf(-luminance * exposure) );
-                const float scale( brightness / (luminance + 0.001f) );
-                R *= scale;
-                G *= scale;
-                B *= scale;
-
-                // Clamp upper bound to 1.0
-                // No need to clamp lower bound to 0.0 because our lighting is purely additive
-                R = (R > 1.0f) ? 1.0f : R;
-                G = (G > 1.0f) ? 1.0f : G;
-                B = (B > 1.0f) ? 1.0f : B;
-                
-                *(ptr++) = (unsigned char)(R * 255.0f);
-                *(ptr++) = (unsigned char)(G * 255.0f);
-                *(ptr++) = (unsigned char)(B * 255.0f);
+                *(ptr++) = R[g];
+                *(ptr++) = G[g];
+                *(ptr++) = B[g];
             }
-            
-            _current_tex_row ++;
-        }
-        
-        if(_current_tex_row >= SKY_DOME_Y_SIZE)
-            _current_tex_row = 0;
-        
-// DANG robert.... how about some backwards compatibility... especially with versions?
-//#if (OSG_VERSION_MAJOR >= 2) && (OSG_VERSION_MINOR >= 6 )
-#if ( OPENSCENEGRAPH_MAJOR_VERSION > 2 ) || ( ( OPENSCENEGRAPH_MAJOR_VERSION >= 2 ) && ( OPENSCENEGRAPH_MINOR_VERSION >= 6 ) )
-        image->dirty();
-        _skyTexture->setImage( image );
-#else
-        _skyTexture->setImage( image );
-#endif
+        }
     }
 }
+
+void SkyDome::_updateSkyLookupSlice()
+{
+    _computeSkyLookupSlice( _skySunAltitude, _skyLookupSlice );
+}
+
+// Blend the two altitude slices of the table around the given sun altitude
+void SkyDome::_computeSkyLookupSlice( double sunAltitude, std::vector<float> &slice ) const
+{
+    const int sliceSize = SKY_LUT_THETA_SIZE * SKY_LUT_GAMMA_SIZE * 3;
+    slice.resize( sliceSize );
+
+    float fa = float((sunAltitude - SKY_LUT_MIN_ALT) / (90.0 - SKY_LUT_MIN_ALT)) * float(SKY_LUT_ALT_SIZE - 1);
+    if( fa < 0.0f )
+        fa = 0.0f;
+    int ia = int(fa);
+    if( ia > SKY_LUT_ALT_SIZE - 2 )
+        ia = SKY_LUT_ALT_SIZE - 2;
+    fa -= float(ia);
+
+    const float *s0 = &_skyLookupTable[ia * sliceSize];
+    const float *s1 = s0 + sliceSize;
+    for( int i = 0; i < sliceSize; i++ )
+        slice[i] = s0[i] + (s1[i] - s0[i]) * fa;
+}
@@ -0,0 +1,287 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#include <math.h>
+
+#include <osg/Math>
+
+#include <osgEphemeris/SkyModel.h>
+
+#include "FastMath.h"
+
+using namespace osgEphemeris;
+
+// The computeRadiance() loops below only call the inline functions of
+// FastMath.h and clamp with selects rather than branches, so that the
+// compiler vectorizes them.  The C library's acosf, powf and expf are calls
+// that may set errno, which keeps a loop scalar.
+
+SkyModel::SkyModel():
+    _T(2.0f),
+    _sunAltitude(0.0),
+    _lightDueToAltitude(0.0f)
+{
+    _updateLightDueToAltitude();
+}
+
+void SkyModel::setTurbidity( float T )
+{
+    if(T < 1.0f)
+        T = 1.0f;
+    else if(T > 60.0f)
+        T = 60.0f;
+
+    _T = T;
+    _updateTurbidity();
+}
+
+void SkyModel::setSunAltitude( double altitude )
+{
+    _sunAltitude = altitude;
+    _updateLightDueToAltitude();
+    _updateSunAltitude();
+}
+
+void SkyModel::_updateLightDueToAltitude()
+{
+    // Altitude at which total darkness occurs
+    const float dark_alt = -0.29f;
+    // How overall sky brightness varies with altitude
+    const float day_exp = 0.2f;
+
+    float light = osg::DegreesToRadians(_sunAltitude);
+    if(light < dark_alt)
+        light = 0.0f;
+    else{
+        // remap {dark_alt, pi} to {-pi, pi}
+        light = ((light - dark_alt) / (osg::PI + dark_alt)) * osg::PI_2 - osg::PI;
+        // clamp to -pi
+        light = light < -osg::PI ? -osg::PI : light;
+        // cosine of this new angle remapped to {0, 1}
+        light = cosf(light) * 0.5f + 0.5f;
+        // brighten it
+        light = powf(light, day_exp);
+    }
+    _lightDueToAltitude = light;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+WelshSkyModel::WelshSkyModel()
+{
+    _updateTurbidity();
+    _updateSunAltitude();
+}
+
+void WelshSkyModel::_updateTurbidity()
+{
+    _Ar = _T * 0.00367f + 0.09f;
+    _Br = _T * -0.08f + 6.0f;
+    _Cr = 0.5f;
+    _Dr = _T * -0.63333f + 40.0f;
+    _Er = 0.19f;
+    _horiz_atten_r = 0.0f;
+    _solar_atten_r = 0.0f;
+
+    _Ag = _T * 0.00367f + 0.11f;
+    _Bg = _T * -0.08f + 6.0f;
+    _Cg = 0.5f;
+    _Dg = _T * -0.63333f + 40.0f;
+    _Eg = 0.17f;
+    _horiz_atten_g = powf(0.2f, 1.0f + 0.1f * _T);
+    _solar_atten_g = powf(0.4f, 1.0f + 0.1f * _T);
+
+    _Ab = 0.1f;
+    _Bb = _T * -0.11f + 8.0f;
+    _Cb = 0.5f;
+    _Db = _T * -0.63333f + 40.0f;
+    _Eb = 0.4f;
+    _horiz_atten_b = powf(0.3f, 1.0f + 0.1f * _T);
+    _solar_atten_b = powf(0.6f, 1.0f + 0.1f * _T);
+}
+
+void WelshSkyModel::_updateSunAltitude()
+{
+    const float sin_theta_sun = sinf(osg::DegreesToRadians(90.0 - _sunAltitude));
+    _sunset_atten = powf(sin_theta_sun, 20.0f);
+}
+
+void WelshSkyModel::computeRadiance( unsigned int n,
+                                     const float *cosTheta, const float *cosGamma,
+                                     float *r, float *g, float *b ) const
+{
+    // Per channel terms that are constant over the batch
+    const float horiz_r = _Ar * (1.0f - _horiz_atten_r * _sunset_atten) * _lightDueToAltitude;
+    const float horiz_g = _Ag * (1.0f - _horiz_atten_g * _sunset_atten) * _lightDueToAltitude;
+    const float horiz_b = _Ab * (1.0f - _horiz_atten_b * _sunset_atten) * _lightDueToAltitude;
+    const float solar_r = _Cr * (1.0f - _solar_atten_r * _sunset_atten) * _lightDueToAltitude;
+    const float solar_g = _Cg * (1.0f - _solar_atten_g * _sunset_atten) * _lightDueToAltitude;
+    const float solar_b = _Cb * (1.0f - _solar_atten_b * _sunset_atten) * _lightDueToAltitude;
+    const float overall_r = _Er * _lightDueToAltitude;
+    const float overall_g = _Eg * _lightDueToAltitude;
+    const float overall_b = _Eb * _lightDueToAltitude;
+    // Members are copied to locals, as the stores to r, g and b could
+    // otherwise alias them and keep the loop scalar
+    const float Br = _Br, Bg = _Bg, Bb = _Bb;
+    const float Dr = _Dr, Dg = _Dg, Db = _Db;
+
+    for( unsigned int i = 0; i < n; i++ )
+    {
+        const float ct = fastMax( fastMin( cosTheta[i], 1.0f ), 0.0f );
+        const float cg = fastMax( fastMin( cosGamma[i], 1.0f ), -1.0f );
+
+        // theta remapped from {0, pi/2} to {0, 1}
+        const float theta_0_1( fastAcos(ct) * 0.63661977f );
+        // gamma remapped from {0, pi} to {1, 0}
+        const float gamma_1_0( 1.0f - fastAcos(cg) * 0.31830989f );
+        // gamma_1_0 weighted such that it is larger for texels that are lower in the sky
+        // This is used for a more realistic--less circular--circumsolar glow
+        const float weighted_gamma_1_0( fastPow(gamma_1_0, 1.0f - theta_0_1 * 0.9f) );
+
+        r[i] = horiz_r * fastPow(theta_0_1, Br) + solar_r * fastPow(weighted_gamma_1_0, Dr) + overall_r;
+        g[i] = horiz_g * fastPow(theta_0_1, Bg) + solar_g * fastPow(weighted_gamma_1_0, Dg) + overall_g;
+        b[i] = horiz_b * fastPow(theta_0_1, Bb) + solar_b * fastPow(weighted_gamma_1_0, Db) + overall_b;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+PreethamSkyModel::PreethamSkyModel()
+{
+    _updateSunAngle();
+    _updateTurbidity();
+}
+
+void PreethamSkyModel::_updateTurbidity()
+{
+    _Ax = _T * -0.0193f + -0.2592f;
+    _Bx = _T * -0.0665f +  0.0008f;
+    _Cx = _T * -0.0004f +  0.2125f;
+    _Dx = _T * -0.0641f + -0.8989f;
+    _Ex = _T * -0.0033f +  0.0452f;
+
+    _Ay = _T * -0.0167f + -0.2608f;
+    _By = _T * -0.0950f +  0.0092f;
+    _Cy = _T * -0.0079f +  0.2102f;
+    _Dy = _T * -0.0441f + -1.6537f;
+    _Ey = _T * -0.0109f +  0.0529f;
+
+    _AY = _T *  0.1787f + -1.4630f;
+    _BY = _T * -0.3554f +  0.4275f;
+    _CY = _T * -0.0227f +  5.3251f;
+    _DY = _T *  0.1206f + -2.5771f;
+    _EY = _T * -0.0670f +  0.3703f;
+
+    _updateZenithxyY();
+}
+
+void PreethamSkyModel::_updateSunAltitude()
+{
+    _updateSunAngle();
+    _updateZenithxyY();
+}
+
+void PreethamSkyModel::_updateSunAngle()
+{
+    // The zenith formulas blow up once the sun is below the horizon
+    const double altitude = _sunAltitude < 0.0 ? 0.0 : _sunAltitude;
+    _theta_sun = osg::DegreesToRadians(90.0 - altitude);
+    const float cos_theta_sun = cosf(_theta_sun);
+    _cos_theta_sun_squared = cos_theta_sun * cos_theta_sun;
+}
+
+void PreethamSkyModel::_updateZenithxyY()
+{
+    const float ths2(_theta_sun * _theta_sun);
+    const float ths3(ths2 * _theta_sun);
+    const float T2(_T * _T);
+
+    const float xz = T2 * (0.00166f * ths3 + -0.00375f * ths2 + 0.00209f * _theta_sun)
+        + _T * (-0.02903f * ths3 + 0.06377f * ths2 + -0.03202f * _theta_sun + 0.00394f)
+        + (0.11693f * ths3 + -0.21196f * ths2 + 0.06052f * _theta_sun + 0.25886f);
+
+    const float yz = T2 * (0.00275f * ths3 + -0.0061f * ths2 + 0.00317f * _theta_sun)
+        + _T * (-0.04214f * ths3 + 0.0897f * ths2 + -0.04153f * _theta_sun + 0.00516f)
+        + (0.15346f * ths3 + -0.26756f * ths2 + 0.0667f * _theta_sun + 0.26688f);
+
+    const float chi( (0.44444444f - (_T * 0.00833333f))
+        * (3.14159265f - (2.0f * _theta_sun)) );
+
+    // In kcd/m^2
+    const float Yz = (((4.0453f * _T) - 4.971f) * tanf(chi)) - (0.2155f * _T) + 2.4192f;
+
+    // Divide out the distribution function at the zenith, which is the same for
+    // every direction
+    _xz = xz / ( (1.0f + (_Ax * expf(_Bx)))
+        * (1.0f + (_Cx * expf(_Dx * _theta_sun)) + (_Ex * _cos_theta_sun_squared)) );
+    _yz = yz / ( (1.0f + (_Ay * expf(_By)))
+        * (1.0f + (_Cy * expf(_Dy * _theta_sun)) + (_Ey * _cos_theta_sun_squared)) );
+    _Yz = Yz / ( (1.0f + (_AY * expf(_BY)))
+        * (1.0f + (_CY * expf(_DY * _theta_sun)) + (_EY * _cos_theta_sun_squared)) );
+}
+
+void PreethamSkyModel::computeRadiance( unsigned int n,
+                                        const float *cosTheta, const float *cosGamma,
+                                        float *r, float *g, float *b ) const
+{
+    // Brings zenith luminance in kcd/m^2 into the range SkyDome's tone
+    // mapping expects, and darkens the sky through twilight
+    const float Yscale = 0.025f * _lightDueToAltitude;
+
+    // Members are copied to locals, as the stores to r, g and b could
+    // otherwise alias them and keep the loop scalar
+    const float xz = _xz, yz = _yz, Yz = _Yz;
+    const float Ax = _Ax, Bx = _Bx, Cx = _Cx, Dx = _Dx, Ex = _Ex;
+    const float Ay = _Ay, By = _By, Cy = _Cy, Dy = _Dy, Ey = _Ey;
+    const float AY = _AY, BY = _BY, CY = _CY, DY = _DY, EY = _EY;
+
+    for( unsigned int i = 0; i < n; i++ )
+    {
+        // Limit the zenith angle to keep exp(B/cos(theta)) finite at the horizon
+        const float ct = fastMax( cosTheta[i], 0.01f );
+        const float cg = fastMax( fastMin( cosGamma[i], 1.0f ), -1.0f );
+        const float inv_ct( 1.0f / ct );
+        const float gamma( fastAcos(cg) );
+        const float cos_gamma_sq( cg * cg );
+
+        const float x( xz * (1.0f + (Ax * fastExp(Bx * inv_ct)))
+            * (1.0f + (Cx * fastExp(Dx * gamma)) + (Ex * cos_gamma_sq)) );
+        const float y( yz * (1.0f + (Ay * fastExp(By * inv_ct)))
+            * (1.0f + (Cy * fastExp(Dy * gamma)) + (Ey * cos_gamma_sq)) );
+        const float Y( Yz * (1.0f + (AY * fastExp(BY * inv_ct)))
+            * (1.0f + (CY * fastExp(DY * gamma)) + (EY * cos_gamma_sq)) * Yscale );
+
+        // Convert xyY color space to XYZ color space
+        // Conversions from Danny Pascale, "A Review of RGB Color Spaces"
+        const float temp( Y / y );
+        const float X( x * temp );
+        const float Z( (1.0f - x - y) * temp );
+
+        // Convert XYZ color space to linear sRGB color space
+        const float R( X *  3.2405f + -1.5371f * Y + -0.4985f * Z );
+        const float G( X * -0.9693f +  1.8760f * Y +  0.0416f * Z );
+        const float B( X *  0.0556f + -0.2040f * Y +  1.0572f * Z );
+
+        r[i] = fastMax( R, 0.0f );
+        g[i] = fastMax( G, 0.0f );
+        b[i] = fastMax( B, 0.0f );
+    }
+}
@@ -19,6 +19,12 @@
  -------------------------------------------------------------------------------
  */
 
+#include <algorithm>
+#include <map>
+
+#include <OpenThreads/Mutex>
+#include <OpenThreads/ScopedLock>
+
 #include <osg/Geometry>
 #include <osgEphemeris/Sphere.h>
 
@@ -26,204 +32,297 @@ using namespace osgEphemeris;
 
 const double Sphere::_defaultRadius =     3476000.0 * 0.5; // diameter of moon * 0.5 = radius of moon
 
-Sphere::Sphere( double radius,
-        Sphere::TesselationResolution tr,
-        Sphere::Orientation orientation,
-        Sphere::Hemisphere whichHemisphere,
-        bool stc
-      )
+namespace {
+
+// Unit radius arrays and per sector primitive sets of one hemisphere
+class HemisphereGeometry : public osg::Referenced
 {
-    _skyTexCoords = stc;
+    public:
+        osg::ref_ptr<osg::Vec3Array> coords;
+        osg::ref_ptr<osg::Vec3Array> normals;
+        osg::ref_ptr<osg::Vec2Array> tcoords;
+        osg::ref_ptr<osg::Vec4Array> colors;
+        std::vector< osg::ref_ptr<osg::PrimitiveSet> > sectors;
+};
 
-    unsigned int nsectors = 4;
+typedef std::map<unsigned int, osg::ref_ptr<HemisphereGeometry> > HemisphereGeometryCache;
+
+OpenThreads::Mutex s_hemisphereGeometryCacheMutex;
+
+// There are at most a few dozen distinct hemispheres, so entries are never
+// evicted.  The cache is deliberately leaked, so that its arrays are not
+// released during static destruction after OSG's GL object managers are gone.
+// Call with s_hemisphereGeometryCacheMutex held.
+HemisphereGeometryCache &hemisphereGeometryCache()
+{
+    static HemisphereGeometryCache *cache = new HemisphereGeometryCache;
+    return *cache;
+}
+
+// The sky texture is mirrored in t about 1.0, so t runs from 0 at the zenith
+// of the northern hemisphere to 1 at the horizon and 2 at the southern nadir.
+double makeTexCoordT( double nz, bool skyTexCoords, Sphere::SkyTexCoordMapping mapping )
+{
+    if( !skyTexCoords )
+        return (0.5 + ((asin(nz))/(osg::PI)));
+
+    double a = asin(nz)/osg::PI_2;
+    if( mapping == Sphere::HorizonWeightedAltitude )
+    {
+        // 2x - x^2 has twice the texels per degree at the horizon and a finite
+        // slope there, so t interpolated linearly between rings stays close
+        // to the altitude of each fragment.
+        const double x = fabs(a);
+        const double w = 2.0 * x - x * x;
+        a = a < 0.0 ? -w : w;
+    }
+    return 1.0 + a;
+}
+
+HemisphereGeometry *buildHemisphereGeometry( Sphere::TesselationResolution tr,
+                                             Sphere::Orientation orientation,
+                                             int hemisphere,
+                                             bool skyTexCoords,
+                                             Sphere::SkyTexCoordMapping mapping )
+{
+    const unsigned int nsectors = 4;
     double latStep  = 
-        ( tr == TessHigh ) ?  1.875 :
-        ( tr == TessLow ) ?   15 : 7.5;
+        ( tr == Sphere::TessHigh ) ?  1.875 :
+        ( tr == Sphere::TessLow ) ?   15 : 7.5;
+
+    // Rings of latitude from the pole to the equator.  Each sector of a
+    // hemisphere has its own vertex at the pole and k+1 vertices on ring k,
+    // so that sectors can have their own s texture coordinates at the seam.
+    const unsigned int R = (unsigned int)(90.0/latStep + 0.5);
+    const unsigned int sectorSize = 1 + (R * (R + 3))/2;
+
+    const bool inner = (orientation == Sphere::InnerOrientation);
+    const double zsign = (hemisphere == 0) ? 1.0 : -1.0;
+    const double nsign = inner ? -1.0 : 1.0;
+    // Reversing an odd length strip reverses the winding of its triangles
+    const bool reverse = (hemisphere == 0) != inner;
 
+    HemisphereGeometry *hg = new HemisphereGeometry;
+    hg->coords = new osg::Vec3Array;
+    hg->normals = new osg::Vec3Array;
+    hg->tcoords = new osg::Vec2Array;
+    hg->colors = new osg::Vec4Array;
+    hg->coords->reserve( nsectors * sectorSize );
+    hg->normals->reserve( nsectors * sectorSize );
+    hg->tcoords->reserve( nsectors * sectorSize );
+    hg->colors->push_back( osg::Vec4( 1.0, 1.0, 1.0,1.0 ));
 
-    osg::ref_ptr<osg::Vec3Array> v = new osg::Vec3Array;
-    int R = 0;
     for( unsigned int sector = 0; sector < nsectors; sector++ )
     {
-        double off = double(sector) * 360.0/(double)(nsectors);
-        int div = 1;
+        const double off = double(sector) * 360.0/double(nsectors);
+        const double span = 360.0/double(nsectors);
 
-        v->push_back( osg::Vec3(0,0,radius));
-        for( double lat = latStep; lat <= 91.0; lat += latStep )
+        // s is the longitude of the normal over 360 degrees, running from 0
+        // to 1 within the sector that starts at the seam
+        double sbase = (off + (inner ? 180.0 : 0.0))/360.0;
+        sbase -= floor(sbase);
+        const double sspan = span/360.0;
+
+        hg->coords->push_back( osg::Vec3( 0, 0, zsign ));
+        hg->normals->push_back( osg::Vec3( 0, 0, zsign * nsign ));
+        hg->tcoords->push_back( osg::Vec2( sbase + 0.5 * sspan,
+                    makeTexCoordT( zsign * nsign, skyTexCoords, mapping )));
+
+        for( unsigned int k = 1; k <= R; k++ )
         {
-            double dd = (360.0/double(nsectors))/(double)(div);
-            for( int i = 0; i <= div; i++ ) 
-            {
-                double lon = off + double(i) * dd;
+            const double lat = osg::DegreesToRadians( double(k) * latStep );
+            const double sinLat = sin(lat);
+            const double cosLat = cos(lat) * zsign;
+            const double t = makeTexCoordT( cosLat * nsign, skyTexCoords, mapping );
 
-                double x = radius * cos(osg::DegreesToRadians(lon)) *  sin(osg::DegreesToRadians(lat));
-                double y = radius * sin(osg::DegreesToRadians(lon)) *  sin(osg::DegreesToRadians(lat));
-                double z = radius * cos(osg::DegreesToRadians(lat));
+            for( unsigned int i = 0; i <= k; i++ )
+            {
+                const double f = double(i)/double(k);
+                const double lon = osg::DegreesToRadians( off + f * span );
+                const osg::Vec3 n( cos(lon) * sinLat, sin(lon) * sinLat, cosLat );
 
-                v->push_back( osg::Vec3(x,y,z));
+                hg->coords->push_back( n );
+                hg->normals->push_back( n * nsign );
+                hg->tcoords->push_back( osg::Vec2( sbase + f * sspan, t ));
             }
-            div++;
-            if( sector == 0 )
-                R++;
         }
     }
 
-    for( int hemisphere = 0; hemisphere < 2; hemisphere++ )
+    for( unsigned int sector = 0; sector < nsectors; sector++ )
     {
-        if( !((1<<hemisphere) & whichHemisphere) )
-            continue;
+        // Strip j runs between ring j+1 and ring j, where ring 0 is the pole.
+        // The strips are joined into one with degenerate triangles, padded
+        // so that every strip starts on an even index and keeps its winding.
+        osg::ref_ptr<osg::DrawElementsUShort> strip =
+            new osg::DrawElementsUShort( osg::PrimitiveSet::TRIANGLE_STRIP );
+        strip->reserve( R * R + 5 * R );
 
-        osg::Geode *geode = new osg::Geode;
+        const unsigned int base = sector * sectorSize;
+        std::vector<unsigned short> s;
+        s.reserve( 2 * R + 1 );
+        for( unsigned int j = 0; j < R; j++ )
+        {
+            const unsigned int innerRing = (j == 0) ? base : base + 1 + ((j - 1) * (j + 2))/2;
+            const unsigned int outerRing = base + 1 + (j * (j + 3))/2;
+
+            s.clear();
+            for( unsigned int i = 0; i <= j; i++ )
+            {
+                s.push_back( (unsigned short)(outerRing + i) );
+                s.push_back( (unsigned short)(innerRing + i) );
+            }
+            s.push_back( (unsigned short)(outerRing + j + 1) );
 
-        int iii = 0;
-        osg::ref_ptr<osg::Vec3Array> coords = new osg::Vec3Array;
-        osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array;
-        osg::ref_ptr<osg::Vec2Array> tcoords = new osg::Vec2Array;
+            if( reverse )
+                std::reverse( s.begin(), s.end() );
 
-        for( unsigned int sector = 0; sector < nsectors; sector++ )
-        {
-            int len = 3;
-            int ii[] = { 1, 0 };
-            int toggle = 0;
-    
-            for( int j = 0; j < R; j++ )
+            if( j > 0 )
             {
-                osg::ref_ptr<osg::Vec3Array> tarray = new osg::Vec3Array;
-
-                for( int i = 0; i < len; i++ )
-                {
-                    int index = iii + ii[toggle];
-                    tarray->push_back( (*v)[index] );
-                    ii[toggle]++;
-                    toggle = 1 - toggle;
-                }
-
-                if( hemisphere == 0 )
-                {
-                    if( orientation == InnerOrientation )
-                    {
-                        for( unsigned int n = 0; n < tarray->size(); n++ )
-                        {
-                            osg::Vec3 v = (*tarray)[n];
-                            coords->push_back( v );
-                            v.normalize();
-                            v *= -1;
-                            normals->push_back( v );
-                            tcoords->push_back( makeTexCoord(v, sector) );
-                        }
-                    }
-                    else
-                    {
-                        for( int n = tarray->size() - 1; n >= 0 ; n-- )
-                        {
-                            osg::Vec3 v = (*tarray)[n];
-                            coords->push_back( v );
-                            v.normalize();
-                            normals->push_back( v );
-                            tcoords->push_back( makeTexCoord(v, sector) );
-                        }
-                    }
-                }
-                else
-                {
-                    if( orientation == InnerOrientation )
-                    {
-                        for( int n = tarray->size() - 1; n >= 0 ; n-- )
-                        {
-                            osg::Vec3 v = (*tarray)[n];
-                            v[2] *= -1.0;
-                            coords->push_back( v );
-                            v.normalize();
-                            v *= -1;
-                            normals->push_back( v );
-                            tcoords->push_back( makeTexCoord(v, sector) );
-                        }
-                    }
-                    else
-                    {
-                        for( unsigned int n = 0; n < tarray->size(); n++ )
-                        {
-                            osg::Vec3 v = (*tarray)[n];
-                            v[2] *= -1.0;
-                            coords->push_back( v );
-                            v.normalize();
-                            normals->push_back( v );
-                            tcoords->push_back( makeTexCoord(v, sector) );
-                        }
-                    }
-                }
-    
-                toggle = 1 - toggle;
-                len += 2;
+                strip->push_back( strip->back() );
+                strip->push_back( s.front() );
+                strip->push_back( s.front() );
             }
-            iii += ii[0];
-    
+            strip->insert( strip->end(), s.begin(), s.end() );
         }
 
-        int index = 0;
-        for( unsigned int sector = 0; sector < nsectors; sector++ )
-        {
-            osg::ref_ptr<osg::Vec4Array> colors = new osg::Vec4Array;
-            colors->push_back( osg::Vec4( 1.0, 1.0, 1.0,1.0 ));
+        hg->sectors.push_back( strip.get() );
+    }
 
-            osg::ref_ptr<osg::Geometry> geometry = new osg::Geometry;
-            geometry->setVertexArray( coords.get() );
-            geometry->setTexCoordArray( 0, tcoords.get() );
-            geometry->setNormalArray( normals.get() );
-            geometry->setNormalBinding( osg::Geometry::BIND_PER_VERTEX );
-            geometry->setColorArray( colors.get() );
-            geometry->setColorBinding( osg::Geometry::BIND_OVERALL );
+    return hg;
+}
 
+HemisphereGeometry *getHemisphereGeometry( Sphere::TesselationResolution tr,
+                                           Sphere::Orientation orientation,
+                                           int hemisphere,
+                                           bool skyTexCoords,
+                                           Sphere::SkyTexCoordMapping mapping )
+{
+    // Texture coordinate mapping only matters for sky texture coordinates
+    if( !skyTexCoords )
+        mapping = Sphere::LinearAltitude;
 
-            int len = 3;
-            for( int i = 0; i < R; i++ )
-            {
-                geometry->addPrimitiveSet( new osg::DrawArrays(osg::PrimitiveSet::TRIANGLE_STRIP, index, len ));
-                index += len;
-                len += 2;
-            }
+    const unsigned int key = (unsigned int)tr
+                           | ((unsigned int)orientation << 2)
+                           | ((unsigned int)hemisphere << 3)
+                           | ((skyTexCoords ? 1u : 0u) << 4)
+                           | ((unsigned int)mapping << 5);
 
-            geode->addDrawable( geometry.get() );
-        }
+    OpenThreads::ScopedLock<OpenThreads::Mutex> lock( s_hemisphereGeometryCacheMutex );
+    osg::ref_ptr<HemisphereGeometry> &hg = hemisphereGeometryCache()[key];
+    if( !hg.valid() )
+        hg = buildHemisphereGeometry( tr, orientation, hemisphere, skyTexCoords, mapping );
+    return hg.get();
+}
+
+}
+
+Sphere::Sphere( double radius,
+        Sphere::TesselationResolution tr,
+        Sphere::Orientation orientation,
+        Sphere::Hemisphere whichHemisphere,
+        bool stc
+      ):
+    _skyTexCoordMapping(LinearAltitude),
+    _tesselation(tr),
+    _orientation(orientation)
+{
+    _skyTexCoords = stc;
+
+    // Shared geometry is unit radius.  The scale is uniform, so normals only
+    // need rescaling, not renormalizing.
+    _radiusTransform = new osg::MatrixTransform;
+    _radiusTransform->setMatrix( osg::Matrix::scale( radius, radius, radius ));
+    _radiusTransform->getOrCreateStateSet()->setMode( GL_RESCALE_NORMAL, osg::StateAttribute::ON );
+    addChild( _radiusTransform.get() );
 
-        //geode->addDrawable( geometry.get() );
+    const unsigned int nsectors = 4;
+    for( int hemisphere = 0; hemisphere < 2; hemisphere++ )
+    {
+        if( !((1<<hemisphere) & whichHemisphere) )
+            continue;
+
+        osg::Geode *geode = new osg::Geode;
+        for( unsigned int sector = 0; sector < nsectors; sector++ )
+            geode->addDrawable( new osg::Geometry );
+        _applySharedGeometry( geode, hemisphere );
 
         if( hemisphere == 0 )
-        {
             _northernHemisphere = geode;
-            addChild( _northernHemisphere.get() );
-        }
         else
-        {
             _southernHemisphere = geode;
-            addChild( _southernHemisphere.get() );
-        }
+        _radiusTransform->addChild( geode );
     }
 }
 
 osg::Vec2 Sphere::makeTexCoord(osg::Vec3 &normal, unsigned int sector)
 {
-    double s = 0.0;
+    double a = atan2( normal[1], normal[0] );
+    if( a < 0.0 )
+        a += osg::PI*2;
+    a /= (2*osg::PI);
+
+    // Prevent wrapping of texcoord, which creates ugly seam
+    if(sector == 2 && a > 0.999)
+        a = 0.0;
+
+    return osg::Vec2( a, makeTexCoordT( normal[2], _skyTexCoords, _skyTexCoordMapping ));
+}
+
+// Point this Sphere's per sector Geometry objects at the shared arrays
+void Sphere::_applySharedGeometry( osg::Geode *geode, int hemisphere )
+{
+    HemisphereGeometry *hg = getHemisphereGeometry( _tesselation, _orientation, hemisphere,
+                                                    _skyTexCoords, _skyTexCoordMapping );
+
+    for( unsigned int sector = 0; sector < geode->getNumDrawables(); sector++ )
     {
-        double a = atan2( normal[1], normal[0] );
-        if( a < 0.0 )
-            a += osg::PI*2;
-        a /= (2*osg::PI);
-        
-        // Prevent wrapping of texcoord, which creates ugly seam
-        if(sector == 2 && a > 0.999)
-            a = 0.0;
-        
-        s = a;
+        osg::Geometry *geometry = dynamic_cast<osg::Geometry *>(geode->getDrawable(sector));
+        if( geometry == NULL || sector >= hg->sectors.size() )
+            continue;
+
+        geometry->setVertexArray( hg->coords.get() );
+        geometry->setTexCoordArray( 0, hg->tcoords.get() );
+        geometry->setNormalArray( hg->normals.get() );
+        geometry->setNormalBinding( osg::Geometry::BIND_PER_VERTEX );
+        geometry->setColorArray( hg->colors.get() );
+        geometry->setColorBinding( osg::Geometry::BIND_OVERALL );
+
+        if( geometry->getNumPrimitiveSets() > 0 )
+            geometry->removePrimitiveSet( 0, geometry->getNumPrimitiveSets() );
+        geometry->addPrimitiveSet( hg->sectors[sector].get() );
+
+        geometry->dirtyDisplayList();
+        geometry->dirtyBound();
     }
+}
+
+void Sphere::setSkyTexCoordMapping( SkyTexCoordMapping mapping )
+{
+    if( mapping == _skyTexCoordMapping )
+        return;
+
+    _skyTexCoordMapping = mapping;
 
-    double t;
     if( _skyTexCoords )
-        t = (1.0 + ((asin(normal[2]))/(osg::PI_2)));
-    else
-        t = (0.5 + ((asin(normal[2]))/(osg::PI)));
+    {
+        if( _northernHemisphere.valid() )
+            _applySharedGeometry( _northernHemisphere.get(), 0 );
+        if( _southernHemisphere.valid() )
+            _applySharedGeometry( _southernHemisphere.get(), 1 );
+    }
+}
+
+void Sphere::setTesselation( TesselationResolution tr )
+{
+    if( tr == _tesselation )
+        return;
+
+    _tesselation = tr;
 
-    return osg::Vec2( s, t );
+    if( _northernHemisphere.valid() )
+        _applySharedGeometry( _northernHemisphere.get(), 0 );
+    if( _southernHemisphere.valid() )
+        _applySharedGeometry( _southernHemisphere.get(), 1 );
 }
 
 double Sphere::getDefaultRadius() 
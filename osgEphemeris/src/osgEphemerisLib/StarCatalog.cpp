@@ -0,0 +1,164 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#include <osgEphemeris/StarCatalog.h>
+
+#include "MappedFile.h"
+
+using namespace osgEphemeris;
+
+const char StarCatalog::_magic[8] = { 'O', 'S', 'G', 'E', 'S', 'T', 'A', 'R' };
+
+StarCatalog::StarCatalog( const std::string &fileName ):
+    _start(0L),
+    _length(0),
+    _numStars(0),
+    _records(0L),
+    _nameOffsets(0L),
+    _names(0L),
+    _namesLength(0)
+{
+    if( !mapFile( fileName, sizeof(StarCatalogHeader), _start, _length ))
+        return;
+
+    const StarCatalogHeader *header = (const StarCatalogHeader *)_start;
+    if( memcmp( header->magic, _magic, sizeof(_magic) ) != 0 ||
+        header->byteOrder != 0x01020304 ||
+        header->version < 1 || header->version > Version ||
+        header->recordSize != sizeof(StarCatalogRecord) ||
+        (_length - sizeof(StarCatalogHeader)) / sizeof(StarCatalogRecord) < header->numStars )
+    {
+        std::cerr << "StarCatalog: \"" << fileName << "\" is not a binary star catalog of version "
+                  << Version << " or earlier for this platform." << std::endl;
+        return;
+    }
+
+    _numStars = header->numStars;
+    _records = (const StarCatalogRecord *)(header + 1);
+
+    if( header->version >= 2 )
+    {
+        // The offsets of each name are checked when it is looked up
+        const size_t tableStart = sizeof(StarCatalogHeader) + size_t(_numStars) * sizeof(StarCatalogRecord);
+        const size_t tableSize = (size_t(_numStars) + 1) * sizeof(uint32_t);
+        if( _length < tableStart || (_length - tableStart) < tableSize )
+        {
+            std::cerr << "StarCatalog: the star names of \"" << fileName << "\" are truncated." << std::endl;
+            return;
+        }
+        _nameOffsets = (const uint32_t *)((const char *)_start + tableStart);
+        _names = (const char *)_start + tableStart + tableSize;
+        _namesLength = _length - tableStart - tableSize;
+    }
+}
+
+StarCatalog::~StarCatalog()
+{
+    unmapFile( _start, _length );
+}
+
+bool StarCatalog::isStarCatalogFile( const std::string &fileName )
+{
+    char magic[sizeof(_magic)];
+    std::ifstream in( fileName.c_str(), std::ios::in | std::ios::binary );
+    if( !in || !in.read( magic, sizeof(magic) ))
+        return false;
+    return memcmp( magic, _magic, sizeof(_magic) ) == 0;
+}
+
+std::string StarCatalog::getStarName( unsigned int star ) const
+{
+    if( _nameOffsets == 0L || star >= _numStars )
+        return std::string();
+
+    const uint32_t first = _nameOffsets[star];
+    const uint32_t end = _nameOffsets[star + 1];
+    if( first > end || end > _namesLength )
+        return std::string();
+    return std::string( _names + first, _names + end );
+}
+
+// Orders the indices of records by magnitude
+struct BrighterIndex
+{
+    BrighterIndex( const std::vector<StarCatalogRecord> &records ): _records(records) {}
+    bool operator()( unsigned int a, unsigned int b ) const
+    {
+        return _records[a].magnitude < _records[b].magnitude;
+    }
+    const std::vector<StarCatalogRecord> &_records;
+};
+
+bool StarCatalog::write( const std::string &fileName, const std::vector<StarCatalogRecord> &records,
+                         const std::vector<std::string> &names )
+{
+    if( !names.empty() && names.size() != records.size() )
+    {
+        std::cerr << "StarCatalog: " << names.size() << " names given for "
+                  << records.size() << " stars." << std::endl;
+        return false;
+    }
+
+    std::vector<unsigned int> order( records.size() );
+    for( unsigned int i = 0; i < order.size(); i++ )
+        order[i] = i;
+    std::stable_sort( order.begin(), order.end(), BrighterIndex( records ));
+
+    std::vector<StarCatalogRecord> sorted( records.size() );
+    std::vector<uint32_t> nameOffsets( records.size() + 1, 0 );
+    std::string nameChars;
+    for( unsigned int i = 0; i < order.size(); i++ )
+    {
+        sorted[i] = records[order[i]];
+        if( !names.empty() )
+            nameChars += names[order[i]];
+        nameOffsets[i + 1] = nameChars.size();
+    }
+
+    StarCatalogHeader header;
+    memcpy( header.magic, _magic, sizeof(_magic) );
+    header.byteOrder = 0x01020304;
+    header.version = Version;
+    header.numStars = sorted.size();
+    header.recordSize = sizeof(StarCatalogRecord);
+
+    std::ofstream out( fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+    if( !out )
+    {
+        std::cerr << "StarCatalog: unable to open \"" << fileName << "\" for writing." << std::endl;
+        return false;
+    }
+
+    out.write( (const char *)&header, sizeof(header) );
+    if( !sorted.empty() )
+        out.write( (const char *)&sorted.front(), sorted.size() * sizeof(StarCatalogRecord) );
+    out.write( (const char *)&nameOffsets.front(), nameOffsets.size() * sizeof(uint32_t) );
+    if( !nameChars.empty() )
+        out.write( nameChars.data(), nameChars.size() );
+    return out.good();
+}
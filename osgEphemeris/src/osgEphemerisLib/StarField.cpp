@@ -19,110 +19,173 @@
  -------------------------------------------------------------------------------
  */
 
+#include <algorithm>
 #include <iostream>
-#include <osgText/Text>
 #include <osg/Geometry>
 #include <osg/StateSet>
 #include <osg/Texture1D>
 #include <osg/Point>
 #include <osg/ClipPlane>
 #include <osgUtil/CullVisitor>
+#include <OpenThreads/ScopedLock>
 
 #include <osgEphemeris/StarField.h>
+#include <osgEphemeris/StarCatalog.h>
 #include <osgEphemeris/SkyDome.h>
 
 #include <osg/Version>
 
+using namespace osgEphemeris;
+
+// The default star field, sorted brightest first.  It is compiled in as
+// records, so building it needs no parsing.
+static const StarCatalogRecord defaultStars[] = {
+#define STAR( name, right_ascension, declination, magnitude ) \
+    { float(right_ascension), float(declination), float(magnitude), 0.0f },
 #include "star_data.h"
+#undef STAR
+};
 
-using namespace osgEphemeris;
+static const char *defaultStarNames[] = {
+#define STAR( name, right_ascension, declination, magnitude ) name,
+#include "star_data.h"
+#undef STAR
+};
 
 const double StarField::_defaultRadius = SkyDome::getMeanDistanceToMoon() * 1.1;
+const unsigned int StarField::_starsPerTile = 2048;
+const double StarField::_referenceFieldOfView = 45.0;
+const double StarField::_nightLimitingMagnitude = 6.5;
+const double StarField::_twilightLimitingMagnitude = -1.0;
 
 StarField::StarField( const std::string &fileName, double radius ):
-    _radius(radius)
+    _radius(radius),
+    _brightestMagnitude(0.0f),
+    _sunLimitingMagnitude(_nightLimitingMagnitude),
+    _defaultStarField(false),
+    _records(0L),
+    _numRecords(0)
 {
-    if( fileName.empty() || _parseFile( fileName ) == false )
+    // Binary catalogs are mapped and go straight to the vertex arrays
+    const bool binary = !fileName.empty() && StarCatalog::isStarCatalogFile( fileName );
+    if( binary )
     {
-        if( !fileName.empty() )
-            std::cerr << "Warning.. unable to use star field defined in file \"" << fileName << "\".  Using default star field." << std::endl;
-        /*
-         * can't use this method for Winders, because... well, you guessed it.
-         * Previously, star_data was:
-         *
-         *   static const char *star_data = 
-         *       "Sirius,1.767793,-0.291751,-1.46\n"
-         *       "Canopus,1.675305,-0.919716,-0.72\n"
-         *       "Arcturus,3.733528,0.334798,-0.04\n"
-         *       ...
-         *       ;
-
-        std::stringstream ss(star_data);
-        _parseStream( ss );
-        */
-
-        for( const char **sptr = star_data; *sptr; sptr++ )
+        osg::ref_ptr<StarCatalog> catalog = new StarCatalog( fileName );
+        if( catalog->valid() )
         {
-            std::stringstream ss(*sptr);
-            _stars.push_back( StarData(ss) );
+            _catalog = catalog;
+            _records = catalog->getStars();
+            _numRecords = catalog->getNumStars();
+            _buildGeometry( _records, _numRecords );
+            return;
         }
     }
+    else if( !fileName.empty() && _parseFile( fileName ) )
+    {
+        // Brightest first, so that the brightest stars are a prefix of the geometry
+        std::stable_sort( _stars.begin(), _stars.end() );
+
+        // _stars is kept for the labels
+        _buildGeometry();
+        return;
+    }
 
-    _buildGeometry();
-    //_buildLabels();
-    // We will need this if we need to rebuild the labels
-    //_stars.clear();
+    if( !fileName.empty() )
+        std::cerr << "Warning.. unable to use star field defined in file \"" << fileName << "\".  Using default star field." << std::endl;
+
+    _records = defaultStars;
+    _numRecords = sizeof(defaultStars)/sizeof(defaultStars[0]);
+    _buildGeometry( _records, _numRecords );
+    _defaultStarField = true;
 }
 
-static inline osg::ref_ptr<osgText::Text> makeText( const std::string &textString, osg::Vec3 pos )
+// Label the brightest stars, and Polaris
+static void addStarLabel( LabelBatch *labels, const std::string &name,
+                          double ra, double dc, double magnitude, double radius )
 {
-    osg::ref_ptr<osgText::Text> text = new osgText::Text;
-    text->setFont( "fonts/arial.ttf" );
-    text->setFontResolution( 252, 252 );
-    text->setAlignment( osgText::Text::LEFT_BOTTOM );
-    text->setAutoRotateToScreen( true );
-    text->setCharacterSizeMode( osgText::Text::SCREEN_COORDS );
-    text->setColor( osg::Vec4( 1, 1, 0, 1 ));
-    text->setText( textString );
-    text->setCharacterSize( 25.0 );
-    text->setPosition( pos );
-
-    return text;
+    if( magnitude < 1.8 || name == "Polaris" )
+    {
+        osg::Vec3 pos = osg::Vec3(0,radius,0) *
+                            osg::Matrix::rotate( dc, 1, 0, 0 ) *
+                            osg::Matrix::rotate( ra, 0, 0, 1 );
+
+        labels->addLabel( name, pos, 25.0f, osg::Vec4( 1, 1, 0, 1 ));
+    }
 }
 
 void StarField::_buildLabels()
 {
-    _starLabelsGeode = new osg::Geode;
+    _starLabels = new LabelBatch;
+
     std::vector<StarData>::iterator p;
     for( p = _stars.begin(); p != _stars.end(); p++ )
+        addStarLabel( _starLabels.get(), p->name, p->right_ascension, p->declination, p->magnitude, _radius );
+
+    if( _defaultStarField )
+    {
+        for( unsigned int i = 0; i < sizeof(defaultStars)/sizeof(defaultStars[0]); i++ )
+            addStarLabel( _starLabels.get(), defaultStarNames[i], defaultStars[i].rightAscension,
+                          defaultStars[i].declination, defaultStars[i].magnitude, _radius );
+    }
+    else if( _catalog.valid() )
     {
-        if( p->magnitude < 1.8 || p->name == "Polaris" )
+        if( !_catalog->hasStarNames() )
         {
-            double ra = p->right_ascension;
-            double dc = p->declination;
-
-            osg::Vec3 pos = osg::Vec3(0,_radius,0) *
-                                osg::Matrix::rotate( dc, 1, 0, 0 ) *
-                                osg::Matrix::rotate( ra, 0, 0, 1 );
-
-            _starLabelsGeode->addDrawable( makeText( p->name, pos ).get());
+            std::cerr << "StarField: the binary star catalog has no star names, so no star labels are shown.  "
+                         "Rebuild it with makeStarCatalog to include them." << std::endl;
+            return;
         }
+
+        for( unsigned int i = 0; i < _numRecords; i++ )
+            addStarLabel( _starLabels.get(), _catalog->getStarName( i ), _records[i].rightAscension,
+                          _records[i].declination, _records[i].magnitude, _radius );
     }
+}
 
-    addChild( _starLabelsGeode.get() );
+void StarField::setStarLabels( bool flag )
+{
+    if( flag == getStarLabels() )
+        return;
+
+    if( flag )
+    {
+        if( !_starLabels.valid() )
+            _buildLabels();
+        addChild( _starLabels.get() );
+    }
+    else
+        removeChild( _starLabels.get() );
 }
 
+bool StarField::getStarLabels() const
+{
+    return _starLabels.valid() && containsNode( _starLabels.get() );
+}
 
 std::string StarField::_vertexShaderProgram = 
     "uniform float starAlpha;"
     "uniform float pointSize;"
+    "uniform float starRadius;"
     "varying vec4 starColor;"
     "void main()"
     "{"
-    "    starColor = gl_Color - 1.0 + starAlpha;"
+    // Octahedral encoded unit direction
+    "    vec2 e = gl_Vertex.xy / 32767.0;"
+    "    vec3 n = vec3( e, 1.0 - abs(e.x) - abs(e.y) );"
+    "    if( n.z < 0.0 )"
+    "        n.xy = (1.0 - abs(n.yx)) * vec2( n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0 );"
+    "    vec4 vertex = vec4( normalize(n) * starRadius, 1.0 );"
+    // Quantized magnitude and B-V colour index
+    "    float magnitude = gl_Color.r * 255.0 / 16.0 - 2.0;"
+    "    float colorIndex = gl_Color.g * 255.0 / 100.0 - 0.4;"
+    "    vec3 tint = mix( vec3(0.65, 0.75, 1.0), vec3(1.0), smoothstep( -0.4, 0.0, colorIndex ));"
+    "    tint = mix( tint, vec3(1.0, 0.85, 0.6), smoothstep( 0.0, 1.0, colorIndex ));"
+    "    tint = mix( tint, vec3(1.0, 0.6, 0.4), smoothstep( 1.0, 2.0, colorIndex ));"
+    "    float c = 1.0 - magnitude/8.0;"
+    "    starColor = vec4( tint * c - 1.0 + starAlpha, starAlpha );"
     "    gl_PointSize = pointSize;"
-    "    gl_ClipVertex = gl_ModelViewMatrix * gl_Vertex;"
-    "    gl_Position = ftransform();"
+    "    gl_ClipVertex = gl_ModelViewMatrix * vertex;"
+    "    gl_Position = gl_ModelViewProjectionMatrix * vertex;"
     "}"
     ;
 
@@ -168,28 +231,270 @@ class UPCB : public osg::NodeCallback
 
 void StarField::_buildGeometry()
 {
-    osg::ref_ptr<osg::Vec3Array> coords = new osg::Vec3Array;
-    osg::ref_ptr<osg::Vec4Array> colors = new osg::Vec4Array;
+    std::vector<osg::Vec3> directions;
+    std::vector<float> colorIndices;
+    directions.reserve( _stars.size() );
+    colorIndices.reserve( _stars.size() );
+    _magnitudes.reserve( _stars.size() );
 
     std::vector<StarData>::iterator p;
     for( p = _stars.begin(); p != _stars.end(); p++ )
     {
-        osg::Vec3 v = osg::Vec3(0,_radius,0) * 
+        osg::Vec3 v = osg::Vec3(0,1,0) * 
                         osg::Matrix::rotate( p->declination, 1, 0, 0 ) * 
                         osg::Matrix::rotate( p->right_ascension, 0, 0, 1 );
 
+        directions.push_back( v );
+        colorIndices.push_back( p->color_index );
+        _magnitudes.push_back( p->magnitude );
+    }
+
+    _buildStarGeode( directions, colorIndices );
+}
+
+// The rotation of (0,1,0) by declination about X, then by right ascension
+// about Z, as in _buildGeometry() above
+static osg::Vec3 starDirection( double rightAscension, double declination )
+{
+    const double r = cos( declination );
+    return osg::Vec3( -r * sin( rightAscension ),
+                       r * cos( rightAscension ),
+                       sin( declination ));
+}
 
-        coords->push_back( v );
+void StarField::_buildGeometry( const StarCatalogRecord *stars, unsigned int n )
+{
+    std::vector<osg::Vec3> directions( n );
+    std::vector<float> colorIndices( n );
+    _magnitudes.resize( n );
 
-        double c = 1.0 - (p->magnitude/8.0);
-        colors->push_back(osg::Vec4 (c,c,c,1.0));
+    for( unsigned int i = 0; i < n; i++ )
+    {
+        directions[i] = starDirection( stars[i].rightAscension, stars[i].declination );
+        colorIndices[i] = stars[i].colorIndex;
+        _magnitudes[i] = stars[i].magnitude;
     }
 
-    osg::ref_ptr<osg::Geometry> geometry = new osg::Geometry;
-    geometry->setVertexArray( coords.get() );
-    geometry->setColorArray( colors.get() );
+    _buildStarGeode( directions, colorIndices );
+}
+
+// Star vertices are packed in 8 bytes.  The unit direction is octahedral
+// encoded in two shorts of the vertex array, and scaled to the star field 
+// radius in the vertex shader.  The magnitude and B-V colour index are
+// quantized to the first two bytes of the colour array.
+static osg::Vec2s packDirection( const osg::Vec3 &v )
+{
+    const float l = fabsf(v.x()) + fabsf(v.y()) + fabsf(v.z());
+    float x = l > 0.0f ? v.x()/l : 0.0f;
+    float y = l > 0.0f ? v.y()/l : 0.0f;
+    if( v.z() < 0.0f )
+    {
+        const float fx = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        const float fy = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = fx;
+        y = fy;
+    }
+    return osg::Vec2s( (short)floorf( x * 32767.0f + 0.5f ), (short)floorf( y * 32767.0f + 0.5f ));
+}
+
+static osg::Vec3 unpackDirection( const osg::Vec2s &e )
+{
+    const float x = e[0] / 32767.0f;
+    const float y = e[1] / 32767.0f;
+    osg::Vec3 v( x, y, 1.0f - fabsf(x) - fabsf(y) );
+    if( v.z() < 0.0f )
+    {
+        v.x() = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        v.y() = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+    }
+    v.normalize();
+    return v;
+}
+
+static unsigned char packByte( float value, float offset, float scale )
+{
+    const float b = floorf( (value + offset) * scale + 0.5f );
+    return (unsigned char)(b < 0.0f ? 0.0f : (b > 255.0f ? 255.0f : b));
+}
+
+// Magnitudes from -2 to 14 in steps of 1/16
+static unsigned char packMagnitude( float magnitude )
+{
+    return packByte( magnitude, 2.0f, 16.0f );
+}
+
+// B-V colour indices from -0.4 to 2.15 in steps of 0.01
+static unsigned char packColorIndex( float colorIndex )
+{
+    return packByte( colorIndex, 0.4f, 100.0f );
+}
+
+// The packed vertices say nothing of the position of a tile, so its bound is
+// kept from the unpacked directions
+class StarTileBound : public osg::Drawable::ComputeBoundingBoxCallback
+{
+    public:
+        StarTileBound( const osg::BoundingBox &bb ): _bb(bb) {}
+
+        virtual osg::BoundingBox computeBound( const osg::Drawable & ) const { return _bb; }
+
+    private:
+        osg::BoundingBox _bb;
+};
+
+// A geometry drawing the first count stars of a tile, sharing its arrays
+static osg::Geometry *makeStarPrefix( osg::Geometry *tile, unsigned int count )
+{
+    osg::Geometry *geometry = new osg::Geometry;
+    geometry->setVertexArray( tile->getVertexArray() );
+    geometry->setColorArray( tile->getColorArray() );
     geometry->setColorBinding(osg::Geometry::BIND_PER_VERTEX);
-    geometry->addPrimitiveSet( new osg::DrawArrays(osg::PrimitiveSet::POINTS, 0, coords->size()));
+    geometry->addPrimitiveSet( new osg::DrawArrays(osg::PrimitiveSet::POINTS, 0, count));
+    geometry->setComputeBoundingBoxCallback( tile->getComputeBoundingBoxCallback() );
+    return geometry;
+}
+
+// Index of the cube face tile, on a res x res grid per face, that the
+// direction v falls in
+static unsigned int starTile( const osg::Vec3 &v, unsigned int res )
+{
+    const float ax = fabsf(v.x());
+    const float ay = fabsf(v.y());
+    const float az = fabsf(v.z());
+
+    unsigned int face;
+    float u, w, m;
+    if( ax >= ay && ax >= az )
+    {
+        face = v.x() < 0.0f ? 1 : 0;
+        u = v.y(); w = v.z(); m = ax;
+    }
+    else if( ay >= az )
+    {
+        face = v.y() < 0.0f ? 3 : 2;
+        u = v.x(); w = v.z(); m = ay;
+    }
+    else
+    {
+        face = v.z() < 0.0f ? 5 : 4;
+        u = v.x(); w = v.y(); m = az;
+    }
+
+    if( m <= 0.0f )
+        return 0;
+
+    unsigned int i = (unsigned int)((u/m + 1.0f) * 0.5f * res);
+    unsigned int j = (unsigned int)((w/m + 1.0f) * 0.5f * res);
+    if( i >= res ) i = res - 1;
+    if( j >= res ) j = res - 1;
+
+    return (face * res + j) * res + i;
+}
+
+void StarField::_buildStarGeode( const std::vector<osg::Vec3> &directions, const std::vector<float> &colorIndices )
+{
+    // Partition the stars into cube face tiles, with one drawable per tile
+    // so that tiles outside the view frustum are culled.  The input is
+    // sorted brightest first and the partition is stable, so each tile is
+    // also sorted brightest first and can be drawn as a brightness limited
+    // prefix.
+    const unsigned int n = directions.size();
+    unsigned int res = 1;
+    while( 6 * res * res * _starsPerTile < n )
+        res++;
+    const unsigned int numTiles = 6 * res * res;
+
+    std::vector<unsigned int> tiles( n );
+    std::vector<unsigned int> first( numTiles + 1, 0 );
+    for( unsigned int i = 0; i < n; i++ )
+    {
+        tiles[i] = starTile( directions[i], res );
+        first[tiles[i] + 1]++;
+    }
+    for( unsigned int t = 0; t < numTiles; t++ )
+        first[t + 1] += first[t];
+
+    std::vector<unsigned int> order( n );
+    std::vector<unsigned int> next( first.begin(), first.end() - 1 );
+    for( unsigned int i = 0; i < n; i++ )
+        order[next[tiles[i]]++] = i;
+
+    std::vector<float> magnitudes( n );
+    for( unsigned int i = 0; i < n; i++ )
+        magnitudes[i] = _magnitudes[order[i]];
+    _magnitudes.swap( magnitudes );
+
+    _starGeode = new osg::Geode;
+    _tileOffsets.clear();
+    for( unsigned int t = 0; t < numTiles; t++ )
+    {
+        const unsigned int count = first[t + 1] - first[t];
+        if( count == 0 )
+            continue;
+
+        osg::ref_ptr<osg::Vec2sArray> tileCoords = new osg::Vec2sArray( count );
+        osg::ref_ptr<osg::Vec4ubArray> tileColors = new osg::Vec4ubArray( count );
+        osg::BoundingBox bb;
+        for( unsigned int i = 0; i < count; i++ )
+        {
+            const unsigned int star = order[first[t] + i];
+            (*tileCoords)[i] = packDirection( directions[star] );
+            (*tileColors)[i] = osg::Vec4ub( packMagnitude( _magnitudes[first[t] + i] ),
+                                            packColorIndex( colorIndices[star] ), 0, 255 );
+            bb.expandBy( unpackDirection( (*tileCoords)[i] ) * _radius );
+        }
+
+        osg::ref_ptr<osg::Geometry> geometry = new osg::Geometry;
+        geometry->setVertexArray( tileCoords.get() );
+        geometry->setColorArray( tileColors.get() );
+        geometry->setColorBinding(osg::Geometry::BIND_PER_VERTEX);
+        geometry->addPrimitiveSet( new osg::DrawArrays(osg::PrimitiveSet::POINTS, 0, count));
+        geometry->setComputeBoundingBoxCallback( new StarTileBound( bb ));
+
+        _starGeode->addDrawable( geometry.get() );
+        _tileOffsets.push_back( first[t] );
+    }
+    _tileOffsets.push_back( n );
+
+    // Brightness limited levels of the star field, one per whole magnitude,
+    // each drawing a prefix of every tile.  The last level is the whole star
+    // field.  A level is only added if it draws more stars than the last.
+    _starLevels.clear();
+    _starLevelMagnitudes.clear();
+    if( n > 0 )
+    {
+        const float brightest = *std::min_element( _magnitudes.begin(), _magnitudes.end() );
+        const float faintest  = *std::max_element( _magnitudes.begin(), _magnitudes.end() );
+        unsigned int lastTotal = 0;
+        for( float m = floorf(brightest) + 1.0f; m < faintest; m += 1.0f )
+        {
+            osg::ref_ptr<osg::Geode> level = new osg::Geode;
+            unsigned int total = 0;
+            for( unsigned int t = 0; t < _starGeode->getNumDrawables(); t++ )
+            {
+                unsigned int count = 0;
+                while( _tileOffsets[t] + count < _tileOffsets[t + 1] &&
+                       _magnitudes[_tileOffsets[t] + count] <= m )
+                    count++;
+                if( count == 0 )
+                    continue;
+
+                osg::Geometry *tile = static_cast<osg::Geometry *>(_starGeode->getDrawable(t));
+                level->addDrawable( makeStarPrefix( tile, count ));
+                total += count;
+            }
+
+            if( total > lastTotal )
+            {
+                _starLevels.push_back( level );
+                _starLevelMagnitudes.push_back( m );
+                lastTotal = total;
+            }
+        }
+        _starLevels.push_back( _starGeode );
+        _starLevelMagnitudes.push_back( faintest );
+        _brightestMagnitude = brightest;
+    }
 
     osg::ref_ptr<osg::StateSet> sset = new osg::StateSet;
 
@@ -222,6 +527,7 @@ void StarField::_buildGeometry()
 
     sset->addUniform( _starAlpha.get() );
     sset->addUniform( _pointSize.get() );
+    sset->addUniform( new osg::Uniform( "starRadius", float(_radius) ));
 
     /*
     _MVi = new osg::Uniform( "MVi", osg::Matrix::identity() );
@@ -233,10 +539,9 @@ void StarField::_buildGeometry()
     */
 
     sset->setRenderBinDetails(-10,"RenderBin");
-    geometry->setStateSet( sset.get() );
-
-    _starGeode = new osg::Geode;
-    _starGeode->addDrawable( geometry.get() );
+    for( unsigned int i = 0; i < _starLevels.size(); i++ )
+        _starLevels[i]->setStateSet( sset.get() );
+    _starGeode->setStateSet( sset.get() );
 
     addChild( _starGeode.get() );
 }
@@ -272,12 +577,146 @@ void StarField::setSunAltitude( double sunAltitude )
     if( alpha > 1.0 ) 
         alpha = 1.0;
     _starAlpha->set( alpha );
+
+    // The faintest visible star brightens from the naked eye limit at the end
+    // of astronomical twilight to the brightest stars at sunset.  With the
+    // sun up, none are drawn.
+    if( sunAltitude > 0.0 )
+        _sunLimitingMagnitude = -100.0;
+    else if( sunAltitude > -18.0 )
+        _sunLimitingMagnitude = _twilightLimitingMagnitude +
+            (_nightLimitingMagnitude - _twilightLimitingMagnitude) * (-sunAltitude/18.0);
+    else
+        _sunLimitingMagnitude = _nightLimitingMagnitude;
+}
+
+double StarField::getLimitingMagnitude( double fovy ) const
+{
+    // Magnifying the view brings out fainter stars, by five magnitudes
+    // for each factor of ten
+    double limit = _sunLimitingMagnitude;
+    if( fovy > 0.0 && fovy < _referenceFieldOfView )
+        limit += 5.0 * log10( _referenceFieldOfView/fovy );
+    return limit;
+}
+
+void StarField::traverse(osg::NodeVisitor&nv)
+{
+    if( nv.getVisitorType() != osg::NodeVisitor::CULL_VISITOR || _starLevels.empty() )
+    {
+        osg::MatrixTransform::traverse( nv );
+        return;
+    }
+
+    double fovy = 0.0, aspect, zNear, zFar;
+    osgUtil::CullVisitor *cv = dynamic_cast<osgUtil::CullVisitor *>(&nv);
+    if( cv != NULL && cv->getProjectionMatrix() != NULL )
+        cv->getProjectionMatrix()->getPerspective( fovy, aspect, zNear, zFar );
+
+    // Draw only the first level that holds every star as bright as the
+    // limiting magnitude of this view, and nothing when none are visible
+    const double limit = getLimitingMagnitude( fovy );
+    if( limit >= _brightestMagnitude )
+    {
+        unsigned int level = 0;
+        while( level + 1 < _starLevels.size() && _starLevelMagnitudes[level] < limit )
+            level++;
+        _starLevels[level]->accept( nv );
+    }
+
+    for( unsigned int i = 0; i < getNumChildren(); i++ )
+        if( getChild(i) != _starGeode.get() )
+            getChild(i)->accept( nv );
 }
 
 
 unsigned int StarField::getNumStars() 
 { 
-    return _stars.size(); 
+    return _magnitudes.size(); 
+}
+
+unsigned int StarField::getNumTiles()
+{
+    return _starGeode->getNumDrawables();
+}
+
+const StarIndex *StarField::getStarIndex()
+{
+    OpenThreads::ScopedLock<OpenThreads::Mutex> lock( _starIndexMutex );
+    if( !_starIndex.valid() )
+    {
+        // Directions come from the catalogue rather than the star vertices,
+        // whose packing is only good enough for drawing
+        std::vector<osg::Vec3> directions;
+        std::vector<float> magnitudes;
+        StarCatalogRecord record;
+        for( unsigned int i = 0; getStar( i, record ); i++ )
+        {
+            directions.push_back( starDirection( record.rightAscension, record.declination ));
+            magnitudes.push_back( record.magnitude );
+        }
+        _starIndex = new StarIndex( directions, magnitudes );
+    }
+    return _starIndex.get();
+}
+
+bool StarField::getStar( unsigned int star, StarCatalogRecord &record ) const
+{
+    if( _records != 0L )
+    {
+        if( star >= _numRecords )
+            return false;
+        record = _records[star];
+        return true;
+    }
+
+    if( star >= _stars.size() )
+        return false;
+
+    const StarData &data = _stars[star];
+    record.rightAscension = float(data.right_ascension);
+    record.declination    = float(data.declination);
+    record.magnitude      = float(data.magnitude);
+    record.colorIndex     = float(data.color_index);
+    return true;
+}
+
+std::string StarField::getStarName( unsigned int star ) const
+{
+    if( _defaultStarField )
+        return star < _numRecords ? defaultStarNames[star] : "";
+
+    if( _catalog.valid() )
+        return _catalog->getStarName( star );
+
+    if( _records == 0L && star < _stars.size() )
+        return _stars[star].name;
+
+    return std::string();
+}
+
+osg::Geode *StarField::createBrightStarGeode( double limitingMagnitude )
+{
+    osg::Geode *geode = new osg::Geode;
+    geode->setStateSet( _starGeode->getStateSet() );
+
+    for( unsigned int t = 0; t < _starGeode->getNumDrawables(); t++ )
+    {
+        osg::Geometry *stars = dynamic_cast<osg::Geometry *>(_starGeode->getDrawable(t));
+        if( stars == 0L )
+            continue;
+
+        const unsigned int first = _tileOffsets[t];
+        unsigned int n = 0;
+        while( first + n < _tileOffsets[t + 1] && _magnitudes[first + n] <= limitingMagnitude )
+            n++;
+        if( n == 0 )
+            continue;
+
+        geode->addDrawable( makeStarPrefix( stars, n ));
+    }
+
+    return geode;
 }
 
 StarField::StarData::StarData( std::stringstream &ss )
@@ -288,8 +727,12 @@ StarField::StarData::StarData( std::stringstream &ss )
     std::stringstream(buff) >> right_ascension;
     getline( ss, buff, ',' );
     std::stringstream(buff) >> declination;
-    getline( ss, buff, '\n' );
+    getline( ss, buff, ',' );
     std::stringstream(buff) >> magnitude;
+    // B-V colour index is optional
+    color_index = 0.0;
+    if( getline( ss, buff, '\n' ))
+        std::stringstream(buff) >> color_index;
 }
 
 
@@ -327,10 +770,3 @@ bool StarField::_parseFile( const std::string fileName )
     return true;
 }
 
-
-/*
-void StarField::traverse(osg::NodeVisitor&nv)
-{
-    osg::MatrixTransform::traverse( nv );
-}
-*/
@@ -0,0 +1,364 @@
+/*
+ -------------------------------------------------------------------------------
+ | osgEphemeris - Copyright (C) 2007  Don Burns                                |
+ |                                                                             |
+ | This library is free software; you can redistribute it and/or modify        |
+ | it under the terms of the GNU Lesser General Public License as published    |
+ | by the Free Software Foundation; either version 3 of the License, or        |
+ | (at your option) any later version.                                         |
+ |                                                                             |
+ | This library is distributed in the hope that it will be useful, but         |
+ | WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  |
+ | or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public     |
+ | License for more details.                                                   |
+ |                                                                             |
+ | You should have received a copy of the GNU Lesser General Public License    |
+ | along with this software; if not, write to the Free Software Foundation,    |
+ | Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307, USA.               |
+ |                                                                             |
+ -------------------------------------------------------------------------------
+ */
+
+#include <algorithm>
+#include <math.h>
+
+#include <osgEphemeris/StarIndex.h>
+
+using namespace osgEphemeris;
+
+const unsigned int StarIndex::_starsPerCell = 16;
+
+// Spread the low 16 bits of x to the even bits
+static unsigned int spreadBits( unsigned int x )
+{
+    x &= 0x0000FFFF;
+    x = (x | (x << 8)) & 0x00FF00FF;
+    x = (x | (x << 4)) & 0x0F0F0F0F;
+    x = (x | (x << 2)) & 0x33333333;
+    x = (x | (x << 1)) & 0x55555555;
+    return x;
+}
+
+// Interleave the bits of i and j
+static inline unsigned int morton( unsigned int i, unsigned int j )
+{
+    return spreadBits( i ) | (spreadBits( j ) << 1);
+}
+
+// The direction through the point (u,w) of a cube face, as laid out by
+// StarIndex::_cell()
+static osg::Vec3 facePoint( unsigned int face, double u, double w )
+{
+    const double s = (face & 1) ? -1.0 : 1.0;
+    osg::Vec3 v;
+    switch( face >> 1 )
+    {
+        case 0:  v.set( s, u, w ); break;
+        case 1:  v.set( u, s, w ); break;
+        default: v.set( u, w, s ); break;
+    }
+    v.normalize();
+    return v;
+}
+
+static bool magnitudeLess( const std::pair<float, unsigned int> &a, const std::pair<float, unsigned int> &b )
+{
+    return a.first < b.first;
+}
+
+// The angle from the center of the cell (u0,w0)-(u0+step,w0+step) of a face
+// to its furthest point.  Cells are spherical quadrilaterals, so this is at
+// a corner.
+static double cellRadius( const osg::Vec3 &center, double u0, double w0, double step )
+{
+    double radius = 0.0;
+    for( unsigned int c = 0; c < 4; c++ )
+    {
+        double d = center * facePoint( 0, u0 + (c & 1) * step, w0 + (c >> 1) * step );
+        double a = acos( d > 1.0 ? 1.0 : d );
+        if( a > radius )
+            radius = a;
+    }
+    return radius;
+}
+
+struct StarIndex::Region
+{
+    enum Containment { Outside, Partial, Inside };
+
+    // Nodes are only taken whole when clear of the boundary by more than the
+    // float precision of the star directions, so that they agree with contains()
+    static const double tolerance;
+
+    osg::Vec3 axis;
+    double cosHalfAngle;
+    const osg::Polytope::PlaneList *planes;
+    // For each quadtree level, a node whose center is below outside is
+    // outside the region, and one whose center is above inside is inside.
+    // For a cone these bound the cosine of the angle to the axis, for a 
+    // frustum the distance to each plane.
+    std::vector<double> outside;
+    std::vector<double> inside;
+
+    Region( const std::vector<double> &levelRadius, const osg::Vec3 &coneAxis, double halfAngle ):
+        axis(coneAxis),
+        cosHalfAngle(cos(halfAngle)),
+        planes(0L),
+        outside(levelRadius.size()),
+        inside(levelRadius.size())
+    {
+        axis.normalize();
+        for( unsigned int l = 0; l < levelRadius.size(); l++ )
+        {
+            const double r = levelRadius[l];
+            outside[l] = halfAngle + r < osg::PI ? cos( halfAngle + r ) : -2.0;
+            inside[l]  = halfAngle - r - tolerance > 0.0 ? cos( halfAngle - r - tolerance ) : 2.0;
+        }
+    }
+
+    Region( const std::vector<double> &levelRadius, const osg::Polytope &frustum ):
+        cosHalfAngle(0.0),
+        planes(&frustum.getPlaneList()),
+        outside(levelRadius.size()),
+        inside(levelRadius.size())
+    {
+        // The part of the sphere within a node lies within a ball of this
+        // chord about its center
+        for( unsigned int l = 0; l < levelRadius.size(); l++ )
+        {
+            const double chord = 2.0 * sin( levelRadius[l] * 0.5 ) + tolerance;
+            outside[l] = -chord;
+            inside[l]  = chord;
+        }
+    }
+
+    Containment classify( const osg::Vec3 &center, unsigned int level ) const
+    {
+        if( planes == 0L )
+        {
+            const double d = center * axis;
+            if( d < outside[level] )
+                return Outside;
+            if( d >= inside[level] )
+                return Inside;
+            return Partial;
+        }
+
+        Containment containment = Inside;
+        osg::Polytope::PlaneList::const_iterator p;
+        for( p = planes->begin(); p != planes->end(); p++ )
+        {
+            const double d = p->distance( center );
+            if( d < outside[level] )
+                return Outside;
+            if( d < inside[level] )
+                containment = Partial;
+        }
+        return containment;
+    }
+
+    bool contains( const osg::Vec3 &direction ) const
+    {
+        if( planes == 0L )
+            return direction * axis >= cosHalfAngle;
+
+        osg::Polytope::PlaneList::const_iterator p;
+        for( p = planes->begin(); p != planes->end(); p++ )
+            if( p->distance( direction ) < 0.0 )
+                return false;
+        return true;
+    }
+};
+
+const double StarIndex::Region::tolerance = 1e-5;
+
+StarIndex::StarIndex( const std::vector<osg::Vec3> &directions, const std::vector<float> &magnitudes ):
+    _brightestMagnitude(0.0f)
+{
+    const unsigned int n = std::min( directions.size(), magnitudes.size() );
+
+    // Stars are stored brightest first within each cell, so that queries
+    // stop at the first star of a cell fainter than the limit.  The star
+    // numbers given out stay those of the input.
+    std::vector< std::pair<float, unsigned int> > order( n );
+    for( unsigned int i = 0; i < n; i++ )
+        order[i] = std::pair<float, unsigned int>( magnitudes[i], i );
+    std::stable_sort( order.begin(), order.end(), magnitudeLess );
+    if( n > 0 )
+        _brightestMagnitude = order[0].first;
+
+    std::vector<osg::Vec3> sorted( n );
+    for( unsigned int i = 0; i < n; i++ )
+    {
+        sorted[i] = directions[order[i].second];
+        sorted[i].normalize();
+    }
+
+    _depth = 0;
+    while( _depth < 10 && 6 * (1u << (2*_depth)) * _starsPerCell < n )
+        _depth++;
+    _resolution = 1u << _depth;
+    const unsigned int numCells = 6 * _resolution * _resolution;
+
+    // Counting sort of the stars into cells, which keeps each cell brightest
+    // first.  Directions and magnitudes are stored in cell order, so that
+    // the stars of a cell are tested from adjacent memory.
+    std::vector<unsigned int> cells( n );
+    _cellStart.assign( numCells + 1, 0 );
+    for( unsigned int i = 0; i < n; i++ )
+    {
+        cells[i] = _cell( sorted[i] );
+        _cellStart[cells[i] + 1]++;
+    }
+    for( unsigned int c = 0; c < numCells; c++ )
+        _cellStart[c + 1] += _cellStart[c];
+
+    std::vector<unsigned int> next( _cellStart.begin(), _cellStart.end() - 1 );
+    _cellStars.resize( n );
+    _slots.resize( n );
+    _directions.resize( n );
+    _magnitudes.resize( n );
+    for( unsigned int i = 0; i < n; i++ )
+    {
+        const unsigned int slot = next[cells[i]]++;
+        _cellStars[slot] = order[i].second;
+        _slots[order[i].second] = slot;
+        _directions[slot] = sorted[i];
+        _magnitudes[slot] = order[i].first;
+    }
+
+    // The largest angular radius of the quadtree nodes at each level.  All
+    // faces are alike, so only one is measured.
+    _levelRadius.assign( _depth + 1, 0.0 );
+    for( unsigned int level = 0; level <= _depth; level++ )
+    {
+        const unsigned int nodes = 1u << level;
+        const double step = 2.0 / nodes;
+        for( unsigned int j = 0; j < nodes; j++ )
+        {
+            for( unsigned int i = 0; i < nodes; i++ )
+            {
+                const double u0 = -1.0 + i * step;
+                const double w0 = -1.0 + j * step;
+                const osg::Vec3 center = facePoint( 0, u0 + step * 0.5, w0 + step * 0.5 );
+                _levelRadius[level] = std::max( _levelRadius[level], cellRadius( center, u0, w0, step ));
+            }
+        }
+    }
+}
+
+unsigned int StarIndex::_cell( const osg::Vec3 &v ) const
+{
+    const float ax = fabsf(v.x());
+    const float ay = fabsf(v.y());
+    const float az = fabsf(v.z());
+
+    unsigned int face;
+    float u, w, m;
+    if( ax >= ay && ax >= az )
+    {
+        face = v.x() < 0.0f ? 1 : 0;
+        u = v.y(); w = v.z(); m = ax;
+    }
+    else if( ay >= az )
+    {
+        face = v.y() < 0.0f ? 3 : 2;
+        u = v.x(); w = v.z(); m = ay;
+    }
+    else
+    {
+        face = v.z() < 0.0f ? 5 : 4;
+        u = v.x(); w = v.y(); m = az;
+    }
+
+    if( m <= 0.0f )
+        return 0;
+
+    unsigned int i = (unsigned int)((u/m + 1.0f) * 0.5f * _resolution);
+    unsigned int j = (unsigned int)((w/m + 1.0f) * 0.5f * _resolution);
+    if( i >= _resolution ) i = _resolution - 1;
+    if( j >= _resolution ) j = _resolution - 1;
+
+    return face * _resolution * _resolution + morton( i, j );
+}
+
+void StarIndex::queryCone( const osg::Vec3 &axis, double halfAngle, double limitingMagnitude,
+                           std::vector<unsigned int> &stars ) const
+{
+    _query( Region( _levelRadius, axis, halfAngle ), limitingMagnitude, stars );
+}
+
+void StarIndex::queryFrustum( const osg::Polytope &frustum, double limitingMagnitude,
+                              std::vector<unsigned int> &stars ) const
+{
+    _query( Region( _levelRadius, frustum ), limitingMagnitude, stars );
+}
+
+void StarIndex::_query( const Region &region, double limitingMagnitude, std::vector<unsigned int> &stars ) const
+{
+    stars.clear();
+    if( _magnitudes.empty() || _brightestMagnitude > limitingMagnitude )
+        return;
+
+    for( unsigned int face = 0; face < 6; face++ )
+        _queryNode( region, face, 0, 0, 0, limitingMagnitude, stars );
+
+    std::sort( stars.begin(), stars.end() );
+}
+
+void StarIndex::_queryNode( const Region &region, unsigned int face, unsigned int level,
+                            unsigned int i, unsigned int j, double limitingMagnitude,
+                            std::vector<unsigned int> &stars ) const
+{
+    // The node covers size x size cells from cell (i*size, j*size) of the face
+    const unsigned int size = _resolution >> level;
+    const unsigned int firstCell = face * _resolution * _resolution + morton( i * size, j * size );
+    const unsigned int endCell = firstCell + size * size;
+    if( _cellStart[firstCell] == _cellStart[endCell] )
+        return;
+
+    const double step = 2.0 / (1u << level);
+    const osg::Vec3 center = facePoint( face, -1.0 + (i + 0.5) * step, -1.0 + (j + 0.5) * step );
+
+    switch( region.classify( center, level ))
+    {
+        case Region::Outside:
+            return;
+
+        case Region::Inside:
+            _addCells( firstCell, endCell, limitingMagnitude, stars );
+            return;
+
+        case Region::Partial:
+            break;
+    }
+
+    if( level < _depth )
+    {
+        for( unsigned int c = 0; c < 4; c++ )
+            _queryNode( region, face, level + 1, i * 2 + (c & 1), j * 2 + (c >> 1), limitingMagnitude, stars );
+        return;
+    }
+
+    for( unsigned int s = _cellStart[firstCell]; s < _cellStart[endCell]; s++ )
+    {
+        if( _magnitudes[s] > limitingMagnitude )
+            break;
+        if( region.contains( _directions[s] ))
+            stars.push_back( _cellStars[s] );
+    }
+}
+
+void StarIndex::_addCells( unsigned int firstCell, unsigned int endCell, double limitingMagnitude,
+                           std::vector<unsigned int> &stars ) const
+{
+    for( unsigned int c = firstCell; c < endCell; c++ )
+    {
+        for( unsigned int s = _cellStart[c]; s < _cellStart[c + 1]; s++ )
+        {
+            if( _magnitudes[s] > limitingMagnitude )
+                break;
+            stars.push_back( _cellStars[s] );
+        }
+    }
+}
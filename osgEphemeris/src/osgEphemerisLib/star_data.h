@@ -2,3147 +2,3148 @@
  * The Yale Bright Star Catalogue, from the YBS.edb file of XEphem 3.5.2
  * Fields are: name, right ascension, declination, and magnitude.
  * Angles are given in radians; all positions are epoch 2000.
+ * Stars are sorted by magnitude, brightest first.
+ *
+ * Define STAR( name, right_ascension, declination, magnitude ) before
+ * including this file.
  */
-
-static const char *star_data[] =  {
-     "Sirius,1.767793,-0.291751,-1.46\n",
-     "Canopus,1.675305,-0.919716,-0.72\n",
-    "Arcturus,3.733528,0.334798,-0.04\n",
-    "Cen Alpha1,3.837972,-1.061776,-0.01\n",
-    "Vega,4.873563,0.676902,0.03\n",
-    "Capella,1.381821,0.802818,0.08\n",
-    "Rigel,1.372432,-0.143146,0.12\n",
-    "Procyon,2.004082,0.091193,0.38\n",
-    "Achernar,0.426362,-0.998968,0.46\n",
-    "Betelgeuse,1.549729,0.129276,0.5\n",
-    "Hadar (Agena),3.681874,-1.053709,0.61\n",
-    "Altair,5.195772,0.154782,0.77\n",
-    "Aldebaran,1.203928,0.288139,0.85\n",
-    "Antares,4.317101,-0.461324,0.96\n",
-    "Spica,3.513319,-0.194803,0.98\n",
-    "Pollux,2.030320,0.489148,1.14\n",
-    "Fomalhaut,6.011139,-0.517005,1.16\n",
-    "Cru Beta,3.349810,-1.041763,1.25\n",
-    "Deneb,5.416768,0.790290,1.25\n",
-    "Cen Alpha2,3.837986,-1.061781,1.33\n",
-    "Cru Alpha1,3.257650,-1.101288,1.33\n",
-    "Regulus,2.654522,0.208867,1.35\n",
-    "CMa Epsilon,1.826596,-0.505661,1.5\n",
-    "Cru Gamma,3.277576,-0.996816,1.63\n",
-    "Sco Lambda,4.597234,-0.647585,1.63\n",
-    "Ori Gamma,1.418655,0.110824,1.64\n",
-    "Tau Beta,1.423716,0.499295,1.65\n",
-    "Car Beta,2.413790,-1.216795,1.68\n",
-    "Ori Epsilon,1.467007,-0.020978,1.7\n",
-    "Cru Alpha2,3.257693,-1.101293,1.73\n",
-    "Gru Alpha,5.795511,-0.819626,1.74\n",
-    "UMa Epsilon,3.377336,0.976681,1.77\n",
-    "Vel Gamma2,2.135992,-0.826181,1.78\n",
-    "Per Alpha,0.891529,0.870241,1.79\n",
-    "UMa Alpha,2.896061,1.077755,1.79\n",
-    "CMa Delta,1.869211,-0.460651,1.84\n",
-    "Sgr Epsilon,4.817858,-0.600127,1.85\n",
-    "Car Epsilon,2.192628,-1.038641,1.86\n",
-    "UMa Eta,3.610824,0.860680,1.86\n",
-    "Sco Theta,4.613429,-0.750453,1.87\n",
-    "Aur Beta,1.568738,0.784482,1.9\n",
-    "TrA Alpha,4.401131,-1.204762,1.92\n",
-    "Gem Gamma,1.735345,0.286219,1.93\n",
-    "Pav Alpha,5.347900,-0.990213,1.94\n",
-    "Vel Delta,2.289450,-0.954841,1.96\n",
-    "CMa Beta,1.669844,-0.313388,1.98\n",
-    "Castor,1.983567,0.556556,1.98\n",
-    "Hya Alpha,2.476564,-0.151121,1.98\n",
-    "Ari Alpha,0.554898,0.409498,2\n",
-    "Polaris,0.662404,1.557952,2.02\n",
-    "Sgr Sigma,4.953528,-0.458963,2.02\n",
-    "Cet Beta,0.190197,-0.313927,2.04\n",
-    "Ori Zeta,1.486839,-0.033908,2.05\n",
-    "And Alpha,0.036601,0.507726,2.06\n",
-    "And Beta,0.304262,0.621696,2.06\n",
-    "Cen Theta,3.694353,-0.634776,2.06\n",
-    "Ori Kappa,1.517375,-0.168768,2.06\n",
-    "Oph Alpha,4.603022,0.219213,2.08\n",
-    "UMi Beta,3.886434,1.294259,2.08\n",
-    "Gru Beta,5.945762,-0.818293,2.1\n",
-    "Algol,0.821039,0.714809,2.12\n",
-    "Leo Beta,3.093858,0.254328,2.14\n",
-    "Cen Gamma,3.322743,-0.854508,2.17\n",
-    "Cyg Gamma,5.332977,0.702611,2.2\n",
-    "Vel Lambda,2.391087,-0.758040,2.21\n",
-    "Cas Alpha,0.176751,0.986761,2.23\n",
-    "CrB Alpha,4.078347,0.466260,2.23\n",
-    "Dra Gamma,4.697583,0.898651,2.23\n",
-    "Ori Delta,1.448652,-0.005221,2.23\n",
-    "Car Iota,2.430764,-1.034549,2.25\n",
-    "Pup Zeta,2.110038,-0.698190,2.25\n",
-    "And Gamma1,0.540616,0.738793,2.26\n",
-    "Cas Beta,0.040048,1.032357,2.27\n",
-    "Mizar A,3.507785,0.958627,2.27\n",
-    "Sco Epsilon,4.407669,-0.598532,2.29\n",
-    "Cen Epsilon,3.577430,-0.933165,2.3\n",
-    "Lup Alpha,3.848146,-0.827082,2.3\n",
-    "Cen Eta,3.820118,-0.735792,2.31\n",
-    "Sco Delta,4.190245,-0.394823,2.32\n",
-    "UMa Beta,2.887829,0.984060,2.37\n",
-    "Peg Epsilon,5.690588,0.172351,2.39\n",
-    "Phe Alpha,0.114683,-0.738381,2.39\n",
-    "Sco Kappa,4.635980,-0.681202,2.41\n",
-    "Peg Beta,6.037857,0.490137,2.42\n",
-    "Oph Eta,4.495874,-0.274448,2.43\n",
-    "Cep Alpha,5.578858,1.092324,2.44\n",
-    "UMa Gamma,3.114671,0.937150,2.44\n",
-    "CMa Eta,1.937730,-0.511435,2.45\n",
-    "Cyg Epsilon,5.437624,0.592893,2.46\n",
-    "Cas Gamma,0.247437,1.059706,2.47\n",
-    "Peg Alpha,6.042163,0.265382,2.49\n",
-    "Vel Kappa,2.452682,-0.960120,2.5\n",
-    "Cet Alpha,0.795347,0.071379,2.53\n",
-    "Cen Zeta,3.645731,-0.825337,2.55\n",
-    "Leo Delta,2.941352,0.358205,2.56\n",
-    "Oph Zeta,4.350924,-0.184433,2.56\n",
-    "Lep Alpha,1.451809,-0.311056,2.58\n",
-    "Crv Gamma,3.210562,-0.306165,2.59\n",
-    "Cen Delta,3.178063,-0.885275,2.6\n",
-    "Sgr Zeta,4.985584,-0.521509,2.6\n",
-    "Leo Gamma1,2.705137,0.346302,2.61\n",
-    "Lib Beta,4.001196,-0.163765,2.61\n",
-    "Aur Theta,1.569582,0.649481,2.62\n",
-    "Sco Beta1,4.212512,-0.345672,2.62\n",
-    "Ari Beta,0.500211,0.363169,2.64\n",
-    "Col Alpha,1.481995,-0.594706,2.64\n",
-    "Crv Beta,3.291633,-0.408349,2.65\n",
-    "Ser Alpha,4.120148,0.112147,2.65\n",
-    "Boo Eta,3.642000,0.321102,2.68\n",
-    "Cas Delta,0.374446,1.051304,2.68\n",
-    "Lup Beta,3.920584,-0.752828,2.68\n",
-    "Aur Iota,1.295878,0.578858,2.69\n",
-    "Mus Alpha,3.303836,-1.206643,2.69\n",
-    "Sco Upsilon,4.584820,-0.650935,2.69\n",
-    "Vel Mu,2.822067,-0.862542,2.69\n",
-    "Boo Epsilon,3.861483,0.472533,2.7\n",
-    "Pup Pi,1.907398,-0.647474,2.7\n",
-    "Sgr Delta,4.803997,-0.520598,2.7\n",
-    "Aql Gamma,5.176036,0.185238,2.72\n",
-    "Dra Eta,4.293474,1.073625,2.74\n",
-    "Oph Delta,4.251382,-0.064480,2.74\n",
-    "Cen Iota,3.493262,-0.640749,2.75\n",
-    "Lib Alpha2,3.887190,-0.279980,2.75\n",
-    "Car Theta,2.805428,-1.123895,2.76\n",
-    "Her Beta,4.320650,0.375066,2.77\n",
-    "Oph Beta,4.640278,0.079713,2.77\n",
-    "Ori Iota,1.463604,-0.103149,2.77\n",
-    "Lup Gamma,4.080325,-0.718499,2.78\n",
-    "Dra Beta,4.583380,0.912831,2.79\n",
-    "Eri Beta,1.343249,-0.088774,2.79\n",
-    "Cru Delta,3.207675,-1.025362,2.8\n",
-    "Hyi Beta,0.112363,-1.348340,2.8\n",
-    "Her Zeta,4.368937,0.551577,2.81\n",
-    "Pup Rho,2.127309,-0.424188,2.81\n",
-    "Sgr Lambda,4.834431,-0.443692,2.81\n",
-    "Sco Tau,4.345361,-0.492464,2.82\n",
-    "Peg Gamma,0.057756,0.265004,2.83\n",
-    "Vir Epsilon,3.412890,0.191274,2.83\n",
-    "Lep Beta,1.432239,-0.362321,2.84\n",
-    "Ara Beta,4.560982,-0.969181,2.85\n",
-    "Per Zeta,1.021592,0.556474,2.85\n",
-    "TrA Beta,4.167592,-1.107072,2.85\n",
-    "Hyi Alpha,0.518232,-1.074594,2.86\n",
-    "Tuc Alpha,5.840315,-1.051731,2.86\n",
-    "Cap Delta,5.703038,-0.281473,2.87\n",
-    "Cyg Delta,5.170429,0.787682,2.87\n",
-    "Tau Eta,0.992591,0.420712,2.87\n",
-    "Gem Mu,1.670978,0.392937,2.88\n",
-    "Per Epsilon,1.037831,0.698311,2.89\n",
-    "Sco Pi,4.183780,-0.455778,2.89\n",
-    "Sco Sigma,4.281242,-0.446678,2.89\n",
-    "Sgr Pi,5.016789,-0.366931,2.89\n",
-    "TrA Gamma,4.009501,-1.198682,2.89\n",
-    "CMi Beta,1.951060,0.144678,2.9\n",
-    "CVn Alpha2,3.386062,0.668781,2.9\n",
-    "Aqr Beta,5.635486,-0.097234,2.91\n",
-    "Per Gamma,0.806328,0.933863,2.93\n",
-    "Pup Tau,1.788686,-0.883394,2.93\n",
-    "Peg Eta,5.947217,0.527463,2.94\n",
-    "Ara Alpha,4.589525,-0.870502,2.95\n",
-    "Crv Delta,3.271903,-0.288251,2.95\n",
-    "Eri Gamma,1.038602,-0.235770,2.95\n",
-    "Aqr Alpha,5.784821,-0.005580,2.96\n",
-    "Gem Epsilon,1.762484,0.438621,2.98\n",
-    "Leo Epsilon,2.556260,0.414937,2.98\n",
-    "Aql Zeta,4.997794,0.241961,2.99\n",
-    "Aur Epsilon,1.317585,0.764861,2.99\n",
-    "Sgr Gamma2,4.737733,-0.531002,2.99\n",
-    "Crv Epsilon,3.185771,-0.394789,3\n",
-    "Hya Gamma,3.485953,-0.404422,3\n",
-    "Tau Zeta,1.473254,0.369006,3\n",
-    "Tri Beta,0.565239,0.610642,3\n",
-    "Car Upsilon,2.561714,-1.135720,3.01\n",
-    "Gru Gamma,5.733094,-0.652142,3.01\n",
-    "Per Delta,0.972694,0.834049,3.01\n",
-    "UMa Psi,2.921958,0.776647,3.01\n",
-    "CMa Omicron2,1.845795,-0.415970,3.02\n",
-    "CMa Zeta,1.659430,-0.524704,3.02\n",
-    "Boo Gamma,3.805160,0.668607,3.03\n",
-    "Sco Iota1,4.658218,-0.700347,3.03\n",
-    "Cen Mu,3.619886,-0.741309,3.04\n",
-    "Mira,0.608007,-0.051967,3.04\n",
-    "Mus Beta,3.343535,-1.188710,3.05\n",
-    "UMa Mu,2.715420,0.724302,3.05\n",
-    "UMi Gamma,4.017435,1.253738,3.05\n",
-    "Dra Delta,5.028970,1.180919,3.07\n",
-    "Cap Beta,5.327668,-0.257984,3.08\n",
-    "Cyg Beta1,5.108237,0.487989,3.08\n",
-    "Sco Mu1,4.415116,-0.664054,3.08\n",
-    "Hya Nu,2.834524,-0.282632,3.11\n",
-    "Hya Zeta,2.336094,0.103770,3.11\n",
-    "Ind Alpha,5.399903,-0.825390,3.11\n",
-    "Sgr Eta,4.789300,-0.641612,3.11\n",
-    "Col Beta,1.531352,-0.624275,3.12\n",
-    "Ara Zeta,4.444568,-0.977215,3.13\n",
-    "Cen Kappa,3.923333,-0.734856,3.13\n",
-    "Cen Lambda,3.035913,-1.099902,3.13\n",
-    "Lyn Alpha,2.448064,0.600262,3.13\n",
-    "Her Delta,4.516178,0.433525,3.14\n",
-    "UMa Iota,2.352733,0.838485,3.14\n",
-    "Her Pi,4.516243,0.642441,3.16\n",
-    "Aur Eta,1.337424,0.719677,3.17\n",
-    "Dra Zeta,4.488929,1.146938,3.17\n",
-    "Pup Nu,1.735563,-0.753914,3.17\n",
-    "Sgr Phi,4.911604,-0.471079,3.17\n",
-    "UMa Theta,2.499559,0.901938,3.17\n",
-    "Cir Alpha,3.850662,-1.134033,3.19\n",
-    "Lep Epsilon,1.332828,-0.390450,3.19\n",
-    "Ori Pi3,1.264666,0.121499,3.19\n",
-    "Cyg Zeta,5.554234,0.527560,3.2\n",
-    "Oph Kappa,4.440416,0.163625,3.2\n",
-    "Cep Gamma,6.193068,1.354943,3.21\n",
-    "Lup Delta,4.020242,-0.709433,3.22\n",
-    "Aql Theta,5.285315,-0.014336,3.23\n",
-    "Cep Beta,5.622840,1.231519,3.23\n",
-    "Eri Theta1,0.777813,-0.703450,3.24\n",
-    "Hyi Gamma,0.991514,-1.295713,3.24\n",
-    "Lyr Gamma,4.969578,0.570538,3.24\n",
-    "Oph Epsilon,4.268734,-0.081900,3.24\n",
-    "Pup Sigma,1.960136,-0.755752,3.25\n",
-    "Ser Eta,4.805371,-0.050595,3.26\n",
-    "And Delta,0.171602,0.538623,3.27\n",
-    "Aqr Delta,5.998042,-0.276126,3.27\n",
-    "Dor Alpha,1.195536,-0.960716,3.27\n",
-    "Hya Pi,3.692993,-0.465697,3.27\n",
-    "Oph Theta,4.546626,-0.436323,3.27\n",
-    "Pic Alpha,1.781065,-1.081081,3.27\n",
-    "Gem Eta,1.635708,0.392815,3.28\n",
-    "Dra Iota,4.035768,1.029153,3.29\n",
-    "Lib Sigma,3.944750,-0.441253,3.29\n",
-    "Lep Mu,1.365422,-0.282840,3.31\n",
-    "Phe Beta,0.288343,-0.815394,3.31\n",
-    "UMa Delta,3.208904,0.995405,3.31\n",
-    "Car Omega,2.677931,-1.222395,3.32\n",
-    "Sgr Tau,5.004470,-0.482942,3.32\n",
-    "Sco Eta,4.503619,-0.754666,3.33\n",
-    "Ara Gamma,4.561389,-0.983973,3.34\n",
-    "Leo Theta,2.941927,0.269295,3.34\n",
-    "Oph Nu,4.708142,-0.170582,3.34\n",
-    "Pup Xi,2.047686,-0.433884,3.34\n",
-    "Cep Zeta,5.806950,1.015801,3.35\n",
-    "Ret Alpha,1.110138,-1.090375,3.35\n",
-    "Aql Delta,5.085446,0.054362,3.36\n",
-    "Gem Xi,1.768411,0.225070,3.36\n",
-    "Ori Eta,1.415797,-0.041835,3.36\n",
-    "UMa Omicron,2.226451,1.059730,3.36\n",
-    "Lup Epsilon,4.025958,-0.779978,3.37\n",
-    "Vir Zeta,3.554770,-0.010399,3.37\n",
-    "Cas Epsilon,0.499142,1.111251,3.38\n",
-    "Hya Epsilon,2.298497,0.112031,3.38\n",
-    "Vir Delta,3.384208,0.059298,3.38\n",
-    "Per Rho,0.807986,0.677891,3.39\n",
-    "Peg Zeta,5.940497,0.189043,3.4\n",
-    "Tau Theta2,1.172258,0.276998,3.4\n",
-    "Cen Nu,3.619398,-0.727589,3.41\n",
-    "Lup Eta,4.189321,-0.670153,3.41\n",
-    "Lup Zeta,3.980594,-0.909302,3.41\n",
-    "Phe Gamma,0.385565,-0.756048,3.41\n",
-    "Tri Alpha,0.493412,0.516249,3.41\n",
-    "Her Mu,4.653302,0.483815,3.42\n",
-    "Pav Beta,5.432155,-1.155461,3.42\n",
-    "Cep Eta,5.433603,1.079292,3.43\n",
-    "Aql Lambda,5.001452,-0.085216,3.44\n",
-    "Cas Eta,0.214239,1.009077,3.44\n",
-    "Leo Zeta,2.690818,0.408708,3.44\n",
-    "Cet Eta,0.299280,-0.177713,3.45\n",
-    "Lyr Beta,4.930904,0.582290,3.45\n",
-    "UMa Lambda,2.692592,0.748998,3.45\n",
-    "Boo Delta,3.994637,0.581452,3.47\n",
-    "CMa Sigma,1.840093,-0.487553,3.47\n",
-    "Car Chi,2.080338,-0.924714,3.47\n",
-    "Cet Gamma,0.712531,0.056476,3.47\n",
-    "Sge Gamma,5.230563,0.340203,3.47\n",
-    "Tau Lambda,1.050165,0.217996,3.47\n",
-    "Her Alpha1,4.514505,0.251158,3.48\n",
-    "Peg Mu,5.977767,0.429380,3.48\n",
-    "UMa Nu,2.960420,0.577602,3.48\n",
-    "Gru Epsilon,5.971448,-0.895650,3.49\n",
-    "Boo Beta,3.935485,0.704948,3.5\n",
-    "Cet Tau,0.454084,-0.278162,3.5\n",
-    "Sgr Xi2,4.964284,-0.368381,3.51\n",
-    "Tel Alpha,4.830082,-0.802299,3.51\n",
-    "Cep Iota,5.976356,1.155418,3.52\n",
-    "Cnc Beta,2.166455,0.160318,3.52\n",
-    "Leo Eta,2.649992,0.292566,3.52\n",
-    "Leo Omicron,2.535745,0.172652,3.52\n",
-    "Gem Delta,1.920400,0.383662,3.53\n",
-    "Her Eta,4.375962,0.679321,3.53\n",
-    "Peg Theta,5.804092,0.108172,3.53\n",
-    "Ser Mu,4.143499,-0.059870,3.53\n",
-    "Tau Epsilon,1.172061,0.334759,3.53\n",
-    "Eri Delta,0.974105,-0.170402,3.54\n",
-    "Hya Xi,3.023790,-0.556023,3.54\n",
-    "Ori Lambda,1.462317,0.173384,3.54\n",
-    "Ser Xi,4.614592,-0.268756,3.54\n",
-    "Vel Phi,2.604308,-0.952387,3.54\n",
-    "Lep Zeta,1.513877,-0.258692,3.55\n",
-    "Lup Iota,3.749854,-0.803860,3.55\n",
-    "Cet Iota,0.084772,-0.154006,3.56\n",
-    "Crt Delta,2.964187,-0.257935,3.56\n",
-    "Eri Phi,0.595637,-0.899058,3.56\n",
-    "Eri Upsilon4,1.125279,-0.589892,3.56\n",
-    "Lup Phi1,4.022140,-0.632881,3.56\n",
-    "Pav Delta,5.274065,-1.155093,3.56\n",
-    "And 51,0.427577,0.848725,3.57\n",
-    "Cap Alpha2,5.314768,-0.218947,3.57\n",
-    "Dra Chi,4.804266,1.269426,3.57\n",
-    "Gem Kappa,2.026531,0.425826,3.57\n",
-    "Sco Mu2,4.417145,-0.663531,3.57\n",
-    "Boo Rho,3.804076,0.530081,3.58\n",
-    "Gem Lambda,1.911543,0.288682,3.58\n",
-    "Lib Upsilon,4.088543,-0.491048,3.58\n",
-    "Cru Epsilon,3.234793,-1.054198,3.59\n",
-    "Cet Theta,0.366621,-0.142826,3.6\n",
-    "Gem Theta,1.801129,0.592733,3.6\n",
-    "Lep Gamma,1.503005,-0.391797,3.6\n",
-    "Ori Tau,1.385821,-0.119458,3.6\n",
-    "Tau Omicron,0.893667,0.157584,3.6\n",
-    "UMa Kappa,2.372012,0.823039,3.6\n",
-    "Vel Psi,2.490149,-0.706277,3.6\n",
-    "Hya Lambda,2.664194,-0.215621,3.61\n",
-    "Vir Beta,3.100992,0.030800,3.61\n",
-    "And Omicron,6.029771,0.738730,3.62\n",
-    "Ara Delta,4.586282,-1.059134,3.62\n",
-    "Mus Delta,3.413297,-1.248764,3.62\n",
-    "Pav Eta,4.650139,-1.129645,3.62\n",
-    "Psc Eta,0.399171,0.267835,3.62\n",
-    "Sco Zeta2,4.426955,-0.739346,3.62\n",
-    "Ari 41,0.741692,0.475786,3.63\n",
-    "Del Beta,5.399831,0.254736,3.63\n",
-    "Tau 27,0.999906,0.419810,3.63\n",
-    "Mus Lambda,3.078790,-1.164634,3.64\n",
-    "Dra Alpha,3.684339,1.123570,3.65\n",
-    "Ind Beta,5.475141,-1.020218,3.65\n",
-    "Tau Gamma,1.133562,0.272751,3.65\n",
-    "Vir Gamma,3.323369,-0.025298,3.65\n",
-    "Aqr 88,6.062605,-0.369530,3.66\n",
-    "Ara Theta,4.741325,-0.874265,3.66\n",
-    "Cas Zeta,0.161319,0.940679,3.66\n",
-    "Lib Tau,4.095662,-0.519720,3.66\n",
-    "Ser Beta,4.128525,0.269164,3.67\n",
-    "UMa 23,2.493763,1.100639,3.67\n",
-    "Cap Gamma,5.672720,-0.290811,3.68\n",
-    "CrB Beta,4.048415,0.507993,3.68\n",
-    "Pyx Alpha,2.284600,-0.579212,3.68\n",
-    "Vir Gamma,3.323369,-0.025298,3.68\n",
-    "Eri Tau4,0.870556,-0.379745,3.69\n",
-    "Ori Pi4,1.270629,0.097826,3.69\n",
-    "Psc Gamma,6.096282,0.057286,3.69\n",
-    "Eri Chi,0.505964,-0.900745,3.7\n",
-    "Her Xi,4.702637,0.510470,3.7\n",
-    "Tau 17,0.981202,0.420857,3.7\n",
-    "Aql Beta,5.215538,0.111817,3.71\n",
-    "Lep Eta,1.555110,-0.247274,3.71\n",
-    "Ser Epsilon,4.148720,0.078152,3.71\n",
-    "UMa Chi,3.080724,0.833909,3.71\n",
-    "Aur Delta,1.568731,0.947447,3.72\n",
-    "Cyg Tau,5.562328,0.664020,3.72\n",
-    "Cyg Xi,5.519306,0.766684,3.72\n",
-    "Ori Pi5,1.283915,0.042596,3.72\n",
-    "Vir 109,3.866988,0.033035,3.72\n",
-    "Cet Zeta,0.486336,-0.180380,3.73\n",
-    "Eri Epsilon,0.929082,-0.165079,3.73\n",
-    "Oph 72,4.744459,0.166921,3.73\n",
-    "Aqr Lambda,5.989163,-0.132291,3.74\n",
-    "Cap Zeta,5.614142,-0.391153,3.74\n",
-    "Tau Xi,0.903950,0.169869,3.74\n",
-    "Aur Zeta,1.319811,0.716909,3.75\n",
-    "Cep Delta,5.886872,1.019539,3.75\n",
-    "Dra Xi,4.684151,0.992617,3.75\n",
-    "Her Gamma,4.284434,0.334284,3.75\n",
-    "Oph Gamma,4.659564,0.047250,3.75\n",
-    "Ara Eta,4.406018,-1.030467,3.76\n",
-    "Dor Beta,1.455714,-1.090651,3.76\n",
-    "Oct Nu,5.678756,-1.350710,3.76\n",
-    "Peg Iota,5.790181,0.442354,3.76\n",
-    "Per Eta,0.744805,0.975561,3.76\n",
-    "Tau Delta1,1.147270,0.306174,3.76\n",
-    "Aqr Epsilon,5.444016,-0.165734,3.77\n",
-    "Cyg Kappa,5.048816,0.931458,3.77\n",
-    "Del Alpha,5.408943,0.277716,3.77\n",
-    "Lac Alpha,5.896122,0.877595,3.77\n",
-    "Per Nu,0.982591,0.743137,3.77\n",
-    "Sgr Omicron,4.994623,-0.379464,3.77\n",
-    "Vol Beta,2.206692,-1.154307,3.77\n",
-    "Vol Gamma2,1.870768,-1.230438,3.78\n",
-    "Cyg 31,5.295467,0.815791,3.79\n",
-    "Cyg Iota2,5.103801,0.902854,3.79\n",
-    "Gem Iota,1.944849,0.485168,3.79\n",
-    "Gem Zeta,1.850522,0.359019,3.79\n",
-    "Her Iota,4.622788,0.802963,3.8\n",
-    "Leo Gamma2,2.705159,0.346283,3.8\n",
-    "Per Kappa,0.826835,0.782906,3.8\n",
-    "Ser Delta,4.078842,0.183914,3.8\n",
-    "Ser Delta,4.078842,0.183943,3.8\n",
-    "UMa Upsilon,2.578680,1.030418,3.8\n",
-    "Hya Mu,2.731833,-0.293850,3.81\n",
-    "Lep Delta,1.532930,-0.364410,3.81\n",
-    "Ori Sigma,1.478061,-0.045379,3.81\n",
-    "And Lambda,6.185294,0.810846,3.82\n",
-    "Eri Upsilon2,1.202314,-0.533411,3.82\n",
-    "Lyn 38,2.438421,0.642325,3.82\n",
-    "Oph Lambda,4.323675,0.034625,3.82\n",
-    "Sge Delta,5.180959,0.323482,3.82\n",
-    "Aps Alpha,3.874020,-1.379591,3.83\n",
-    "Cen Phi,3.657650,-0.734798,3.83\n",
-    "Dra Epsilon,5.184384,1.226404,3.83\n",
-    "Her Omicron,4.745303,0.502000,3.83\n",
-    "LMi 46,2.850610,0.597164,3.83\n",
-    "Per Omicron,0.978773,0.563538,3.83\n",
-    "Aqr Gamma,5.854082,-0.024212,3.84\n",
-    "CrB Gamma,4.113494,0.458944,3.84\n",
-    "Dra Lambda,3.016816,1.210056,3.84\n",
-    "Her 109,4.815792,0.379953,3.84\n",
-    "Tau Theta1,1.171880,0.278593,3.84\n",
-    "CMa Omega,1.897224,-0.467273,3.85\n",
-    "Col Delta,1.667284,-0.583575,3.85\n",
-    "Leo Rho,2.761162,0.162432,3.85\n",
-    "Pic Beta,1.515317,-0.891277,3.85\n",
-    "Ret Beta,0.978257,-1.131095,3.85\n",
-    "Sct Alpha,4.866007,-0.143888,3.85\n",
-    "Ser Gamma,4.173315,0.273348,3.85\n",
-    "TrA Delta,4.256153,-1.111523,3.85\n",
-    "Cen Tau,3.306104,-0.847202,3.86\n",
-    "Her Theta,4.696041,0.650145,3.86\n",
-    "Hor Alpha,1.108291,-0.738177,3.86\n",
-    "Sgr Mu,4.772443,-0.367547,3.86\n",
-    "And Mu,0.247633,0.671942,3.87\n",
-    "CMa Omicron1,1.806990,-0.422088,3.87\n",
-    "Cen Upsilon1,3.659432,-0.781971,3.87\n",
-    "Col Epsilon,1.445184,-0.619078,3.87\n",
-    "Dra Kappa,3.287691,1.218036,3.87\n",
-    "Eri 53,1.213789,-0.249650,3.87\n",
-    "For Alpha,0.838071,-0.505918,3.87\n",
-    "Lup Kappa1,3.979067,-0.850635,3.87\n",
-    "Mus Gamma,3.283255,-1.258959,3.87\n",
-    "Tau 20,0.985355,0.425298,3.87\n",
-    "Hya Theta,2.418874,0.040390,3.88\n",
-    "Leo Mu,2.586418,0.453907,3.88\n",
-    "Phe Epsilon,0.041066,-0.798444,3.88\n",
-    "Sco Rho,4.175198,-0.509883,3.88\n",
-    "Vir Mu,3.853076,-0.098757,3.88\n",
-    "Aps Gamma,4.334743,-1.377016,3.89\n",
-    "Cen Pi,2.971452,-0.951049,3.89\n",
-    "Cyg Eta,5.219873,0.612320,3.89\n",
-    "Eri Eta,0.769814,-0.155300,3.89\n",
-    "Her Tau,4.274922,0.808320,3.89\n",
-    "Vir Eta,3.228452,-0.011640,3.89\n",
-    "Aql Eta,5.203146,0.017550,3.9\n",
-    "Gru Iota,6.066590,-0.789703,3.9\n",
-    "Cen Sigma,3.263940,-0.876689,3.91\n",
-    "Hya Iota,2.530102,-0.019945,3.91\n",
-    "Lib Gamma,4.082005,-0.258125,3.91\n",
-    "Tau Nu,1.060971,0.104531,3.91\n",
-    "Equ Alpha,5.566829,0.091591,3.92\n",
-    "Her Epsilon,4.451855,0.539767,3.92\n",
-    "Phe Zeta,0.298386,-0.964222,3.92\n",
-    "Eri Nu,1.205666,-0.058512,3.93\n",
-    "Mon Alpha,2.012568,-0.166698,3.93\n",
-    "Sgr Rho1,5.068756,-0.311493,3.93\n",
-    "Cnc Delta,2.289370,0.316850,3.94\n",
-    "Cyg Nu,5.485453,0.718504,3.94\n",
-    "Leo Iota,2.984186,0.183769,3.94\n",
-    "Phe Kappa,0.114334,-0.762360,3.94\n",
-    "CMa Nu2,1.730858,-0.336078,3.95\n",
-    "Lup Chi,4.149338,-0.586906,3.95\n",
-    "Mizar B,3.507850,0.958564,3.95\n",
-    "Peg Lambda,5.962619,0.411297,3.95\n",
-    "Per Tau,0.760345,0.920879,3.95\n",
-    "Phe Delta,0.398161,-0.856482,3.95\n",
-    "Vol Zeta,2.015070,-1.267216,3.95\n",
-    "CMa Kappa,1.788272,-0.567382,3.96\n",
-    "Cen Rho,3.192433,-0.914005,3.96\n",
-    "Col Eta,1.567073,-0.747268,3.96\n",
-    "Eri 43,1.152077,-0.593708,3.96\n",
-    "Pav Epsilon,5.238569,-1.272529,3.96\n",
-    "Pup 3,2.023746,-0.505355,3.96\n",
-    "Sco Omega1,4.218490,-0.360745,3.96\n",
-    "Aqr 98,6.121611,-0.350821,3.97\n",
-    "Aur Nu,1.533664,0.683272,3.97\n",
-    "Gru Delta1,5.887301,-0.759141,3.97\n",
-    "Oph 67,4.715203,0.051167,3.97\n",
-    "Pyx Beta,2.269379,-0.616247,3.97\n",
-    "Sgr Alpha,5.078414,-0.708885,3.97\n",
-    "Cas 50,0.538587,1.263992,3.98\n",
-    "Cyg 32,5.303496,0.832774,3.98\n",
-    "Mon Gamma,1.635613,-0.109515,3.98\n",
-    "Vol Delta,1.906030,-1.186077,3.98\n",
-    "Tuc Gamma,6.097439,-1.016407,3.99\n",
-    "Cet Upsilon,0.523621,-0.367877,4\n",
-    "Vol Alpha,2.366870,-1.158831,4\n",
-    "Alcor,3.513457,0.959723,4.01\n",
-    "Aqr Tau2,5.975971,-0.237234,4.01\n",
-    "Cyg 41,5.364248,0.530032,4.01\n",
-    "Dra Theta,4.197030,1.022157,4.01\n",
-    "Pav Zeta,4.900165,-1.246655,4.01\n",
-    "Psc Omega,6.280182,0.119788,4.01\n",
-    "Pyx Gamma,2.314881,-0.483631,4.01\n",
-    "Sco Nu,4.241128,-0.339651,4.01\n",
-    "Sgr Beta1,5.072967,-0.775954,4.01\n",
-    "Tri Gamma,0.599150,0.590745,4.01\n",
-    "Aql 12,4.981519,-0.100163,4.02\n",
-    "Aql Epsilon,4.972545,0.262992,4.02\n",
-    "Aqr Eta,5.913859,-0.002051,4.02\n",
-    "Cnc Iota,2.298148,0.501957,4.02\n",
-    "Crv Alpha,3.178303,-0.431601,4.02\n",
-    "Cyg Rho,5.646060,0.795730,4.02\n",
-    "Eri Mu,1.245736,-0.056806,4.02\n",
-    "Nor Gamma2,4.275359,-0.875380,4.02\n",
-    "Cam Beta,1.323912,1.054916,4.03\n",
-    "Cru Mu1,3.379801,-0.997940,4.03\n",
-    "Del Epsilon,5.380908,0.197280,4.03\n",
-    "Oph 70,4.736191,0.043624,4.03\n",
-    "Vir Nu,3.079895,0.113960,4.03\n",
-    "Cru Zeta,3.222031,-1.117064,4.04\n",
-    "Eri Omicron1,1.098968,-0.119337,4.04\n",
-    "Lyr 13,4.953833,0.767004,4.04\n",
-    "Per 48,1.084991,0.832740,4.04\n",
-    "Per Xi,1.042682,0.624673,4.04\n",
-    "Boo Theta,3.775133,0.904968,4.05\n",
-    "Cen Psi,3.754887,-0.661223,4.05\n",
-    "Leo Sigma,2.972019,0.105234,4.05\n",
-    "Lup Lambda,3.965577,-0.790280,4.05\n",
-    "Lup Rho,3.830503,-0.862644,4.05\n",
-    "Per Iota,0.824959,0.865916,4.05\n",
-    "And Zeta,0.206552,0.423543,4.06\n",
-    "Ara Epsilon1,4.448779,-0.927827,4.06\n",
-    "Gem Upsilon,1.989334,0.469421,4.06\n",
-    "Boo Upsilon,3.619275,0.275723,4.07\n",
-    "CMa Theta,1.807245,-0.210113,4.07\n",
-    "Cap Theta,5.523734,-0.300769,4.07\n",
-    "Cet Delta,0.695877,0.005735,4.07\n",
-    "Cha Alpha,2.175233,-1.342502,4.07\n",
-    "Cir Beta,4.003407,-1.026273,4.07\n",
-    "Ori Omicron2,1.293165,0.235872,4.07\n",
-    "Per Phi,0.452302,0.884683,4.07\n",
-    "Cep Mu,5.687621,1.025905,4.08\n",
-    "Crt Alpha,2.878812,-0.319376,4.08\n",
-    "Crt Gamma,2.988360,-0.308642,4.08\n",
-    "Peg 1,5.594158,0.345653,4.08\n",
-    "Vir Iota,3.735070,-0.104729,4.08\n",
-    "And Upsilon,0.422355,0.722663,4.09\n",
-    "Eri Tau3,0.795834,-0.412324,4.09\n",
-    "Hyi Delta,0.618494,-1.198333,4.09\n",
-    "Ori Phi2,1.470025,0.162151,4.09\n",
-    "Ser Kappa,4.139659,0.316632,4.09\n",
-    "Cap Omega,5.462102,-0.469828,4.11\n",
-    "Cha Gamma,2.772754,-1.371965,4.11\n",
-    "CrA Alpha,5.015516,-0.661557,4.11\n",
-    "CrA Beta,5.017945,-0.686627,4.11\n",
-    "Eri Iota,0.701041,-0.695611,4.11\n",
-    "Gru Delta2,5.889432,-0.763572,4.11\n",
-    "Hyi Epsilon,0.696343,-1.191483,4.11\n",
-    "Mus Epsilon,3.218249,-1.186140,4.11\n",
-    "Tau 5,0.920108,0.225787,4.11\n",
-    "TrA Epsilon,4.087212,-1.157449,4.11\n",
-    "CMa Gamma,1.848995,-0.272853,4.12\n",
-    "Gru Zeta,6.025226,-0.920734,4.12\n",
-    "Hya Upsilon1,2.580811,-0.259123,4.12\n",
-    "Ori Mu,1.581196,0.168381,4.12\n",
-    "Per Theta,0.716458,0.859197,4.12\n",
-    "Vir Omicron,3.164318,0.152421,4.12\n",
-    "Lac 1,5.829269,0.658842,4.13\n",
-    "Peg Kappa,5.692588,0.447590,4.13\n",
-    "Psc Iota,6.195701,0.098199,4.13\n",
-    "Sgr Iota,5.215313,-0.730740,4.13\n",
-    "Tel Zeta,4.838191,-0.856448,4.13\n",
-    "And Kappa,6.197701,0.773772,4.14\n",
-    "Cap Psi,5.437115,-0.441059,4.14\n",
-    "CrB Theta,4.070675,0.547321,4.14\n",
-    "Ori 29,1.413484,-0.136276,4.14\n",
-    "Per Mu,1.112204,0.844904,4.14\n",
-    "CrB Epsilon,4.178267,0.469106,4.15\n",
-    "Cru Eta,3.171620,-1.127720,4.15\n",
-    "Gem Nu,1.697173,0.352770,4.15\n",
-    "Lib Theta,4.161847,-0.291984,4.15\n",
-    "Mon Delta,1.884367,-0.008601,4.15\n",
-    "Oct Beta,5.960539,-1.420378,4.15\n",
-    "Aqr Theta,5.833036,-0.135845,4.16\n",
-    "Cas Kappa,0.143990,1.098365,4.16\n",
-    "Gem 1,1.588773,0.406022,4.16\n",
-    "Hya Delta,2.258703,0.099547,4.16\n",
-    "Oph 44,4.565650,-0.421938,4.17\n",
-    "PsA Epsilon,5.936985,-0.472000,4.17\n",
-    "Boo Lambda,3.736677,0.804393,4.18\n",
-    "Gem Rho,1.959619,0.554743,4.18\n",
-    "Tau 23,0.987536,0.417977,4.18\n",
-    "Cen 2,3.619137,-0.601280,4.19\n",
-    "Cep Epsilon,5.825182,0.995599,4.19\n",
-    "Her 110,4.911626,0.358602,4.19\n",
-    "Peg Xi,5.963325,0.212455,4.19\n",
-    "Vir Kappa,3.721464,-0.179308,4.19\n",
-    "Her Sigma,4.337594,0.740664,4.2\n",
-    "Ori 32,1.443322,0.103813,4.2\n",
-    "Pup 11,2.080687,-0.399331,4.2\n",
-    "Aqr Psi1,6.090726,-0.158612,4.21\n",
-    "LMi Beta,2.739658,0.640662,4.21\n",
-    "Ori Zeta,1.486846,-0.033908,4.21\n",
-    "PsA Delta,6.003707,-0.567925,4.21\n",
-    "Aqr Phi,6.083883,-0.105573,4.22\n",
-    "Cep Theta,5.365062,1.099456,4.22\n",
-    "Cyg 52,5.435224,0.536160,4.22\n",
-    "Dra Phi,4.802964,1.245079,4.22\n",
-    "Pav Gamma,5.613168,-1.140854,4.22\n",
-    "Pav Lambda,4.940227,-1.085377,4.22\n",
-    "Sct Beta,4.918229,-0.082864,4.22\n",
-    "Tau Kappa1,1.157888,0.389102,4.22\n",
-    "Cen 1,3.602738,-0.576725,4.23\n",
-    "Cyg Chi,5.194820,0.574461,4.23\n",
-    "Cyg Pi2,5.701962,0.860612,4.23\n",
-    "Cyg Sigma,5.573782,0.687568,4.23\n",
-    "Eri Tau6,0.989813,-0.405784,4.23\n",
-    "Lup Theta,4.217552,-0.642320,4.23\n",
-    "Per 16,0.744317,0.668786,4.23\n",
-    "Per Psi,0.944616,0.841123,4.23\n",
-    "Tuc Zeta,0.087579,-1.132278,4.23\n",
-    "UMi Epsilon,4.389365,1.431820,4.23\n",
-    "Aps Beta,4.376748,-1.352936,4.24\n",
-    "Cap Alpha1,5.312993,-0.218312,4.24\n",
-    "And Phi,0.303266,0.824527,4.25\n",
-    "Ant Alpha,2.736465,-0.542235,4.25\n",
-    "Cet Pi,0.716123,-0.241878,4.25\n",
-    "Cnc Alpha,2.349591,0.206957,4.25\n",
-    "Dor Gamma,1.117127,-0.898612,4.25\n",
-    "Eri Kappa,0.641343,-0.832590,4.25\n",
-    "Lyn 31,2.194032,0.753774,4.25\n",
-    "Per 58,1.207288,0.720205,4.25\n",
-    "Tau 88,1.202772,0.177340,4.25\n",
-    "UMi 5,3.785292,1.321146,4.25\n",
-    "Aur Pi,1.570513,0.801751,4.26\n",
-    "CVn Beta,3.288818,0.721825,4.26\n",
-    "Cha Beta,3.221638,-1.384259,4.26\n",
-    "Com Beta,3.455199,0.486564,4.26\n",
-    "Her Phi,4.227057,0.784264,4.26\n",
-    "Psc Omicron,0.459865,0.159833,4.26\n",
-    "Ser Omicron,4.631297,-0.224716,4.26\n",
-    "Vir Tau,3.672376,0.026956,4.26\n",
-    "Aqr Iota,5.787672,-0.242072,4.27\n",
-    "Cen Xi2,3.433543,-0.871026,4.27\n",
-    "Cet Mu,0.719694,0.176526,4.27\n",
-    "Del Gamma2,5.439573,0.281420,4.27\n",
-    "Eri Lambda,1.348907,-0.152789,4.27\n",
-    "Eri Tau5,0.932828,-0.377563,4.27\n",
-    "Lup Mu,4.007858,-0.835576,4.27\n",
-    "Tau 90,1.213695,0.218355,4.27\n",
-    "Vel Gamma1,2.135796,-0.826341,4.27\n",
-    "Cap Iota,5.594857,-0.293816,4.28\n",
-    "Cet Xi2,0.646463,0.147655,4.28\n",
-    "Gem Sigma,2.021579,0.504114,4.28\n",
-    "Gru Theta,6.051406,-0.759577,4.28\n",
-    "Hya Beta,3.110657,-0.591807,4.28\n",
-    "Oph Phi,4.324657,-0.289948,4.28\n",
-    "Psc Epsilon,0.274642,0.137706,4.28\n",
-    "Psc Theta,6.143421,0.111333,4.28\n",
-    "Tau 10,0.946288,0.007010,4.28\n",
-    "Tau Tau,1.231526,0.400674,4.28\n",
-    "Tau Upsilon,1.161989,0.398173,4.28\n",
-    "And Iota,6.187789,0.755170,4.29\n",
-    "Cam Alpha,1.283035,1.157900,4.29\n",
-    "Cep Nu,5.696093,1.066760,4.29\n",
-    "Cep Xi,5.776124,1.127968,4.29\n",
-    "Lep Lambda,1.394409,-0.229976,4.29\n",
-    "Oph 45,4.569948,-0.521277,4.29\n",
-    "Peg Pi2,5.803162,0.579071,4.29\n",
-    "Per Lambda,1.075923,0.878798,4.29\n",
-    "PsA Beta,5.897053,-0.564546,4.29\n",
-    "Sgr Beta2,5.075505,-0.781903,4.29\n",
-    "Tau Delta3,1.158419,0.312904,4.29\n",
-    "Tau Mu,1.114982,0.155199,4.29\n",
-    "Cyg 33,5.294449,0.987294,4.3\n",
-    "Hya Eta,2.283000,0.059317,4.3\n",
-    "Leo Upsilon,3.041011,-0.014380,4.3\n",
-    "Lyr Delta2,4.950205,0.644007,4.3\n",
-    "Tau 19,0.982657,0.427034,4.3\n",
-    "Boo Mu1,4.033849,0.652356,4.31\n",
-    "Crv Eta,3.281524,-0.282675,4.31\n",
-    "Leo Lambda,2.494599,0.400868,4.31\n",
-    "Scl Alpha,0.255720,-0.512385,4.31\n",
-    "Aql 71,5.403270,-0.019291,4.32\n",
-    "CMi Gamma,1.955481,0.155780,4.32\n",
-    "Eri 54,1.223658,-0.343335,4.32\n",
-    "Hya 12,2.296744,-0.236453,4.32\n",
-    "Lup Omicron,3.890513,-0.760537,4.32\n",
-    "Oct Delta,3.782630,-1.460278,4.32\n",
-    "Sco Omega2,4.221101,-0.364226,4.32\n",
-    "UMi Zeta,4.119232,1.357769,4.32\n",
-    "CMa Xi1,1.709790,-0.408727,4.33\n",
-    "Cas Theta,0.310247,0.962544,4.33\n",
-    "Cru Theta1,3.154792,-1.105016,4.33\n",
-    "Lup Omega,4.093030,-0.742943,4.33\n",
-    "Lyr Kappa,4.799052,0.629443,4.33\n",
-    "Psc Alpha,0.532529,0.048234,4.33\n",
-    "Ser Nu,4.541470,-0.224221,4.33\n",
-    "Cen Upsilon2,3.672711,-0.795933,4.34\n",
-    "Lup 2,4.004796,-0.526197,4.34\n",
-    "Mon Zeta,2.131891,-0.052079,4.34\n",
-    "Oph Sigma,4.566283,0.072261,4.34\n",
-    "Peg 9,5.692006,0.302815,4.34\n",
-    "PsA Iota,5.693904,-0.576410,4.34\n",
-    "Ari Delta,0.836144,0.344295,4.35\n",
-    "Aur Kappa,1.637897,0.514838,4.35\n",
-    "Cha Theta,2.184461,-1.352359,4.35\n",
-    "Dor Delta,1.504357,-1.147302,4.35\n",
-    "Eri Theta2,0.777857,-0.703445,4.35\n",
-    "Lup Tau2,3.779423,-0.792021,4.35\n",
-    "Lyn 15,1.820706,1.019665,4.35\n",
-    "Pav Pi,4.749826,-1.111222,4.35\n",
-    "Vol Epsilon,2.128996,-1.197596,4.35\n",
-    "And Pi,0.160927,0.588515,4.36\n",
-    "Aql Iota,5.134417,-0.022452,4.36\n",
-    "Cen Chi,3.691575,-0.718722,4.36\n",
-    "Col Gamma,1.560048,-0.615810,4.36\n",
-    "Com Gamma,3.259133,0.493375,4.36\n",
-    "Her 102,4.750604,0.363281,4.36\n",
-    "Her 111,4.917560,0.317325,4.36\n",
-    "Hya Rho,2.305725,0.101888,4.36\n",
-    "Lac 5,5.888435,0.832643,4.36\n",
-    "Lep Kappa,1.366731,-0.225870,4.36\n",
-    "Lyr Theta,5.045609,0.665557,4.36\n",
-    "Lyr Zeta1,4.907750,0.656331,4.36\n",
-    "Ori Pi2,1.268033,0.155339,4.36\n",
-    "Pav Xi,4.813734,-1.073271,4.36\n",
-    "Per Sigma,0.918807,0.837676,4.36\n",
-    "Phe Eta,0.189165,-1.002920,4.36\n",
-    "Tau 37,1.067683,0.385403,4.36\n",
-    "UMi Delta,4.591154,1.511218,4.36\n",
-    "And Epsilon,0.168228,0.511585,4.37\n",
-    "CMa Iota,1.815739,-0.297651,4.37\n",
-    "Cet Xi1,0.580322,0.154403,4.37\n",
-    "Col Kappa,1.643017,-0.613318,4.37\n",
-    "Leo 31,2.652486,0.174489,4.37\n",
-    "Scl Beta,6.165252,-0.660054,4.37\n",
-    "Sge Alpha,5.149143,0.314402,4.37\n",
-    "Sge Beta,5.153296,0.305016,4.37\n",
-    "Sgr Theta1,5.234839,-0.615689,4.37\n",
-    "Tuc Beta1,0.137641,-1.098825,4.37\n",
-    "Oph Iota,4.424446,0.177418,4.38\n",
-    "Tau 119,1.449554,0.324534,4.38\n",
-    "Vir Theta,3.446807,-0.096672,4.38\n",
-    "Aqr 99,6.135036,-0.360270,4.39\n",
-    "Aqr Psi2,6.099504,-0.160265,4.39\n",
-    "Cep Kappa,5.274770,1.356320,4.39\n",
-    "Eri Omega,1.277996,-0.095169,4.39\n",
-    "Ind Theta,5.584472,-0.932874,4.39\n",
-    "Lyr Eta,5.034220,0.683229,4.39\n",
-    "Oph Xi,4.542234,-0.368487,4.39\n",
-    "CMa Tau,1.914219,-0.435532,4.4\n",
-    "Ind Delta,5.750504,-0.959800,4.4\n",
-    "Peg Upsilon,6.132127,0.408480,4.4\n",
-    "Pup 16,2.133781,-0.335889,4.4\n",
-    "Vir 110,3.939644,0.036502,4.4\n",
-    "Cep Pi,6.055849,1.315760,4.41\n",
-    "Gem Tau,1.881203,0.527880,4.41\n",
-    "Her Lambda,4.584711,0.455715,4.41\n",
-    "Her Nu,4.705859,0.526905,4.41\n",
-    "Hya 58,3.884616,-0.487999,4.41\n",
-    "Ori Chi1,1.546282,0.353885,4.41\n",
-    "Ori Phi1,1.460928,0.165622,4.41\n",
-    "Phe Psi,0.495877,-0.808131,4.41\n",
-    "Psc 30,0.008552,-0.104967,4.41\n",
-    "Scl Gamma,6.103518,-0.567790,4.41\n",
-    "UMa Xi,2.959133,0.550288,4.41\n",
-    "And Eta,0.249611,0.408712,4.42\n",
-    "Aqr 3,5.444278,-0.087751,4.42\n",
-    "Aqr Zeta2,5.885403,-0.000349,4.42\n",
-    "Eri Pi,0.986729,-0.211214,4.42\n",
-    "Leo 60,2.889960,0.352203,4.42\n",
-    "Lup Sigma,3.807501,-0.880640,4.42\n",
-    "Oph Chi,4.306702,-0.322125,4.42\n",
-    "Ori Nu,1.603834,0.257756,4.42\n",
-    "Boo Zeta,3.844735,0.239605,4.43\n",
-    "CMa Nu3,1.736123,-0.318304,4.43\n",
-    "Cyg 39,5.340104,0.561821,4.43\n",
-    "Cyg Upsilon,5.575971,0.609067,4.43\n",
-    "Del Delta,5.425611,0.263099,4.43\n",
-    "Eri Omicron2,1.113833,-0.133566,4.43\n",
-    "Lac Beta,5.862386,0.911571,4.43\n",
-    "Psc Delta,0.212421,0.132383,4.43\n",
-    "Ser Lambda,4.129638,0.128335,4.43\n",
-    "Cet 7,0.063879,-0.330439,4.44\n",
-    "Hya Sigma,2.263503,0.058318,4.44\n",
-    "Mon Epsilon,1.674505,0.080159,4.44\n",
-    "Pav Kappa,4.960880,-1.173448,4.44\n",
-    "Psc Nu,0.442579,0.095775,4.44\n",
-    "Ret Epsilon,1.119112,-1.035014,4.44\n",
-    "Vul Alpha,5.099438,0.430485,4.44\n",
-    "Aql Mu,5.122934,0.128786,4.45\n",
-    "Cae Alpha,1.224181,-0.730663,4.45\n",
-    "Cha Delta2,2.817747,-1.405693,4.45\n",
-    "Dra Tau,5.042038,1.280296,4.45\n",
-    "Lep Iota,1.362659,-0.207156,4.45\n",
-    "Oph 68,4.720039,0.022781,4.45\n",
-    "Oph Omega,4.329013,-0.374659,4.45\n",
-    "Boo Sigma,3.816511,0.519148,4.46\n",
-    "For Beta,0.737794,-0.565588,4.46\n",
-    "Gru Lambda,5.786268,-0.690161,4.46\n",
-    "Lac 11,5.936367,0.772769,4.46\n",
-    "Leo Kappa,2.463772,0.456966,4.46\n",
-    "Ori Rho,1.366993,0.049936,4.46\n",
-    "PsA Gamma,5.988777,-0.573787,4.46\n",
-    "Aqr 86,6.050540,-0.414394,4.47\n",
-    "Cam 7,1.297158,0.938153,4.47\n",
-    "Eri Tau1,0.720399,-0.324151,4.47\n",
-    "Leo Phi,2.952494,-0.063734,4.47\n",
-    "Mon 18,1.779625,0.042101,4.47\n",
-    "Nor Epsilon,4.307407,-0.829991,4.47\n",
-    "Ori Pi6,1.302663,0.029918,4.47\n",
-    "CMa Lambda,1.693704,-0.568628,4.48\n",
-    "Crt Beta,2.930662,-0.398386,4.48\n",
-    "Cyg Theta,5.133195,0.876524,4.48\n",
-    "LMi 21,2.650413,0.615136,4.48\n",
-    "Lyn 2,1.656419,1.029933,4.48\n",
-    "Ori Xi,1.622894,0.247992,4.48\n",
-    "Tuc Delta,5.878851,-1.133877,4.48\n",
-    "UMa 15,2.394904,0.900672,4.48\n",
-    "Aqr Omega2,6.207794,-0.253858,4.49\n",
-    "Equ Delta,5.560975,0.174654,4.49\n",
-    "Gem 30,1.762732,0.230868,4.49\n",
-    "Lib 16,3.914701,-0.075859,4.49\n",
-    "Sex Alpha,2.652631,-0.006487,4.49\n",
-    "Tau 71,1.162157,0.272591,4.49\n",
-    "Boo Tau,3.609610,0.304676,4.5\n",
-    "Cap 24,5.528890,-0.436434,4.5\n",
-    "Leo 54,2.860653,0.431964,4.5\n",
-    "Mon 13,1.714364,0.127986,4.5\n",
-    "Oph Psi,4.293961,-0.349720,4.5\n",
-    "PsA Mu,5.796166,-0.575760,4.5\n",
-    "Psc Lambda,6.204849,0.031067,4.5\n",
-    "Pup Omicron,2.042413,-0.452690,4.5\n",
-    "Tuc Epsilon,6.282822,-1.144538,4.5\n",
-    "UMa 26,2.508147,0.908468,4.5\n",
-    "Ant Epsilon,2.483800,-0.627470,4.51\n",
-    "Aqr Nu,5.539653,-0.198473,4.51\n",
-    "Ari 39,0.732638,0.510460,4.51\n",
-    "Cap 36,5.623116,-0.380608,4.51\n",
-    "Cir Gamma,4.028998,-1.035344,4.51\n",
-    "Dra Rho,5.248285,1.184618,4.51\n",
-    "Eri Upsilon1,1.193413,-0.519526,4.51\n",
-    "Ind Eta,5.428141,-0.906194,4.51\n",
-    "Lac 6,5.892617,0.752644,4.51\n",
-    "Pic Gamma,1.526414,-0.980293,4.51\n",
-    "Psc Tau,0.312676,0.525165,4.51\n",
-    "Ret Gamma,1.051110,-1.084887,4.51\n",
-    "And 7,6.076146,0.862304,4.52\n",
-    "And Sigma,0.079972,0.642024,4.52\n",
-    "Aur Tau,1.523563,0.683839,4.52\n",
-    "Cas Iota,0.650426,1.176396,4.52\n",
-    "Her Rho,4.553928,0.648317,4.52\n",
-    "Peg 55,6.051951,0.164226,4.52\n",
-    "Ser Iota,4.108294,0.343311,4.52\n",
-    "Sgr 59,5.222665,-0.474206,4.52\n",
-    "Vir Lambda,3.748575,-0.233370,4.52\n",
-    "Vul 23,5.304790,0.485449,4.52\n",
-    "And Nu,0.217352,0.716962,4.53\n",
-    "Cyg Lambda,5.442846,0.636885,4.53\n",
-    "Leo 93,3.089167,0.352886,4.53\n",
-    "Per 17,0.748368,0.611908,4.53\n",
-    "Psc Beta,6.038301,0.066672,4.53\n",
-    "Tel Epsilon,4.761389,-0.802056,4.53\n",
-    "Aur 16,1.388315,0.582445,4.54\n",
-    "Boo Kappa2,3.724024,0.903911,4.54\n",
-    "Boo Psi,3.946386,0.470323,4.54\n",
-    "CMa Xi2,1.723760,-0.400810,4.54\n",
-    "CMi 6,1.962608,0.209556,4.54\n",
-    "Cas 48,0.532136,1.237560,4.54\n",
-    "Cas Omicron,0.195150,0.842723,4.54\n",
-    "Cas Rho,6.258678,1.003555,4.54\n",
-    "Lib Iota1,3.980318,-0.345430,4.54\n",
-    "Lup Phi2,4.028031,-0.643304,4.54\n",
-    "Sgr 3,4.658109,-0.485740,4.54\n",
-    "Tuc Beta2,0.137706,-1.098961,4.54\n",
-    "Boo Xi,3.889415,0.333377,4.55\n",
-    "Cae Gamma1,1.328225,-0.619301,4.55\n",
-    "Cet 2,0.016319,-0.302572,4.55\n",
-    "Cyg 63,5.526592,0.831620,4.55\n",
-    "LMi 10,2.505522,0.635256,4.55\n",
-    "Peg 70,6.148599,0.222714,4.55\n",
-    "Sco Omicron,4.278835,-0.421836,4.55\n",
-    "Cen 3,3.629529,-0.575862,4.56\n",
-    "Cep 11,5.680705,1.244619,4.56\n",
-    "Lup Tau1,3.779234,-0.789262,4.56\n",
-    "Ret Delta,1.041722,-1.071637,4.56\n",
-    "UMa 24,2.506649,1.218768,4.56\n",
-    "Her Omega,4.299691,0.244928,4.57\n",
-    "Hya Tau2,2.495741,-0.020682,4.57\n",
-    "Lac 2,5.851333,0.812218,4.57\n",
-    "Lac 4,5.866561,0.863526,4.57\n",
-    "Ori Omega,1.479974,0.071932,4.57\n",
-    "Peg 2,5.628461,0.412576,4.57\n",
-    "Scl Delta,6.234869,-0.490966,4.57\n",
-    "Dra Psi1,4.633580,1.259236,4.58\n",
-    "Pyx Kappa,2.391312,-0.451313,4.58\n",
-    "Sgr 62,5.247587,-0.483626,4.58\n",
-    "Tau 136,1.541678,0.481924,4.58\n",
-    "Vul 13,5.207459,0.420270,4.58\n",
-    "Aqr Zeta1,5.885374,-0.000354,4.59\n",
-    "Ara Sigma,4.606186,-0.811675,4.59\n",
-    "CrA Delta,5.010615,-0.706800,4.59\n",
-    "Dra Pi,5.064371,1.146938,4.59\n",
-    "Her 113,4.951274,0.395230,4.59\n",
-    "Ori 42,1.463400,-0.084445,4.59\n",
-    "Ori Psi2,1.426094,0.054028,4.59\n",
-    "Phe Mu,0.180322,-0.804335,4.59\n",
-    "Pup 1,2.022575,-0.495867,4.59\n",
-    "Sco 13,4.242474,-0.487407,4.59\n",
-    "Sco 2,4.160916,-0.442043,4.59\n",
-    "UMa Phi,2.583553,0.943603,4.59\n",
-    "Vul 31,5.463441,0.472931,4.59\n",
-    "Ant Iota,2.865474,-0.648176,4.6\n",
-    "Boo Omicron,3.862595,0.296085,4.6\n",
-    "Hya Tau1,2.483378,-0.048326,4.6\n",
-    "Hya Upsilon2,2.640356,-0.228022,4.6\n",
-    "Mon Beta,1.696533,-0.122745,4.6\n",
-    "Peg Tau,6.111430,0.414346,4.6\n",
-    "Sgr 52,5.134351,-0.434301,4.6\n",
-    "UMa Pi2,2.269859,1.122732,4.6\n",
-    "And Theta,0.074576,0.675122,4.61\n",
-    "Cyg 47,5.383919,0.615243,4.61\n",
-    "Psc 33,0.023278,-0.099615,4.61\n",
-    "Sgr Upsilon,5.068989,-0.278467,4.61\n",
-    "Cru Lambda,3.380063,-1.032304,4.62\n",
-    "Her Chi,4.156829,0.740921,4.62\n",
-    "Lib 37,4.076122,-0.175658,4.62\n",
-    "Oph Mu,4.615720,-0.141701,4.62\n",
-    "Ori Upsilon,1.448318,-0.127433,4.62\n",
-    "Psc Xi,0.495477,0.055632,4.62\n",
-    "Ser Theta1,4.957695,0.073367,4.62\n",
-    "Ser Zeta,4.714498,-0.064407,4.62\n",
-    "Ari Epsilon,0.781958,0.372458,4.63\n",
-    "Cam Gamma,1.005128,1.244982,4.63\n",
-    "Cas Upsilon2,0.247240,1.032905,4.63\n",
-    "CrB Delta,4.143390,0.454978,4.63\n",
-    "Lac 9,5.922658,0.899635,4.63\n",
-    "Leo 72,2.946130,0.403093,4.63\n",
-    "Leo Chi,2.901683,0.128039,4.63\n",
-    "Nor Iota1,4.204200,-1.008369,4.63\n",
-    "Oph Upsilon,4.310098,-0.146113,4.63\n",
-    "Ori Chi2,1.587901,0.351480,4.63\n",
-    "Per Omega,0.834660,0.691354,4.63\n",
-    "CrA Theta,4.858575,-0.738492,4.64\n",
-    "Lyn 21,1.949155,0.858901,4.64\n",
-    "Oph 66,4.713538,0.076247,4.64\n",
-    "Oph 71,4.744270,0.152435,4.64\n",
-    "Pav Nu,4.849281,-1.086962,4.64\n",
-    "Sco 1,4.149426,-0.449447,4.64\n",
-    "Tau Iota,1.322501,0.376817,4.64\n",
-    "Vul 15,5.240795,0.484392,4.64\n",
-    "And 3,6.039639,0.873576,4.65\n",
-    "Dra 10,3.627805,1.129635,4.65\n",
-    "Eri Tau8,1.019752,-0.429569,4.65\n",
-    "Gem 38,1.809230,0.229996,4.65\n",
-    "Her 69,4.527697,0.650862,4.65\n",
-    "Nor Eta,4.202818,-0.859221,4.65\n",
-    "Oph 20,4.406229,-0.188200,4.65\n",
-    "Ori Pi1,1.286729,0.177165,4.65\n",
-    "Psc Phi,0.321788,0.429065,4.65\n",
-    "Tau Rho,1.194889,0.259084,4.65\n",
-    "Aql Nu,5.089896,0.005910,4.66\n",
-    "Aqr Pi,5.869877,0.024042,4.66\n",
-    "Ari 35,0.713192,0.483582,4.66\n",
-    "CMa 27,1.894788,-0.459938,4.66\n",
-    "Cnc Gamma,2.283262,0.374698,4.66\n",
-    "Dra Omicron,4.935798,1.036522,4.66\n",
-    "Eri Tau9,1.046870,-0.419165,4.66\n",
-    "Mon 15,1.749598,0.172710,4.66\n",
-    "Peg Psi,6.273404,0.438800,4.66\n",
-    "Psc Chi,0.311774,0.367125,4.66\n",
-    "UMa 83,3.581147,0.954375,4.66\n",
-    "Vir Chi,3.312839,-0.139549,4.66\n",
-    "Vir Pi,3.145403,0.115439,4.66\n",
-    "Cet Chi,0.478155,-0.186513,4.67\n",
-    "Cyg Pi1,5.681461,0.893429,4.67\n",
-    "Her 93,4.712636,0.292357,4.67\n",
-    "Lep Theta,1.597653,-0.260670,4.67\n",
-    "Lup Psi1,4.100506,-0.600602,4.67\n",
-    "Mic Gamma,5.503423,-0.563004,4.67\n",
-    "Per 34,0.913542,0.864093,4.67\n",
-    "UMa Tau,2.403835,1.108522,4.67\n",
-    "Aps Delta1,4.277569,-1.373501,4.68\n",
-    "CMa Pi,1.813499,-0.351446,4.68\n",
-    "Cap Epsilon,5.659579,-0.339748,4.68\n",
-    "Del Zeta,5.390049,0.256113,4.68\n",
-    "Dra Sigma,5.115386,1.215816,4.68\n",
-    "Mon 28,2.099726,-0.024304,4.68\n",
-    "Ori 11,1.328930,0.268853,4.68\n",
-    "Sct Zeta,4.815618,-0.155931,4.68\n",
-    "Aqr 66,5.949777,-0.328650,4.69\n",
-    "Aqr 89,6.064641,-0.391957,4.69\n",
-    "Aqr Omicron,5.774051,-0.037617,4.69\n",
-    "Aqr Xi,5.662510,-0.137081,4.69\n",
-    "Cru Iota,3.340698,-1.064321,4.69\n",
-    "Cyg Phi,5.146001,0.526275,4.69\n",
-    "Equ Gamma,5.542911,0.176831,4.69\n",
-    "For Nu,0.543190,-0.511328,4.69\n",
-    "Hyi Eta2,0.501499,-1.180667,4.69\n",
-    "Ind Epsilon,5.774247,-0.991105,4.69\n",
-    "Pyx Lambda,2.457445,-0.503246,4.69\n",
-    "Sgr Gamma1,4.734300,-0.516268,4.69\n",
-    "Tau Pi,1.163291,0.256801,4.69\n",
-    "Tau Sigma2,1.218567,0.277822,4.69\n",
-    "Vir 74,3.542866,-0.109185,4.69\n",
-    "CVn 24,3.553730,0.855493,4.7\n",
-    "Cet Lambda,0.784155,0.155465,4.7\n",
-    "Crt Theta,3.039847,-0.171081,4.7\n",
-    "Hya Omicron,3.055257,-0.606410,4.7\n",
-    "Leo Pi,2.618925,0.140397,4.7\n",
-    "Per Pi,0.779995,0.692246,4.7\n",
-    "Sct Gamma,4.839791,-0.254222,4.7\n",
-    "Sgr Omega,5.217836,-0.459012,4.7\n",
-    "And 65,0.635402,0.877527,4.71\n",
-    "Aql Xi,5.210891,0.147679,4.71\n",
-    "Aqr 101,6.166583,-0.365026,4.71\n",
-    "Aur Lambda,1.392518,0.699862,4.71\n",
-    "Cas Chi,0.409854,1.033792,4.71\n",
-    "LMi 37,2.786942,0.558088,4.71\n",
-    "Mic Epsilon,5.576058,-0.561516,4.71\n",
-    "Ori 31,1.438733,-0.019063,4.71\n",
-    "Per 52,1.112160,0.706572,4.71\n",
-    "Phe Iota,6.174437,-0.743772,4.71\n",
-    "UMa Omega,2.853519,0.753808,4.71\n",
-    "Cru Theta2,3.160442,-1.102447,4.72\n",
-    "Dor Zeta,1.333039,-1.003089,4.72\n",
-    "Lup Pi,3.949331,-0.821197,4.72\n",
-    "Mus Mu,3.090273,-1.166137,4.72\n",
-    "Nor Delta,4.217108,-0.788423,4.72\n",
-    "Pup 19,2.143577,-0.225618,4.72\n",
-    "Pyx Theta,2.449977,-0.453184,4.72\n",
-    "Ret Kappa,0.913585,-1.098467,4.72\n",
-    "Sct Delta,4.896841,-0.157996,4.72\n",
-    "Aqr Mu,5.465731,-0.156789,4.73\n",
-    "CVn 20,3.479932,0.708124,4.73\n",
-    "Cap Kappa,5.683919,-0.329281,4.73\n",
-    "Cas Lambda,0.138637,0.951592,4.73\n",
-    "Cen 4,3.635557,-0.557245,4.73\n",
-    "Cep 9,5.663244,1.083534,4.73\n",
-    "Crt Zeta,3.075110,-0.320282,4.73\n",
-    "Cyg Mu1,5.690399,0.501656,4.73\n",
-    "Eri 17,0.918996,-0.088580,4.73\n",
-    "Oph 41,4.523072,-0.007772,4.73\n",
-    "Ori 22,1.403950,-0.006676,4.73\n",
-    "Sco Zeta1,4.424388,-0.739360,4.73\n",
-    "Aur Upsilon,1.531701,0.651105,4.74\n",
-    "Cas Psi,0.374955,1.189093,4.74\n",
-    "Com 11,3.231986,0.310543,4.74\n",
-    "Cyg 59,5.497031,0.829400,4.74\n",
-    "Cyg 8,5.112818,0.601319,4.74\n",
-    "LMi 30,2.731069,0.589853,4.74\n",
-    "Leo 61,2.887771,-0.043367,4.74\n",
-    "Lib Kappa,4.110018,-0.343461,4.74\n",
-    "Ori Omicron1,1.276417,0.248719,4.74\n",
-    "Vir 61,3.483699,-0.319594,4.74\n",
-    "Ari Gamma2,0.495368,0.336737,4.75\n",
-    "Boo Iota,3.735725,0.896527,4.75\n",
-    "Cep Omicron,6.102653,1.188773,4.75\n",
-    "Cet Sigma,0.663603,-0.266071,4.75\n",
-    "CrA Zeta,4.987780,-0.734701,4.75\n",
-    "Eri Tau2,0.746296,-0.366592,4.75\n",
-    "Hyi Nu,0.743838,-1.310165,4.75\n",
-    "Lup Psi2,4.113232,-0.605813,4.75\n",
-    "Aur Chi,1.451801,0.561855,4.76\n",
-    "Boo 44,3.943528,0.831727,4.76\n",
-    "Cap Nu,5.326149,-0.222689,4.76\n",
-    "Cet Phi1,0.192815,-0.185170,4.76\n",
-    "CrB Tau,4.227936,0.636885,4.76\n",
-    "Her Upsilon,4.201000,0.803491,4.76\n",
-    "Pav Phi1,5.391235,-1.057350,4.76\n",
-    "Peg 56,6.052424,0.444506,4.76\n",
-    "Psc Upsilon,0.346739,0.475849,4.76\n",
-    "Ser Rho,4.150677,0.366131,4.76\n",
-    "Sgr 4,4.711487,-0.415670,4.76\n",
-    "UMa Rho,2.367299,1.180361,4.76\n",
-    "Vir 69,3.523180,-0.278792,4.76\n",
-    "Ara Lambda,4.626839,-0.862464,4.77\n",
-    "Cet 20,0.231292,-0.019969,4.77\n",
-    "Dra 45,4.854524,0.995633,4.77\n",
-    "Hya 51,3.765970,-0.484397,4.77\n",
-    "Leo 87,3.012067,-0.052423,4.77\n",
-    "Mon 17,1.777312,0.140276,4.77\n",
-    "Phe Lambda1,0.137081,-0.851784,4.77\n",
-    "Sco Xi,4.207851,-0.198497,4.77\n",
-    "Vul 1,5.044947,0.373331,4.77\n",
-    "Aps Zeta,4.546539,-1.182819,4.78\n",
-    "Aur 2,1.276854,0.640589,4.78\n",
-    "Cap Rho,5.361913,-0.310906,4.78\n",
-    "Com 36,3.398694,0.303852,4.78\n",
-    "Cyg 57,5.468320,0.774703,4.78\n",
-    "Oct Theta,0.006960,-1.345053,4.78\n",
-    "Ori 56,1.537810,0.032376,4.78\n",
-    "UMa 55,2.963271,0.666464,4.78\n",
-    "Ant Theta,2.549061,-0.484668,4.79\n",
-    "Ari Lambda,0.514559,0.411830,4.79\n",
-    "Aur Psi2,1.742413,0.741571,4.79\n",
-    "Cep 24,5.802376,1.262591,4.79\n",
-    "Eri 32,1.022290,-0.051570,4.79\n",
-    "Eri 64,1.308692,-0.218821,4.79\n",
-    "Gru Mu1,5.827720,-0.721635,4.79\n",
-    "Hya 26,2.442472,-0.209003,4.79\n",
-    "Leo 40,2.704104,0.339830,4.79\n",
-    "Peg 35,5.881141,0.081953,4.79\n",
-    "Peg Omicron,5.941784,0.511512,4.79\n",
-    "Sco 22,4.320592,-0.438339,4.79\n",
-    "Vir Psi,3.378754,-0.166485,4.79\n",
-    "CVn 5,3.246421,0.899931,4.8\n",
-    "Cas Xi,0.183543,0.881609,4.8\n",
-    "Com 41,3.434713,0.482142,4.8\n",
-    "Dra Omega,4.611822,1.200054,4.8\n",
-    "Eri Zeta,0.854484,-0.153933,4.8\n",
-    "Hya 27,2.445570,-0.166781,4.8\n",
-    "Mus Eta,3.469925,-1.184982,4.8\n",
-    "Ori 49,1.478665,-0.125892,4.8\n",
-    "Peg Chi,0.063719,0.352673,4.8\n",
-    "Tau Delta2,1.152339,0.304453,4.8\n",
-    "UMa Sigma2,2.401515,1.171722,4.8\n",
-    "Vir Sigma,3.480208,0.095465,4.8\n",
-    "Boo 34,3.854661,0.462997,4.81\n",
-    "Boo Omega,3.936190,0.436473,4.81\n",
-    "Com 12,3.239789,0.451100,4.81\n",
-    "Com 23,3.293662,0.394953,4.81\n",
-    "Cyg 34,5.313597,0.663802,4.81\n",
-    "Eri Psi,1.315273,-0.125208,4.81\n",
-    "Oph 51,4.587671,-0.418229,4.81\n",
-    "Peg 32,5.852620,0.494461,4.81\n",
-    "Pic Delta,1.615731,-0.959383,4.81\n",
-    "Scl Eta,0.121860,-0.576085,4.81\n",
-    "Sco Iota2,4.669570,-0.699712,4.81\n",
-    "Sgr 21,4.822999,-0.358520,4.81\n",
-    "Tuc Nu,5.903583,-1.081794,4.81\n",
-    "Vir Phi,3.788244,-0.038887,4.81\n",
-    "And 58,0.560636,0.660767,4.82\n",
-    "Aqr 104,6.203613,-0.310955,4.82\n",
-    "Aqr Sigma,5.893308,-0.186367,4.82\n",
-    "CVn 25,3.566842,0.633467,4.82\n",
-    "CrB Kappa,4.150531,0.622341,4.82\n",
-    "Dra 42,4.825770,1.144301,4.82\n",
-    "Dra Upsilon,4.949746,1.244371,4.82\n",
-    "Her 52,4.403626,0.802561,4.82\n",
-    "Her 68,4.526184,0.577704,4.82\n",
-    "Lup Pi,3.949331,-0.821197,4.82\n",
-    "Mic Theta1,5.588370,-0.712264,4.82\n",
-    "Oph 30,4.455215,-0.073697,4.82\n",
-    "Ori 15,1.351321,0.272223,4.82\n",
-    "Ser Sigma,4.285103,0.017962,4.82\n",
-    "Tau 139,1.562048,0.452981,4.82\n",
-    "UMi 4,3.703800,1.353459,4.82\n",
-    "Vul 29,5.404070,0.370029,4.82\n",
-    "And 60,0.581289,0.771988,4.83\n",
-    "And Omega,0.382474,0.792496,4.83\n",
-    "Ari Gamma1,0.495368,0.336776,4.83\n",
-    "Boo 12,3.710563,0.437932,4.83\n",
-    "Boo Zeta,3.844735,0.239605,4.83\n",
-    "CMa 15,1.804445,-0.352978,4.83\n",
-    "Cas Upsilon1,0.239990,1.029269,4.83\n",
-    "Cet Kappa1,0.869879,0.058822,4.83\n",
-    "Col Omicron,1.385290,-0.609037,4.83\n",
-    "Crt Epsilon,2.987175,-0.189533,4.83\n",
-    "Cyg 30,5.294020,0.817090,4.83\n",
-    "Dor Theta,1.369022,-1.172604,4.83\n",
-    "Dra 18,4.367330,1.127294,4.83\n",
-    "Sct Eta,4.961367,-0.102034,4.83\n",
-    "Ser Pi,4.198804,0.398013,4.83\n",
-    "Sgr 60,5.231421,-0.457199,4.83\n",
-    "Sgr Nu1,4.948750,-0.396975,4.83\n",
-    "UMa 18,2.426829,0.942861,4.83\n",
-    "And Gamma2,0.540667,0.738812,4.84\n",
-    "Cap Eta,5.517008,-0.346535,4.84\n",
-    "Cet Epsilon,0.696226,-0.207209,4.84\n",
-    "Cyg 55,5.449522,0.804844,4.84\n",
-    "Her 29,4.331056,0.200504,4.84\n",
-    "Hyi Zeta,0.722319,-1.180133,4.84\n",
-    "Leo 58,2.882237,0.063137,4.84\n",
-    "Lyn 27,2.131294,0.898961,4.84\n",
-    "Peg Nu,5.784370,0.088289,4.84\n",
-    "Psc Mu,0.393506,0.107231,4.84\n",
-    "Tau 47,1.108022,0.161681,4.84\n",
-    "UMa 36,2.751628,0.977045,4.84\n",
-    "And 8,6.098813,0.855478,4.85\n",
-    "Cas 1,6.050249,1.037070,4.85\n",
-    "Cen Xi1,3.418896,-0.864413,4.85\n",
-    "Cet 56,0.509069,-0.393169,4.85\n",
-    "CrB Xi,4.285205,0.539166,4.85\n",
-    "Gru Eta,5.958692,-0.933756,4.85\n",
-    "Gru Rho,5.949391,-0.722818,4.85\n",
-    "Per 53,1.141242,0.811559,4.85\n",
-    "Sgr Psi,5.041994,-0.440812,4.85\n",
-    "Vir Xi,3.077386,0.144135,4.85\n",
-    "Aur Mu,1.367589,0.671680,4.86\n",
-    "Boo 20,3.751382,0.284610,4.86\n",
-    "Boo 31,3.846909,0.142448,4.86\n",
-    "Cet Nu,0.680133,0.097622,4.86\n",
-    "Cir Epsilon,4.003996,-1.110214,4.86\n",
-    "Oph 74,4.803444,0.058944,4.86\n",
-    "Psc 27,6.277397,-0.062066,4.86\n",
-    "Sgr 56,5.176479,-0.344896,4.86\n",
-    "Tau 126,1.489180,0.288571,4.86\n",
-    "Tau 132,1.522872,0.428784,4.86\n",
-    "Tuc Kappa,0.330602,-1.202115,4.86\n",
-    "Cas Tau,6.226717,1.023670,4.87\n",
-    "Col Lambda,1.540755,-0.589946,4.87\n",
-    "CrA Epsilon,4.968618,-0.647648,4.87\n",
-    "Dra Nu2,4.591379,0.962951,4.87\n",
-    "Eri 39,1.110008,-0.179008,4.87\n",
-    "Lyn 12,1.772535,1.037453,4.87\n",
-    "Oph 58,4.640089,-0.378446,4.87\n",
-    "Tel Lambda,4.967476,-0.923953,4.87\n",
-    "Tri Delta,0.598008,0.597324,4.87\n",
-    "UMa Xi,2.959126,0.550288,4.87\n",
-    "And Xi,0.359276,0.794629,4.88\n",
-    "Cas Sigma,6.278858,0.973108,4.88\n",
-    "Dra Nu1,4.590987,0.963145,4.88\n",
-    "Eri 15,0.865545,-0.392898,4.88\n",
-    "Gem 81,2.033847,0.323060,4.88\n",
-    "Hya 9,2.276440,-0.278264,4.88\n",
-    "Lac 10,5.930898,0.681556,4.88\n",
-    "Lib 48,4.180893,-0.249223,4.88\n",
-    "Pav Rho,5.399998,-1.073901,4.88\n",
-    "Tau 114,1.429577,0.382872,4.88\n",
-    "Vir Rho,3.324350,0.178644,4.88\n",
-    "Aql 70,5.396238,-0.044506,4.89\n",
-    "Ari Zeta,0.850419,0.367295,4.89\n",
-    "Cas Nu,0.213083,0.889565,4.89\n",
-    "Cet 6,0.049153,-0.269968,4.89\n",
-    "Cet Rho,0.636827,-0.214511,4.89\n",
-    "Cyg 15,5.167382,0.651958,4.89\n",
-    "Dra 19,4.433260,1.136815,4.89\n",
-    "Ind Zeta,5.451900,-0.806812,4.89\n",
-    "Pyx Delta,2.336669,-0.483141,4.89\n",
-    "Pyx Zeta,2.267655,-0.515939,4.89\n",
-    "Aur 63,1.883450,0.686273,4.9\n",
-    "Cet 46,0.373588,-0.254799,4.9\n",
-    "Com 35,3.374143,0.370795,4.9\n",
-    "Com 37,3.404592,0.537300,4.9\n",
-    "Cyg 72,5.649529,0.672548,4.9\n",
-    "For Omega,0.671275,-0.492750,4.9\n",
-    "Gem Omicron,2.003485,0.603608,4.9\n",
-    "Her 42,4.357862,0.853961,4.9\n",
-    "Lyn 16,1.822204,0.787042,4.9\n",
-    "Mic Alpha,5.454016,-0.589567,4.9\n",
-    "Peg Rho,6.000566,0.153865,4.9\n",
-    "Sct Epsilon,4.902288,-0.144431,4.9\n",
-    "Tel Iota,5.127850,-0.839489,4.9\n",
-    "Aps Eta,3.744735,-1.413852,4.91\n",
-    "Aql 69,5.365360,-0.050362,4.91\n",
-    "Aur Psi1,1.679436,0.860239,4.91\n",
-    "Boo 6,3.620307,0.371130,4.91\n",
-    "Cha Epsilon,3.139942,-1.365230,4.91\n",
-    "Eri 45,1.186293,-0.000766,4.91\n",
-    "Her 60,4.474057,0.222369,4.91\n",
-    "Hya Phi3,2.786345,-0.294553,4.91\n",
-    "Lup 1,3.990790,-0.550113,4.91\n",
-    "Ori 51,1.494336,0.025739,4.91\n",
-    "Per 12,0.707942,0.701516,4.91\n",
-    "Tau 134,1.525192,0.220804,4.91\n",
-    "TrA Zeta,4.313007,-1.223204,4.91\n",
-    "Vul 30,5.431792,0.441054,4.91\n",
-    "Cyg Psi,5.216920,0.915231,4.92\n",
-    "Lib Delta,3.931238,-0.148683,4.92\n",
-    "Mon 20,1.877225,-0.073953,4.92\n",
-    "PsA Tau,5.803860,-0.568076,4.92\n",
-    "Sco Beta2,4.212534,-0.345609,4.92\n",
-    "Boo 45,3.958850,0.434049,4.93\n",
-    "CrA Gamma,5.002194,-0.646877,4.93\n",
-    "Cyg 28,5.277119,0.642974,4.93\n",
-    "Hor Delta,1.094511,-0.732927,4.93\n",
-    "Lep 17,1.592547,-0.287708,4.93\n",
-    "Lyr Lambda,4.974254,0.561046,4.93\n",
-    "Mon 27,2.093239,-0.064223,4.93\n",
-    "Peg 78,6.213336,0.512458,4.93\n",
-    "Per 24,0.781304,0.614060,4.93\n",
-    "Per 54,1.136253,0.603302,4.93\n",
-    "UMa 78,3.406577,0.983779,4.93\n",
-    "And Tau,0.438863,0.708201,4.94\n",
-    "Aur Omega,1.305754,0.661310,4.94\n",
-    "Boo Pi1,3.842895,0.286554,4.94\n",
-    "Cas Pi,0.189666,0.820736,4.94\n",
-    "Cet 3,0.019642,-0.183424,4.94\n",
-    "Com 31,3.367169,0.480673,4.94\n",
-    "Cyg 22,5.217931,0.671719,4.94\n",
-    "Dra 6,3.293145,1.222113,4.94\n",
-    "Gem Chi,2.109747,0.485100,4.94\n",
-    "Hya 54,3.865912,-0.444065,4.94\n",
-    "Hya Chi1,2.903057,-0.476363,4.94\n",
-    "Lac 15,5.986625,0.755946,4.94\n",
-    "Lib 11,3.887794,-0.040128,4.94\n",
-    "Lib Epsilon,4.032576,-0.180157,4.94\n",
-    "Nor Kappa,4.247601,-0.953483,4.94\n",
-    "Nor Mu,4.337507,-0.768735,4.94\n",
-    "Psc Kappa,6.138905,0.021914,4.94\n",
-    "Sco Psi,4.241150,-0.175653,4.94\n",
-    "Tau 109,1.393107,0.385655,4.94\n",
-    "Tau Omega2,1.122509,0.359165,4.94\n",
-    "Tel Xi,5.268218,-0.922945,4.94\n",
-    "Tri 6,0.577580,0.528888,4.94\n",
-    "Vir 78,3.552320,0.063860,4.94\n",
-    "And Psi,6.222251,0.810187,4.95\n",
-    "Aql Kappa,5.135159,-0.122653,4.95\n",
-    "Aql Rho,5.298281,0.265246,4.95\n",
-    "Com 14,3.256792,0.475922,4.95\n",
-    "Com 7,3.212897,0.417924,4.95\n",
-    "Cyg Omega1,5.367142,0.854368,4.95\n",
-    "Dra 4,3.272980,1.207787,4.95\n",
-    "Her 106,4.800957,0.383299,4.95\n",
-    "Hya Psi,3.442902,-0.403486,4.95\n",
-    "Leo Tau,3.001690,0.049849,4.95\n",
-    "Mon 3,1.578825,-0.184971,4.95\n",
-    "Ori 69,1.623396,0.281531,4.95\n",
-    "Ori Psi1,1.416975,0.032226,4.95\n",
-    "Per 32,0.878955,0.756241,4.95\n",
-    "Tau Phi,1.136013,0.477362,4.95\n",
-    "UMi Eta,4.265170,1.322179,4.95\n",
-    "Vul 12,5.197016,0.394619,4.95\n",
-    "Her 95,4.718963,0.376914,4.96\n",
-    "Lib 42,4.102753,-0.415703,4.96\n",
-    "Phe Nu,0.328056,-0.794673,4.96\n",
-    "Sgr 43,5.051136,-0.330793,4.96\n",
-    "Tel Delta1,4.850954,-0.801368,4.96\n",
-    "UMi Theta,4.064065,1.350002,4.96\n",
-    "Vir 16,3.230386,0.057814,4.96\n",
-    "Col Xi,1.551154,-0.647881,4.97\n",
-    "Cyg 2,5.079461,0.516991,4.97\n",
-    "Cyg 29,5.299401,0.642393,4.97\n",
-    "Gem Phi,2.066019,0.467152,4.97\n",
-    "Her 104,4.764327,0.548125,4.97\n",
-    "Hya 52,3.788121,-0.514727,4.97\n",
-    "Hya Omega,2.382258,0.088876,4.97\n",
-    "Leo Xi,2.495581,0.197217,4.97\n",
-    "Per 40,0.970294,0.592801,4.97\n",
-    "Ret Iota,1.052884,-1.066028,4.97\n",
-    "Tau 75,1.171290,0.285531,4.97\n",
-    "Vir 89,3.620998,-0.316501,4.97\n",
-    "And Chi,0.433496,0.774684,4.98\n",
-    "Aqr Psi3,6.104122,-0.167741,4.98\n",
-    "Ari 14,0.564709,0.452734,4.98\n",
-    "CMa 29,1.914066,-0.428633,4.98\n",
-    "Cas 4,6.129764,1.087040,4.98\n",
-    "Cas Phi,0.349422,1.016334,4.98\n",
-    "Dra 39,4.816709,1.026263,4.98\n",
-    "Hya 6,2.269037,-0.217735,4.98\n",
-    "Lyn 1,1.648958,1.073644,4.98\n",
-    "Peg 72,6.169535,0.546729,4.98\n",
-    "Ser Theta2,4.957797,0.073338,4.98\n",
-    "Sgr 11,4.763542,-0.413662,4.98\n",
-    "Vir 70,3.527441,0.240487,4.98\n",
-    "Aur Sigma,1.416567,0.652501,4.99\n",
-    "Aur Xi,1.548311,0.972270,4.99\n",
-    "CMi Epsilon,1.944508,0.161899,4.99\n",
-    "Cas Omega,0.506145,1.198784,4.99\n",
-    "CrA Gamma,5.002194,-0.646877,4.99\n",
-    "CrB Iota,4.195088,0.521000,4.99\n",
-    "Cyg 17,5.176763,0.588661,4.99\n",
-    "Dra 54,5.034926,1.007142,4.99\n",
-    "Hor Beta,0.780148,-1.118257,4.99\n",
-    "Leo 59,2.883051,0.106489,4.99\n",
-    "Lyn 24,2.020248,1.024688,4.99\n",
-    "Mon 19,1.845308,-0.073987,4.99\n",
-    "Nor Gamma1,4.263032,-0.873857,4.99\n",
-    "PsA Upsilon,5.796384,-0.594178,4.99\n",
-    "Pup 20,2.152573,-0.275558,4.99\n",
-    "Sgr Nu2,4.952888,-0.395690,4.99\n",
-    "Tau 111,1.415564,0.303396,4.99\n",
-    "UMa 56,2.979393,0.758918,4.99\n",
-    "Aqr Omega1,6.194981,-0.248215,5\n",
-    "Aur 9,1.338129,0.900551,5\n",
-    "CMa Mu,1.815622,-0.245107,5\n",
-    "Com 16,3.259351,0.468194,5\n",
-    "Cyg 68,5.578305,0.766999,5\n",
-    "Dra 15,4.310891,1.200229,5\n",
-    "For Delta,0.969741,-0.557429,5\n",
-    "Gem 51,1.890941,0.282026,5\n",
-    "Her Kappa,4.224024,0.297525,5\n",
-    "Leo 10,2.518561,0.119308,5\n",
-    "Lup Nu1,4.023588,-0.836498,5\n",
-    "Ori 23,1.408626,0.061862,5\n",
-    "Sge Zeta,5.187897,0.334095,5\n",
-    "Tau 104,1.341504,0.325417,5\n",
-    "Tuc Eta,6.272655,-1.122218,5\n",
-    "Vul 9,5.125079,0.345110,5\n",
-    "Aql 26,5.063847,-0.094524,5.01\n",
-    "Boo 9,3.650225,0.479825,5.01\n",
-    "Cyg 74,5.659012,0.705351,5.01\n",
-    "Dor Eta2,1.619884,-1.144752,5.01\n",
-    "Gem 65,1.962674,0.487228,5.01\n",
-    "Hyi Kappa,0.623395,-1.285362,5.01\n",
-    "Lyr 16,4.980472,0.819165,5.01\n",
-    "Peg 31,5.853478,0.213022,5.01\n",
-    "PsA Theta,5.706078,-0.539278,5.01\n",
-    "Scl Zeta,0.010174,-0.518717,5.01\n",
-    "Vir 82,3.584964,-0.151897,5.01\n",
-    "Vul 32,5.474051,0.489696,5.01\n",
-    "Aql 4,4.908004,0.035954,5.02\n",
-    "Aur 14,1.376221,0.570509,5.02\n",
-    "Aur Psi4,1.758783,0.777098,5.02\n",
-    "Aur Psi7,1.792300,0.729223,5.02\n",
-    "Boo Nu1,4.061948,0.712671,5.02\n",
-    "Boo Nu2,4.065672,0.713830,5.02\n",
-    "CVn 6,3.254377,0.681003,5.02\n",
-    "Col Theta,1.603638,-0.650188,5.02\n",
-    "Com 24,3.294876,0.320738,5.02\n",
-    "Dra 30,4.664705,0.886298,5.02\n",
-    "Oph Rho,4.300433,-0.409231,5.02\n",
-    "Pav Omicron,5.556001,-1.223936,5.02\n",
-    "Sgr 61,5.227043,-0.270376,5.02\n",
-    "UMi 11,4.001596,1.253563,5.02\n",
-    "And 22,0.045037,0.804112,5.03\n",
-    "And 41,0.296771,0.766932,5.03\n",
-    "Aql 36,5.107982,-0.048675,5.03\n",
-    "Aqr Kappa,5.924331,-0.073793,5.03\n",
-    "Ari Kappa,0.552244,0.395288,5.03\n",
-    "Aur 19,1.396329,0.592680,5.03\n",
-    "Cep 16,5.756314,1.277232,5.03\n",
-    "Cyg 20,5.195096,0.924816,5.03\n",
-    "Dra 36,4.773025,1.123944,5.03\n",
-    "Eri 60,1.266207,-0.283044,5.03\n",
-    "Gem 57,1.935025,0.437215,5.03\n",
-    "Lib Lambda,4.159709,-0.351984,5.03\n",
-    "Mon 2,1.566746,-0.166824,5.03\n",
-    "Per 31,0.868854,0.874323,5.03\n",
-    "Pic Eta2,1.330668,-0.865295,5.03\n",
-    "Sgr Chi1,5.084471,-0.427756,5.03\n",
-    "Tau 79,1.173021,0.227722,5.03\n",
-    "Tri 10,0.606284,0.499906,5.03\n",
-    "UMa 46,2.861206,0.584807,5.03\n",
-    "Cep Lambda,5.809816,1.036978,5.04\n",
-    "Cha Kappa,3.162428,-1.335511,5.04\n",
-    "Cyg 56,5.454510,0.768982,5.04\n",
-    "Dra 35,4.666356,1.343254,5.04\n",
-    "Dra 46,4.898405,0.969346,5.04\n",
-    "Her 30,4.313763,0.730973,5.04\n",
-    "Her 51,4.414614,0.430335,5.04\n",
-    "Her 99,4.743041,0.533407,5.04\n",
-    "Ori 74,1.642544,0.214191,5.04\n",
-    "Peg 14,5.715277,0.526639,5.04\n",
-    "Per 4,0.533642,0.950986,5.04\n",
-    "Psc 19,6.223808,0.060854,5.04\n",
-    "Pup 4,2.033083,-0.254188,5.04\n",
-    "Vir 53,3.456006,-0.282719,5.04\n",
-    "Vul 28,5.404114,0.420906,5.04\n",
-    "Cae Beta,1.230712,-0.648293,5.05\n",
-    "Cam 3,1.221345,0.926416,5.05\n",
-    "Cyg 26,5.241922,0.874492,5.05\n",
-    "Del Kappa,5.406725,0.176036,5.05\n",
-    "Dra 27,4.590063,1.189180,5.05\n",
-    "Gem 64,1.960616,0.490753,5.05\n",
-    "Gem 74,2.004845,0.308482,5.05\n",
-    "Ind Iota,5.460706,-0.900735,5.05\n",
-    "Mus Iota1,3.512991,-1.307038,5.05\n",
-    "Psc 7,6.110150,0.093923,5.05\n",
-    "Sex Gamma,2.585298,-0.141459,5.05\n",
-    "Tel Eta,5.073898,-0.949871,5.05\n",
-    "UMa 47,2.877466,0.705641,5.05\n",
-    "Aps Epsilon,3.762835,-1.398164,5.06\n",
-    "Aqr Chi,6.094901,-0.134856,5.06\n",
-    "Cet 94,0.841132,-0.020876,5.06\n",
-    "Dor Nu,1.608917,-1.201543,5.06\n",
-    "Her 98,4.738707,0.387793,5.06\n",
-    "Hya Kappa,2.532066,-0.250144,5.06\n",
-    "Lyr Epsilon1,4.905859,0.692372,5.06\n",
-    "Mon 10,1.692795,-0.083116,5.06\n",
-    "Peg 77,6.210638,0.180317,5.06\n",
-    "Psc 47,0.122384,0.312293,5.06\n",
-    "Ser 5,4.011261,0.030810,5.06\n",
-    "Sgr 55,5.159710,-0.281415,5.06\n",
-    "Aur Phi,1.429636,0.601717,5.07\n",
-    "Cae Delta,1.181741,-0.784593,5.07\n",
-    "CrB Zeta2,4.098811,0.639416,5.07\n",
-    "Hyi Lambda,0.212014,-1.307659,5.07\n",
-    "Leo 6,2.495646,0.169573,5.07\n",
-    "Oph 36,4.517552,-0.464282,5.07\n",
-    "Psc 64,0.213708,0.295668,5.07\n",
-    "Sco Xi,4.207851,-0.198497,5.07\n",
-    "Tau 30,0.996023,0.194488,5.07\n",
-    "Tau Sigma1,1.218036,0.275757,5.07\n",
-    "Tel Delta2,4.852161,-0.798614,5.07\n",
-    "Vul 17,5.266051,0.412150,5.07\n",
-    "Aqr 94,6.104776,-0.234902,5.08\n",
-    "Cam 11,1.335795,1.029264,5.08\n",
-    "Cap Mu,5.730338,-0.236521,5.08\n",
-    "Cep 31,5.915655,1.285314,5.08\n",
-    "Dra 17,4.346866,0.923706,5.08\n",
-    "Hya 44,2.766412,-0.414433,5.08\n",
-    "Hya 50,3.720897,-0.475796,5.08\n",
-    "LMi 41,2.807435,0.404713,5.08\n",
-    "Lac 13,5.951973,0.729882,5.08\n",
-    "Leo 48,2.769838,0.121363,5.08\n",
-    "Ori 27,1.415818,-0.015558,5.08\n",
-    "Ori Theta2,1.463379,-0.094529,5.08\n",
-    "Peg 16,5.729320,0.452477,5.08\n",
-    "Peg 66,6.122077,0.214918,5.08\n",
-    "Peg Phi,6.250409,0.333712,5.08\n",
-    "Sgr Xi1,4.962589,-0.360522,5.08\n",
-    "UMa 49,2.883458,0.684382,5.08\n",
-    "Aql 18,5.004630,0.193232,5.09\n",
-    "Ari Tau2,0.884678,0.362015,5.09\n",
-    "Cap 46,5.694159,-0.158520,5.09\n",
-    "Cir Delta,4.000927,-1.063909,5.09\n",
-    "Crt Lambda,2.981742,-0.327773,5.09\n",
-    "Men Alpha,1.615477,-1.304687,5.09\n",
-    "Sex Beta,2.750166,-0.011117,5.09\n",
-    "Tau 28,1.000015,0.421264,5.09\n",
-    "TrA Kappa,4.169126,-1.197349,5.09\n",
-    "Tuc Beta3,0.142812,-1.100100,5.09\n",
-    "And 2,6.032752,0.746264,5.1\n",
-    "Aql 23,5.055092,0.018942,5.1\n",
-    "Aqr 25,5.670378,0.039158,5.1\n",
-    "Ari Iota,0.512043,0.310974,5.1\n",
-    "Cap Upsilon,5.410739,-0.316578,5.1\n",
-    "Com 6,3.211420,0.260035,5.1\n",
-    "Gem 56,1.928356,0.356808,5.1\n",
-    "Gru Mu2,5.831334,-0.726537,5.1\n",
-    "Her 101,4.751143,0.349856,5.1\n",
-    "Oct Epsilon,5.846962,-1.403938,5.1\n",
-    "Psc 29,0.007956,-0.052840,5.1\n",
-    "Sge Eta,5.258495,0.348911,5.1\n",
-    "Tau 97,1.271363,0.328815,5.1\n",
-    "UMa 44,2.851759,0.952688,5.1\n",
-    "Aql Omicron,5.196834,0.181786,5.11\n",
-    "Cep 19,5.782050,1.086991,5.11\n",
-    "Cha Zeta,2.504053,-1.412694,5.11\n",
-    "Cir Theta,3.912737,-1.095732,5.11\n",
-    "CrB Mu,4.080798,0.680853,5.11\n",
-    "Cyg 75,5.673127,0.755272,5.11\n",
-    "Cyg Beta2,5.108382,0.488086,5.11\n",
-    "Dor Epsilon,1.526698,-1.167645,5.11\n",
-    "Eri 47,1.196394,-0.143665,5.11\n",
-    "Hor Mu,0.801164,-1.042621,5.11\n",
-    "Mic Iota,5.447551,-0.767746,5.11\n",
-    "Mic Nu,5.383984,-0.776953,5.11\n",
-    "Oct Gamma1,6.248744,-1.431500,5.11\n",
-    "Oph 36,4.517567,-0.464306,5.11\n",
-    "Per 21,0.773566,0.557356,5.11\n",
-    "Per 42,1.001572,0.577554,5.11\n",
-    "Phe Phi,0.499019,-0.741712,5.11\n",
-    "PsA Pi,6.036643,-0.606492,5.11\n",
-    "Pup 12,2.090446,-0.406846,5.11\n",
-    "Ser 36,4.150655,-0.053940,5.11\n",
-    "Aql 37,5.127436,-0.184312,5.12\n",
-    "Boo Epsilon,3.861483,0.472548,5.12\n",
-    "Cam 43,1.805121,1.202328,5.12\n",
-    "Cet 48,0.390961,-0.377505,5.12\n",
-    "Cnc 8,2.116539,0.228953,5.12\n",
-    "Com 27,3.345120,0.289332,5.12\n",
-    "Cyg 19,5.194827,0.675835,5.12\n",
-    "Dra 53,5.025130,0.992380,5.12\n",
-    "Eri 66,1.338500,-0.081245,5.12\n",
-    "Eri 68,1.347074,-0.077774,5.12\n",
-    "Her 107,4.804091,0.503877,5.12\n",
-    "Her 5,4.194193,0.310989,5.12\n",
-    "Her 70,4.541798,0.427596,5.12\n",
-    "Her 87,4.663607,0.447202,5.12\n",
-    "Lup Xi1,4.175228,-0.592825,5.12\n",
-    "Lyr Mu,4.818112,0.689531,5.12\n",
-    "Pav Phi2,5.410710,-1.056777,5.12\n",
-    "Peg 57,6.062947,0.151446,5.12\n",
-    "Tau 66,1.151328,0.165123,5.12\n",
-    "UMa 38,2.801006,1.146967,5.12\n",
-    "Aqr 47,5.853805,-0.376962,5.13\n",
-    "Aur 65,1.928778,0.641593,5.13\n",
-    "Cen Omicron1,3.018409,-1.037462,5.13\n",
-    "Cet 37,0.324631,-0.138283,5.13\n",
-    "CrA Lambda,4.903423,-0.668873,5.13\n",
-    "Dra 59,5.014171,1.336234,5.13\n",
-    "Mon 25,1.995253,-0.071752,5.13\n",
-    "Ori Theta1,1.462913,-0.094068,5.13\n",
-    "Phe Pi,6.278517,-0.920588,5.13\n",
-    "UMa 16,2.418779,1.072039,5.13\n",
-    "CMi Zeta,2.058180,0.030839,5.14\n",
-    "Cam 42,1.793115,1.179353,5.14\n",
-    "Cnc Chi,2.181945,0.475040,5.14\n",
-    "Cnc Xi,2.397028,0.384768,5.14\n",
-    "Cyg 23,5.206710,1.003976,5.14\n",
-    "Del Gamma1,5.439515,0.281425,5.14\n",
-    "Dor Lambda,1.423847,-1.028217,5.14\n",
-    "For Phi,0.645895,-0.590115,5.14\n",
-    "Gem Pi,2.039875,0.583211,5.14\n",
-    "LMi 19,2.607893,0.716555,5.14\n",
-    "Lyr Epsilon2,4.906041,0.691378,5.14\n",
-    "Nor Theta,4.255353,-0.826801,5.14\n",
-    "Ori 64,1.585872,0.343665,5.14\n",
-    "Pav Omega,4.968109,-1.050698,5.14\n",
-    "Phe Chi,0.531046,-0.780400,5.14\n",
-    "Tau 4,0.918080,0.197857,5.14\n",
-    "UMa Sigma1,2.392817,1.167160,5.14\n",
-    "Vir Upsilon,3.750458,-0.039541,5.14\n",
-    "Aql 21,5.034017,0.040031,5.15\n",
-    "Ara Mu,4.643208,-0.904677,5.15\n",
-    "CVn 21,3.482986,0.867114,5.15\n",
-    "Cen Omicron2,3.018605,-1.038747,5.15\n",
-    "Cyg 4,5.088297,0.633865,5.15\n",
-    "Her 43,4.388769,0.149793,5.15\n",
-    "Hya 47,3.658726,-0.435847,5.15\n",
-    "Lib 36,4.078056,-0.489512,5.15\n",
-    "Lib Alpha1,3.886354,-0.279204,5.15\n",
-    "Lyn 35,2.321055,0.763174,5.15\n",
-    "Mus Zeta2,3.238117,-1.178480,5.15\n",
-    "Oct Alpha,5.518367,-1.344320,5.15\n",
-    "Pav Upsilon,5.419036,-1.165196,5.15\n",
-    "Per 29,0.866687,0.876543,5.15\n",
-    "Tri 14,0.663676,0.630888,5.15\n",
-    "Vir 90,3.642073,-0.026233,5.15\n",
-    "Vul 22,5.303634,0.410303,5.15\n",
-    "Aql 31,5.083141,0.208470,5.16\n",
-    "Aqr 1,5.407968,0.008489,5.16\n",
-    "Equ Beta,5.597678,0.118876,5.16\n",
-    "Her 90,4.683162,0.698272,5.16\n",
-    "Ind Mu,5.520636,-0.955170,5.16\n",
-    "Peg 59,6.072597,0.152193,5.16\n",
-    "Peg Sigma,5.988232,0.171663,5.16\n",
-    "Psc 82,0.310290,0.548465,5.16\n",
-    "Psc 89,0.339467,0.063084,5.16\n",
-    "Tel Rho,5.001815,-0.913520,5.16\n",
-    "UMa 37,2.771416,0.996282,5.16\n",
-    "Vul 4,5.085351,0.345551,5.16\n",
-    "Aql Sigma,5.145202,0.094209,5.17\n",
-    "Cas Mu,0.297899,0.958540,5.17\n",
-    "Cir Eta,3.947949,-1.117563,5.17\n",
-    "Col Mu,1.509703,-0.563853,5.17\n",
-    "Cru Mu2,3.379888,-0.997776,5.17\n",
-    "Cyg 35,5.317371,0.610565,5.17\n",
-    "Del 17,5.478639,0.239483,5.17\n",
-    "Eri Xi,1.150521,-0.065372,5.17\n",
-    "Per 9,0.621148,0.974689,5.17\n",
-    "Pup 9,2.058492,-0.242567,5.17\n",
-    "Ser 10,4.051942,0.032153,5.17\n",
-    "Ser Tau1,4.039521,0.269270,5.17\n",
-    "Tel Kappa,4.942162,-0.909447,5.17\n",
-    "UMa 27,2.543614,1.261044,5.17\n",
-    "And Rho,0.092161,0.662677,5.18\n",
-    "Aqr 108,6.245464,-0.330022,5.18\n",
-    "Ari 38,0.719774,0.217221,5.18\n",
-    "Cap 42,5.679076,-0.245175,5.18\n",
-    "Cas 42,0.449124,1.232595,5.18\n",
-    "Cep 6,5.582305,1.132229,5.18\n",
-    "Com 13,3.247658,0.455507,5.18\n",
-    "Crt Eta,3.124205,-0.299339,5.18\n",
-    "Gem Omega,1.843126,0.422636,5.18\n",
-    "Her 95,4.718927,0.376909,5.18\n",
-    "Leo 75,2.955235,0.035091,5.18\n",
-    "Phe Sigma,6.227626,-0.876621,5.18\n",
-    "Pup 6,2.049395,-0.300691,5.18\n",
-    "Scl Iota,0.093899,-0.505826,5.18\n",
-    "Tau 125,1.482381,0.451987,5.18\n",
-    "Vul 21,5.298129,0.500817,5.18\n",
-    "Vul 3,5.073883,0.458367,5.18\n",
-    "And 64,0.630129,0.872781,5.19\n",
-    "Aur 66,1.937934,0.709864,5.19\n",
-    "Cep 30,5.928229,1.109758,5.19\n",
-    "Cet Phi2,0.218719,-0.185781,5.19\n",
-    "Cyg 25,5.235639,0.646518,5.19\n",
-    "Men Gamma,1.448107,-1.332404,5.19\n",
-    "Ori 6,1.286228,0.199423,5.19\n",
-    "Vir 49,3.437848,-0.187453,5.19\n",
-    "Aqr 97,6.120230,-0.262483,5.2\n",
-    "Aqr Upsilon,5.910965,-0.361429,5.2\n",
-    "Aur Psi3,1.740181,0.696430,5.2\n",
-    "CMa 10,1.764848,-0.542283,5.2\n",
-    "Cam 31,1.548820,1.045249,5.2\n",
-    "Cet 13,0.153800,-0.062706,5.2\n",
-    "Cnc Omicron1,2.344188,0.267433,5.2\n",
-    "Cnc Sigma3,2.354202,0.565812,5.2\n",
-    "CrB Nu1,4.286340,0.589907,5.2\n",
-    "Dra 2,3.037077,1.209911,5.2\n",
-    "Dra 73,5.373462,1.308207,5.2\n",
-    "For Kappa,0.621963,-0.415674,5.2\n",
-    "Lib Nu,3.955905,-0.283737,5.2\n",
-    "Lyn 18,1.902038,1.040871,5.2\n",
-    "Oph Omicron,4.529180,-0.423887,5.2\n",
-    "Ori 71,1.635584,0.334342,5.2\n",
-    "Tau 41,1.076025,0.481711,5.2\n",
-    "Vol Theta,2.264943,-1.228484,5.2\n",
-    "Crv Zeta,3.231310,-0.387739,5.21\n",
-    "Cyg 61,5.527938,0.676242,5.21\n",
-    "Gem 26,1.755823,0.307968,5.21\n",
-    "Hor Zeta,0.701011,-0.952077,5.21\n",
-    "Lyn 5,1.687799,1.019573,5.21\n",
-    "Phe Upsilon,0.295826,-0.724084,5.21\n",
-    "Ser 59,4.831108,0.003423,5.21\n",
-    "Sex Delta,2.746617,-0.047807,5.21\n",
-    "UMa 67,3.150814,0.751287,5.21\n",
-    "Vir 76,3.547244,-0.177413,5.21\n",
-    "And 14,6.157914,0.684804,5.22\n",
-    "Aql 19,5.013451,0.106000,5.22\n",
-    "Ari Pi,0.738674,0.304807,5.22\n",
-    "Aur Psi6,1.778752,0.851536,5.22\n",
-    "Cap Tau,5.407350,-0.261009,5.22\n",
-    "Cas 49,0.547684,1.328457,5.22\n",
-    "Cnc Rho2,2.337265,0.487427,5.22\n",
-    "Com Alpha,3.446974,0.305947,5.22\n",
-    "Gem 63,1.953634,0.374286,5.22\n",
-    "Ori 60,1.565677,0.009653,5.22\n",
-    "Phe Rho,0.221162,-0.889890,5.22\n",
-    "Sco Chi,4.249215,-0.206603,5.22\n",
-    "Vir 32,3.340640,0.133925,5.22\n",
-    "Vir 57,3.473118,-0.348072,5.22\n",
-    "Vir 59,3.476587,0.164483,5.22\n",
-    "Vul 16,5.244816,0.435251,5.22\n",
-    "And 28,0.131431,0.519265,5.23\n",
-    "Ant Eta,2.613071,-0.626418,5.23\n",
-    "Aql 11,4.970240,0.237757,5.23\n",
-    "Ara Kappa,4.564036,-0.883723,5.23\n",
-    "Aur Rho,1.404146,0.729625,5.23\n",
-    "Dra 26,4.603270,1.079922,5.23\n",
-    "Equ Epsilon,5.493744,0.074938,5.23\n",
-    "Eri 20,0.943743,-0.304856,5.23\n",
-    "Eri 51,1.211266,-0.043168,5.23\n",
-    "Lyr 17,5.006593,0.567261,5.23\n",
-    "Psc 91,0.353967,0.501574,5.23\n",
-    "Psc Alpha,0.532529,0.048234,5.23\n",
-    "Ser Omega,4.146430,0.038334,5.23\n",
-    "Tau Psi,1.077777,0.506170,5.23\n",
-    "Aqr 106,6.214252,-0.318993,5.24\n",
-    "Boo Phi,4.092041,0.704299,5.24\n",
-    "Cap 41,5.681105,-0.406012,5.24\n",
-    "Cap Phi,5.565993,-0.360440,5.24\n",
-    "Cnc Kappa,2.389996,0.186193,5.24\n",
-    "CrA Mu,4.920709,-0.705220,5.24\n",
-    "Cyg 71,5.626287,0.812286,5.24\n",
-    "Dra 8,3.383648,1.142119,5.24\n",
-    "Eri Tau7,0.993354,-0.416693,5.24\n",
-    "Her 45,4.397241,0.091572,5.24\n",
-    "Hya 23,2.429040,-0.110882,5.24\n",
-    "Hya 56,3.873526,-0.455313,5.24\n",
-    "LMi 42,2.818118,0.535506,5.24\n",
-    "Oph Tau,4.725835,-0.142778,5.24\n",
-    "Psc 107,0.447226,0.353754,5.24\n",
-    "Psc Zeta,0.321715,0.132214,5.24\n",
-    "Ret Eta,1.142703,-1.106301,5.24\n",
-    "Ret Zeta2,0.864876,-1.090942,5.24\n",
-    "Sex Epsilon,2.694919,-0.140829,5.24\n",
-    "Sgr 29,4.929108,-0.354733,5.24\n",
-    "Ara Iota,4.552117,-0.828479,5.25\n",
-    "Ara Pi,4.616803,-0.951209,5.25\n",
-    "Aur Psi5,1.774731,0.760571,5.25\n",
-    "Boo 13,3.701356,0.863206,5.25\n",
-    "CMi Delta1,1.972651,0.033413,5.25\n",
-    "CMi Eta,1.954921,0.121160,5.25\n",
-    "CVn 14,3.428445,0.624808,5.25\n",
-    "Cap Pi,5.355194,-0.317854,5.25\n",
-    "Eri 24,0.979602,-0.020299,5.25\n",
-    "Gem 68,1.979240,0.276227,5.25\n",
-    "Her 59,4.457600,0.585878,5.25\n",
-    "Lac 12,5.940563,0.702068,5.25\n",
-    "Lep 8,1.411550,-0.243076,5.25\n",
-    "Lyn 42,2.523579,0.702316,5.25\n",
-    "Lyr Nu2,4.930039,0.568119,5.25\n",
-    "Oph 23,4.427006,-0.107406,5.25\n",
-    "Scl Pi,0.445684,-0.564212,5.25\n",
-    "Scl Theta,0.051196,-0.613187,5.25\n",
-    "Vir 68,3.519980,-0.221793,5.25\n",
-    "Aqr 68,5.967070,-0.342317,5.26\n",
-    "Boo Chi,3.990201,0.509011,5.26\n",
-    "Eri Rho3,0.804044,-0.132660,5.26\n",
-    "Hor Nu,0.737511,-1.096183,5.26\n",
-    "Leo 92,3.057751,0.372676,5.26\n",
-    "Leo Nu,2.610242,0.217201,5.26\n",
-    "Ori 45,1.464586,-0.084750,5.26\n",
-    "Ser 16,4.086223,0.174707,5.26\n",
-    "Tau 58,1.137104,0.263462,5.26\n",
-    "And 49,0.393150,0.820431,5.27\n",
-    "Aps Delta2,4.278006,-1.373002,5.27\n",
-    "Aql Chi,5.159920,0.206414,5.27\n",
-    "Ari Eta,0.579457,0.370199,5.27\n",
-    "Aur 49,1.724393,0.489080,5.27\n",
-    "Cep 20,5.781440,1.095815,5.27\n",
-    "Dor Kappa,1.240718,-1.042534,5.27\n",
-    "Dra 64,5.242424,1.131342,5.27\n",
-    "Gem 36,1.795726,0.379803,5.27\n",
-    "Her 105,4.796070,0.426665,5.27\n",
-    "Mon 7,1.656812,-0.136538,5.27\n",
-    "Ori 52,1.518451,0.112646,5.27\n",
-    "Pyx Eta,2.259634,-0.458236,5.27\n",
-    "TrA Iota,4.310767,-1.118024,5.27\n",
-    "UMa 17,2.425273,0.990324,5.27\n",
-    "UMa 31,2.599304,0.869523,5.27\n",
-    "Aql Omega1,5.051928,0.202376,5.28\n",
-    "Aql Phi,5.219574,0.199384,5.28\n",
-    "Ari Tau1,0.878017,0.369084,5.28\n",
-    "Cam 16,1.411375,1.004340,5.28\n",
-    "Cap 29,5.566502,-0.264791,5.28\n",
-    "Cap Sigma,5.320607,-0.333683,5.28\n",
-    "Cas 40,0.429853,1.274788,5.28\n",
-    "Cet 69,0.619345,0.006909,5.28\n",
-    "Eri 35,1.053888,-0.027048,5.28\n",
-    "For Mu,0.579922,-0.536233,5.28\n",
-    "Her 96,4.722796,0.363615,5.28\n",
-    "Hyi Mu,0.661807,-1.380720,5.28\n",
-    "Lyr Iota,5.006048,0.630069,5.28\n",
-    "Oct Chi,4.951419,-1.529010,5.28\n",
-    "Oct Gamma3,0.043786,-1.435078,5.28\n",
-    "Per 43,1.032399,0.884800,5.28\n",
-    "Tau Kappa2,1.158099,0.387458,5.28\n",
-    "Tri 7,0.593136,0.582222,5.28\n",
-    "Aqr 107,6.222164,-0.325994,5.29\n",
-    "Ara Epsilon2,4.464320,-0.929160,5.29\n",
-    "Boo 15,3.729972,0.176288,5.29\n",
-    "CMa 11,1.775225,-0.251778,5.29\n",
-    "CMi 14,2.087167,0.038829,5.29\n",
-    "CVn 3,3.228037,0.854935,5.29\n",
-    "Cas 31,0.308291,1.200413,5.29\n",
-    "Cep 18,5.776523,1.101647,5.29\n",
-    "Com 17,3.267744,0.452263,5.29\n",
-    "Gru Xi,5.637843,-0.718712,5.29\n",
-    "Ind Nu,5.866982,-1.261097,5.29\n",
-    "Oct Lambda,5.719902,-1.443722,5.29\n",
-    "Peg 12,5.698820,0.400534,5.29\n",
-    "Peg 13,5.716586,0.301690,5.29\n",
-    "Per 59,1.234406,0.756862,5.29\n",
-    "Tau 133,1.517193,0.242596,5.29\n",
-    "Tau 46,1.106328,0.134672,5.29\n",
-    "Tri 12,0.646499,0.517829,5.29\n",
-    "Vol Eta,2.190708,-1.281072,5.29\n",
-    "And 18,6.192159,0.880897,5.3\n",
-    "And 62,0.607724,0.826937,5.3\n",
-    "Aqr 32,5.780487,-0.015824,5.3\n",
-    "Ari 33,0.701121,0.472301,5.3\n",
-    "CMi 1,1.941548,0.203675,5.3\n",
-    "CMi 11,2.034487,0.187943,5.3\n",
-    "Cam 4,1.256659,0.990600,5.3\n",
-    "Cap Chi,5.535137,-0.369898,5.3\n",
-    "Cnc Mu2,2.128269,0.376671,5.3\n",
-    "Dra 3,3.065118,1.164920,5.3\n",
-    "Lep Nu,1.396198,-0.214947,5.3\n",
-    "Lib 12,3.902273,-0.430088,5.3\n",
-    "Mic Zeta,5.510732,-0.674250,5.3\n",
-    "Ori 72,1.638071,0.281749,5.3\n",
-    "Peg 7,5.682174,0.099135,5.3\n",
-    "Peg 82,6.250977,0.191070,5.3\n",
-    "Sgr Theta2,5.235355,-0.605590,5.3\n",
-    "Tau 106,1.343060,0.356367,5.3\n",
-    "Cet Phi3,0.244455,-0.196640,5.31\n",
-    "Col Nu2,1.473683,-0.500725,5.31\n",
-    "Cyg 70,5.617153,0.647808,5.31\n",
-    "Gem 76,2.025084,0.450019,5.31\n",
-    "Hor Eta,0.686816,-0.917049,5.31\n",
-    "Hya 14,2.309776,-0.060093,5.31\n",
-    "Lep 19,1.604365,-0.334507,5.31\n",
-    "Lib Mu,3.880383,-0.246945,5.31\n",
-    "Men Beta,1.320851,-1.244672,5.31\n",
-    "Pav Mu2,5.244162,-1.168396,5.31\n",
-    "Per 36,0.926937,0.803845,5.31\n",
-    "Pic Lambda,1.233831,-0.881066,5.31\n",
-    "Scl Epsilon,0.460971,-0.437249,5.31\n",
-    "Scl Mu,6.198697,-0.559780,5.31\n",
-    "UMa 57,3.006635,0.686559,5.31\n",
-    "Vul 33,5.490253,0.389659,5.31\n",
-    "Aqr 41,5.821982,-0.367814,5.32\n",
-    "Cam 36,1.626872,1.147001,5.32\n",
-    "Dra 9,3.403036,1.162341,5.32\n",
-    "Eri Rho2,0.797201,-0.134133,5.32\n",
-    "Her 53,4.419908,0.553298,5.32\n",
-    "Leo 22,2.582578,0.425778,5.32\n",
-    "Leo 73,2.949017,0.232260,5.32\n",
-    "Lyn 36,2.416423,0.754293,5.32\n",
-    "Peg 64,6.117008,0.555233,5.32\n",
-    "Peg 71,6.167419,0.392680,5.32\n",
-    "Vir 4,3.088862,0.143917,5.32\n",
-    "Vul 24,5.309226,0.430592,5.32\n",
-    "And 32,0.179420,0.688683,5.33\n",
-    "And 4,6.054787,0.809610,5.33\n",
-    "Cnc Eta,2.237112,0.356765,5.33\n",
-    "Lyn 14,1.802423,1.037574,5.33\n",
-    "Oph 37,4.504971,0.184748,5.33\n",
-    "Ori 5,1.280112,0.043774,5.33\n",
-    "Ori 73,1.639519,0.219058,5.33\n",
-    "Per 20,0.757953,0.669116,5.33\n",
-    "Ser 3,3.993270,0.086210,5.33\n",
-    "Ser Chi,4.109334,0.224231,5.33\n",
-    "Tau 40,1.063531,0.094868,5.33\n",
-    "UMa 61,3.058908,0.596932,5.33\n",
-    "Vir 55,3.465271,-0.347859,5.33\n",
-    "Aql 20,5.029508,-0.138569,5.34\n",
-    "Aqr 103,6.202791,-0.314634,5.34\n",
-    "Aqr 42,5.832898,-0.223950,5.34\n",
-    "Cnc Pi2,2.422648,0.260776,5.34\n",
-    "Leo 53,2.832917,0.184050,5.34\n",
-    "Ori 14,1.343387,0.148324,5.34\n",
-    "Ori 21,1.392715,0.045306,5.34\n",
-    "Psc Psi1,0.286590,0.374780,5.34\n",
-    "Sgr 7,4.724832,-0.423805,5.34\n",
-    "Cam 2,1.221592,0.933281,5.35\n",
-    "Cam 40,1.639199,1.047183,5.35\n",
-    "Cet 75,0.663909,-0.018064,5.35\n",
-    "Cnc Theta,2.232254,0.315808,5.35\n",
-    "Dra 50,4.914716,1.316570,5.35\n",
-    "For Pi,0.529031,-0.523628,5.35\n",
-    "Gem 85,2.075480,0.347039,5.35\n",
-    "Her 54,4.430387,0.321722,5.35\n",
-    "Hor Lambda,0.632238,-1.052642,5.35\n",
-    "LMi 23,2.688854,0.511566,5.35\n",
-    "Leo Psi,2.547010,0.244724,5.35\n",
-    "Lyn 13,1.775109,0.997790,5.35\n",
-    "Oct Xi,5.979418,-1.398431,5.35\n",
-    "Oph 43,4.552517,-0.491189,5.35\n",
-    "Ori 55,1.533126,-0.131215,5.35\n",
-    "Ser 6,4.018766,0.012484,5.35\n",
-    "Tau 29,0.984686,0.105592,5.35\n",
-    "Tau 53,1.131999,0.369001,5.35\n",
-    "Tel Nu,5.183715,-0.983711,5.35\n",
-    "Tri 15,0.679718,0.605411,5.35\n",
-    "UMa 74,3.272296,1.019374,5.35\n",
-    "Aur 40,1.599529,0.671651,5.36\n",
-    "Aur 45,1.665779,0.932917,5.36\n",
-    "Cam 37,1.614364,1.028624,5.36\n",
-    "Cha Iota,2.461576,-1.409998,5.36\n",
-    "Cyg 27,5.263753,0.627839,5.36\n",
-    "LMi 20,2.622408,0.557172,5.36\n",
-    "Lyn 22,1.963205,0.866949,5.36\n",
-    "Ori 38,1.458564,0.065746,5.36\n",
-    "Psc 55,0.174213,0.374170,5.36\n",
-    "Sge 10,5.218629,0.290331,5.36\n",
-    "Vir 84,3.591284,0.061751,5.36\n",
-    "Vir Omega,3.047607,0.141968,5.36\n",
-    "Aqr Rho,5.847718,-0.136504,5.37\n",
-    "Boo 50,4.022155,0.574805,5.37\n",
-    "Cyg 60,5.502943,0.805571,5.37\n",
-    "Gru Kappa,6.041719,-0.941867,5.37\n",
-    "Her 2,4.165366,0.752911,5.37\n",
-    "Her 82,4.610404,0.847978,5.37\n",
-    "LMi 8,2.493814,0.612664,5.37\n",
-    "Lup Upsilon,4.034976,-0.693075,5.37\n",
-    "Lyn 34,2.273371,0.799952,5.37\n",
-    "Lyr Epsilon2,4.906041,0.691373,5.37\n",
-    "Peg 30,5.848860,0.101045,5.37\n",
-    "Psc 41,0.089877,0.142947,5.37\n",
-    "Sge 13,5.236228,0.305724,5.37\n",
-    "Sgr 28,4.914600,-0.390818,5.37\n",
-    "Tau Chi,1.145729,0.447313,5.37\n",
-    "Tuc Iota,0.293703,-1.078182,5.37\n",
-    "Vir 63,3.503828,-0.309539,5.37\n",
-    "Vir 7,3.141367,0.063797,5.37\n",
-    "Vol Kappa1,2.180862,-1.248172,5.37\n",
-    "Cas 47,0.545954,1.348815,5.38\n",
-    "Cet 95,0.865567,-0.016236,5.38\n",
-    "Cyg 9,5.126243,0.514227,5.38\n",
-    "Del Eta,5.384123,0.227368,5.38\n",
-    "Dor Pi2,1.681959,-1.216325,5.38\n",
-    "Dra 51,4.995656,0.931948,5.38\n",
-    "Eri 63,1.308299,-0.179129,5.38\n",
-    "Lib 41,4.096760,-0.336882,5.38\n",
-    "Pic Eta1,1.321258,-0.857854,5.38\n",
-    "Psc 52,0.142208,0.354205,5.38\n",
-    "Psc 57,0.203113,0.270099,5.38\n",
-    "Psc Rho,0.376358,0.334618,5.38\n",
-    "Sgr 15,4.778777,-0.361778,5.38\n",
-    "Tau 121,1.463684,0.419567,5.38\n",
-    "Tau 56,1.132770,0.380021,5.38\n",
-    "Aql 51,5.195758,-0.187860,5.39\n",
-    "Boo 22,3.780630,0.335573,5.39\n",
-    "Boo 33,3.834648,0.775004,5.39\n",
-    "Cnc 57,2.331084,0.533712,5.39\n",
-    "CrB Nu2,4.286907,0.588239,5.39\n",
-    "Cyg 51,5.420164,0.878599,5.39\n",
-    "Dra 66,5.260190,1.082027,5.39\n",
-    "For Gamma2,0.741343,-0.487674,5.39\n",
-    "Her 72,4.540736,0.566670,5.39\n",
-    "Her Alpha2,4.514527,0.251153,5.39\n",
-    "Leo 79,2.984680,0.024570,5.39\n",
-    "Ori 75,1.645453,0.173529,5.39\n",
-    "Peg 58,6.065128,0.171425,5.39\n",
-    "Ser 60,4.841907,-0.034650,5.39\n",
-    "Tuc Rho,0.185325,-1.142633,5.39\n",
-    "And 55,0.494314,0.710868,5.4\n",
-    "Aur 26,1.477574,0.532195,5.4\n",
-    "Cas 12,0.108174,1.079156,5.4\n",
-    "Cyg 14,5.146285,0.747321,5.4\n",
-    "Mon Beta,1.696569,-0.122774,5.4\n",
-    "Psc 5,6.059267,0.037137,5.4\n",
-    "Ser 25,4.128111,-0.031493,5.4\n",
-    "Tau 83,1.180810,0.239537,5.4\n",
-    "Vol Iota,1.795289,-1.238544,5.4\n",
-    "Aps Iota,4.547012,-1.223883,5.41\n",
-    "Boo 18,3.749280,0.226966,5.41\n",
-    "Cap 33,5.603205,-0.363935,5.41\n",
-    "Cas 23,0.208429,1.306335,5.41\n",
-    "Cet 39,0.334252,-0.043638,5.41\n",
-    "Cet 57,0.522588,-0.363455,5.41\n",
-    "Cnc 60,2.338421,0.202914,5.41\n",
-    "CrB Rho,4.193350,0.581258,5.41\n",
-    "Hor Iota,0.709295,-0.886632,5.41\n",
-    "LMi 11,2.511791,0.625007,5.41\n",
-    "Leo 37,2.690767,0.239605,5.41\n",
-    "Leo Omega,2.480367,0.158069,5.41\n",
-    "Lib Eta,4.119297,-0.273542,5.41\n",
-    "Pav Sigma,5.451107,-1.200374,5.41\n",
-    "Scl Kappa2,0.050498,-0.485197,5.41\n",
-    "Tau 44,1.094460,0.462178,5.41\n",
-    "Vul 35,5.618513,0.481861,5.41\n",
-    "Aql 14,4.986878,-0.064558,5.42\n",
-    "Aql 15,4.995830,-0.070361,5.42\n",
-    "Cam 17,1.440638,1.100731,5.42\n",
-    "Cet 50,0.418806,-0.268786,5.42\n",
-    "Cet 70,0.620494,-0.015446,5.42\n",
-    "Leo 69,2.939833,-0.001217,5.42\n",
-    "Oct Zeta,2.341730,-1.495102,5.42\n",
-    "PsA Eta,5.763237,-0.496609,5.42\n",
-    "Psc 68,0.252360,0.506010,5.42\n",
-    "Scl Kappa1,0.040797,-0.488479,5.42\n",
-    "Tau 115,1.427541,0.313500,5.42\n",
-    "Vir 106,3.790397,-0.120437,5.42\n",
-    "Aqr 83,6.043915,-0.134279,5.43\n",
-    "Ari Nu,0.692968,0.383299,5.43\n",
-    "Cap 30,5.576131,-0.313902,5.43\n",
-    "Cas 6,6.234476,1.085847,5.43\n",
-    "Cet 25,0.275078,-0.084416,5.43\n",
-    "Cet 60,0.537540,0.002240,5.43\n",
-    "Cnc Tau,2.391108,0.517563,5.43\n",
-    "Del Iota,5.401001,0.198580,5.43\n",
-    "Dra 7,3.349170,1.165710,5.43\n",
-    "Ori 16,1.349692,0.171556,5.43\n",
-    "Per 14,0.715963,0.773128,5.43\n",
-    "PsA Lambda,5.822040,-0.484625,5.43\n",
-    "Psc 2,6.019015,0.016804,5.43\n",
-    "Sco 16,4.241681,-0.149182,5.43\n",
-    "Sgr Chi3,5.085431,-0.418220,5.43\n",
-    "Vir 87,3.610315,-0.311716,5.43\n",
-    "Vul 2,5.051536,0.401872,5.43\n",
-    "And 11,6.106456,0.848671,5.44\n",
-    "Cep 7,5.618949,1.166040,5.44\n",
-    "Cyg Omega2,5.372618,0.859056,5.44\n",
-    "Eri 37,1.092467,-0.120845,5.44\n",
-    "Gem 28,1.766091,0.505636,5.44\n",
-    "Gem 45,1.869102,0.278045,5.44\n",
-    "Sgr 14,4.774632,-0.378964,5.44\n",
-    "Cha Nu,2.558405,-1.339996,5.45\n",
-    "Cnc Nu,2.368143,0.426781,5.45\n",
-    "Cnc Sigma2,2.342857,0.574393,5.45\n",
-    "CrB Lambda,4.170435,0.662299,5.45\n",
-    "Dra Psi2,4.691387,1.256724,5.45\n",
-    "Eri 4,0.774032,-0.416469,5.45\n",
-    "Lyn 19,1.932378,0.964842,5.45\n",
-    "Lyn 26,2.071320,0.830161,5.45\n",
-    "Men Theta,1.817644,-1.386145,5.45\n",
-    "Mon 21,1.882309,-0.005270,5.45\n",
-    "Nor Lambda,4.272981,-0.744800,5.45\n",
-    "Peg 5,5.662532,0.337173,5.45\n",
-    "Pic Zeta,1.393507,-0.883243,5.45\n",
-    "Tuc Lambda2,0.240005,-1.213474,5.45\n",
-    "Aql 42,5.139071,-0.081114,5.46\n",
-    "Aqr 38,5.805947,-0.201847,5.46\n",
-    "Cep 26,5.877782,1.136772,5.46\n",
-    "Com 21,3.276899,0.428779,5.46\n",
-    "Com 26,3.312293,0.367610,5.46\n",
-    "Crv 3,3.189873,-0.411941,5.46\n",
-    "Dra 75,5.359223,1.421096,5.46\n",
-    "Her 89,4.692405,0.454658,5.46\n",
-    "Hya 20,2.398046,-0.153376,5.46\n",
-    "Leo 46,2.758478,0.246741,5.46\n",
-    "Lib Xi2,3.912890,-0.199137,5.46\n",
-    "Oct Iota,3.381474,-1.485682,5.46\n",
-    "Ori 33,1.445314,0.057460,5.46\n",
-    "Tau 16,0.980890,0.423931,5.46\n",
-    "Tau 93,1.221978,0.212891,5.46\n",
-    "UMa 82,3.575772,0.923652,5.46\n",
-    "Vir 95,3.694484,-0.162548,5.46\n",
-    "And 36,0.239837,0.412392,5.47\n",
-    "Aql 66,5.293722,-0.017618,5.47\n",
-    "Ari Xi,0.631882,0.185189,5.47\n",
-    "Aur Omicron,1.509273,0.869635,5.47\n",
-    "Cha Delta1,2.815485,-1.404462,5.47\n",
-    "Cha Eta,2.274709,-1.378170,5.47\n",
-    "For Eta3,0.744703,-0.622666,5.47\n",
-    "Gru Nu,5.884610,-0.682981,5.47\n",
-    "Her Rho,4.553906,0.648332,5.47\n",
-    "Hya 24,2.429011,-0.152624,5.47\n",
-    "Lib 49,4.190216,-0.288561,5.47\n",
-    "Men Eta,1.287995,-1.307896,5.47\n",
-    "Men Kappa,1.528378,-1.385118,5.47\n",
-    "Oct Phi,4.815371,-1.309768,5.47\n",
-    "Oct Sigma,5.536053,-1.552582,5.47\n",
-    "Per 30,0.863022,0.768381,5.47\n",
-    "Tau 118,1.436733,0.438960,5.47\n",
-    "Tau 36,1.066229,0.420726,5.47\n",
-    "UMa 2,2.245381,1.136995,5.47\n",
-    "Com 18,3.270085,0.420779,5.48\n",
-    "Crt Iota,3.048516,-0.230417,5.48\n",
-    "Del 18,5.490944,0.189179,5.48\n",
-    "Dra 49,4.977345,0.971421,5.48\n",
-    "Eri 30,1.015316,-0.093574,5.48\n",
-    "Her 112,4.940474,0.373942,5.48\n",
-    "Her 9,4.246633,0.087635,5.48\n",
-    "Leo 52,2.820547,0.247745,5.48\n",
-    "Peg 37,5.890341,0.077347,5.48\n",
-    "Pup 5,2.041795,-0.212809,5.48\n",
-    "Sco 27,4.438307,-0.580487,5.48\n",
-    "Tau 81,1.180926,0.273876,5.48\n",
-    "UMi 19,4.236023,1.324312,5.48\n",
-    "Vir 21,3.288986,-0.164968,5.48\n",
-    "Aps Kappa1,4.064494,-1.280887,5.49\n",
-    "Aql 27,5.064051,-0.015572,5.49\n",
-    "Aqr 18,5.603343,-0.224764,5.49\n",
-    "Aqr 21,5.608106,-0.062076,5.49\n",
-    "Ari Sigma,0.748281,0.263230,5.49\n",
-    "CrA Eta1,4.925501,-0.762360,5.49\n",
-    "Her 47,4.408367,0.126498,5.49\n",
-    "Leo 51,2.820488,0.329717,5.49\n",
-    "Oct Tau,6.143828,-1.526853,5.49\n",
-    "Pav Iota,4.757920,-1.082143,5.49\n",
-    "Peg 51,6.010325,0.362485,5.49\n",
-    "Psc 20,6.230571,-0.048200,5.49\n",
-    "Sgr 24,4.860269,-0.419446,5.49\n",
-    "Tau 130,1.515978,0.309432,5.49\n",
-    "Vul 10,5.164931,0.449805,5.49\n",
-    "Vul 19,5.287475,0.467903,5.49\n",
-    "Aps Theta,3.688448,-1.340355,5.5\n",
-    "Ari 64,0.891463,0.431518,5.5\n",
-    "Cep Rho2,5.889970,1.375741,5.5\n",
-    "Cnc 27,2.211034,0.220862,5.5\n",
-    "Col Pi2,1.605187,-0.735724,5.5\n",
-    "Col Sigma,1.554863,-0.547728,5.5\n",
-    "LMi 28,2.723339,0.588501,5.5\n",
-    "Lib Zeta4,4.070631,-0.294136,5.5\n",
-    "Psc 58,0.205185,0.208984,5.5\n",
-    "Psc 94,0.378278,0.335806,5.5\n",
-    "Psc Sigma,0.274097,0.555092,5.5\n",
-    "Scl Sigma,0.272446,-0.550685,5.5\n",
-    "Sco 18,4.256953,-0.146074,5.5\n",
-    "Tau 103,1.344383,0.423509,5.5\n",
-    "Tau 116,1.430123,0.277056,5.5\n",
-    "Tau Omega1,1.087195,0.342245,5.5\n",
-    "Tri Epsilon,0.536543,0.580913,5.5\n",
-    "Aqr 7,5.484261,-0.169253,5.51\n",
-    "Cet 67,0.597703,-0.112089,5.51\n",
-    "CrB Omicron,4.014875,0.516899,5.51\n",
-    "Cyg 49,5.415073,0.563867,5.51\n",
-    "Eri 58,1.254914,-0.295562,5.51\n",
-    "Eri 62,1.293304,-0.090258,5.51\n",
-    "LMi 40,2.805748,0.459468,5.51\n",
-    "Mus Theta,3.438808,-1.139812,5.51\n",
-    "Oct Psi,5.837435,-1.352834,5.51\n",
-    "Oph 21,4.413130,0.021225,5.51\n",
-    "Peg 86,0.024871,0.233806,5.51\n",
-    "Per 50,1.084766,0.663918,5.51\n",
-    "Phe Lambda2,0.155705,-0.837773,5.51\n",
-    "Psc 34,0.043800,0.194527,5.51\n",
-    "Ser 11,4.070828,-0.020706,5.51\n",
-    "Tuc Pi,0.090103,-1.215185,5.51\n",
-    "Vir 86,3.603836,-0.216886,5.51\n",
-    "Aql Tau,5.254045,0.127026,5.52\n",
-    "Ari 62,0.882257,0.481842,5.52\n",
-    "Cam 5,1.287406,0.964454,5.52\n",
-    "Cep 12,5.704703,1.059289,5.52\n",
-    "Cha Mu1,2.621172,-1.434918,5.52\n",
-    "Gru Omicron,6.137494,-0.920167,5.52\n",
-    "Her 83,4.635914,0.428726,5.52\n",
-    "Hyi Iota,0.855037,-1.350681,5.52\n",
-    "Leo 65,2.909915,0.034131,5.52\n",
-    "Leo 86,3.012802,0.321310,5.52\n",
-    "Per 1,0.488641,0.962505,5.52\n",
-    "Psc 80,0.298320,0.098606,5.52\n",
-    "Tau 135,1.529265,0.249679,5.52\n",
-    "TrA Theta,4.344764,-1.143108,5.52\n",
-    "Vul 18,5.282057,0.469566,5.52\n",
-    "Aql 28,5.059949,0.215980,5.53\n",
-    "Aqr 49,5.862190,-0.432187,5.53\n",
-    "Cet 80,0.680678,-0.136688,5.53\n",
-    "Dra 16,4.346706,0.923284,5.53\n",
-    "Eri 22,0.962716,-0.090941,5.53\n",
-    "Gru Phi,6.100646,-0.712521,5.53\n",
-    "Hyi Theta,0.795245,-1.254935,5.53\n",
-    "Ind Omicron,5.719379,-1.215263,5.53\n",
-    "Leo 95,3.122721,0.273086,5.53\n",
-    "Men Epsilon,1.944442,-1.380454,5.53\n",
-    "Mic Eta,5.525821,-0.722324,5.53\n",
-    "Peg 15,5.726854,0.502538,5.53\n",
-    "Peg 75,6.186959,0.321150,5.53\n",
-    "Peg 87,0.039444,0.317858,5.53\n",
-    "Sge 11,5.226199,0.293026,5.53\n",
-    "Tau 72,1.166280,0.401363,5.53\n",
-    "Aqr 30,5.773869,-0.113839,5.54\n",
-    "Boo 14,3.726656,0.226185,5.54\n",
-    "Cet 66,0.579413,-0.041776,5.54\n",
-    "For Rho,0.994547,-0.526527,5.54\n",
-    "Her 25,4.299633,0.652646,5.54\n",
-    "Hya 15,2.319433,-0.125266,5.54\n",
-    "Men Mu,1.235104,-1.237981,5.54\n",
-    "Peg 17,5.746235,0.210773,5.54\n",
-    "Pup 18,2.140923,-0.240841,5.54\n",
-    "Ret Zeta1,0.862934,-1.092145,5.54\n",
-    "Ser Phi,4.176762,0.251580,5.54\n",
-    "Tau 122,1.470716,0.297409,5.54\n",
-    "Tri 11,0.643423,0.555039,5.54\n",
-    "Vul 25,5.332228,0.426665,5.54\n",
-    "Aqr 5,5.463513,-0.096114,5.55\n",
-    "Aqr 96,6.106034,-0.089438,5.55\n",
-    "Aur 48,1.695449,0.532204,5.55\n",
-    "Cnc 3,2.097835,0.302092,5.55\n",
-    "Eri 25,0.981493,-0.005178,5.55\n",
-    "Hyi Pi1,0.585754,-1.184060,5.55\n",
-    "Lep 10,1.444813,-0.364139,5.55\n",
-    "Lib 50,4.192252,-0.146806,5.55\n",
-    "Psc 22,6.248126,0.051143,5.55\n",
-    "Psc Psi2,0.296502,0.361967,5.55\n",
-    "Psc Psi3,0.304647,0.343107,5.55\n",
-    "UMa 70,3.232553,1.009915,5.55\n",
-    "Vir 75,3.546778,-0.268136,5.55\n",
-    "Ant Delta,2.747105,-0.534197,5.56\n",
-    "Aqr 77,5.998515,-0.283999,5.56\n",
-    "Boo 32,3.847251,0.203515,5.56\n",
-    "Cep 14,5.768648,1.012301,5.56\n",
-    "CrB Pi,4.118926,0.567508,5.56\n",
-    "Dor Pi1,1.669567,-1.221454,5.56\n",
-    "Eri 5,0.784031,-0.043022,5.56\n",
-    "Gem 70,2.000787,0.611714,5.56\n",
-    "Hya 33,2.506925,-0.103236,5.56\n",
-    "Ori 18,1.379108,0.197945,5.56\n",
-    "Psc Psi1,0.286649,0.374640,5.56\n",
-    "Boo 47,3.950684,0.840395,5.57\n",
-    "Cas 32,0.312807,1.134794,5.57\n",
-    "Cnc Phi1,2.209856,0.486835,5.57\n",
-    "Com 5,3.194629,0.358525,5.57\n",
-    "Leo 81,2.991523,0.287218,5.57\n",
-    "Nor Iota2,4.229413,-1.011147,5.57\n",
-    "Oct Rho,4.115835,-1.474197,5.57\n",
-    "Peg 67,6.129800,0.565225,5.57\n",
-    "Psc Pi,0.423671,0.211912,5.57\n",
-    "Ser 64,4.962306,0.044249,5.57\n",
-    "Tau 12,0.959284,0.053354,5.57\n",
-    "And 47,0.365108,0.658251,5.58\n",
-    "Aqr 28,5.764313,0.010559,5.58\n",
-    "Ari 21,0.592161,0.437084,5.58\n",
-    "Cap Lambda,5.700834,-0.198371,5.58\n",
-    "Cas 53,0.536711,1.123818,5.58\n",
-    "Cep 4,5.424411,1.163393,5.58\n",
-    "Cet 28,0.288350,-0.171731,5.58\n",
-    "CrB Eta,4.028242,0.528621,5.58\n",
-    "Cyg 36,5.316607,0.645772,5.58\n",
-    "Del 13,5.444576,0.104865,5.58\n",
-    "Del 16,5.478778,0.219364,5.58\n",
-    "LMi 34,2.764231,0.610666,5.58\n",
-    "Lyr Delta1,4.946816,0.645277,5.58\n",
-    "Oct Kappa,3.581961,-1.497250,5.58\n",
-    "Oph 24,4.436627,-0.404044,5.58\n",
-    "Peg 36,5.886705,0.159329,5.58\n",
-    "Peg Pi1,5.799845,0.578964,5.58\n",
-    "Tau 80,1.178723,0.272936,5.58\n",
-    "UMa 42,2.842247,1.035329,5.58\n",
-    "UMa 6,2.341468,1.127551,5.58\n",
-    "Vir 6,3.120001,0.147374,5.58\n",
-    "And 15,6.172466,0.702257,5.59\n",
-    "And 63,0.615098,0.875307,5.59\n",
-    "Aql 22,5.046256,0.084382,5.59\n",
-    "Boo 24,3.790113,0.869955,5.59\n",
-    "CMi Delta2,1.977429,0.057426,5.59\n",
-    "Cas 10,0.028107,1.120434,5.59\n",
-    "Cas 43,0.446550,1.187575,5.59\n",
-    "Her 74,4.539390,0.807055,5.59\n",
-    "Hya 2,2.209820,-0.069595,5.59\n",
-    "Hya 28,2.467023,-0.089317,5.59\n",
-    "Lac 16,6.005649,0.726125,5.59\n",
-    "Peg 63,6.112259,0.530842,5.59\n",
-    "Pyx Epsilon,2.399566,-0.529974,5.59\n",
-    "Scl Xi,0.267494,-0.679224,5.59\n",
-    "Sgr 50,5.089031,-0.380075,5.59\n",
-    "Sgr Kappa1,5.333981,-0.733906,5.59\n",
-    "Tau 137,1.537511,0.247342,5.59\n",
-    "Tau 57,1.134297,0.244962,5.59\n",
-    "UMa 59,3.047098,0.761410,5.59\n",
-    "Vir 31,3.324641,0.118799,5.59\n",
-    "Vul 27,5.397773,0.461848,5.59\n",
-    "CVn 23,3.492040,0.700759,5.6\n",
-    "CVn Alpha1,3.385968,0.668718,5.6\n",
-    "Com 40,3.431215,0.394726,5.6\n",
-    "Hya 19,2.394170,-0.149914,5.6\n",
-    "Mon Beta,1.696569,-0.122774,5.6\n",
-    "Peg 20,5.764343,0.228982,5.6\n",
-    "Sgr 18,4.821581,-0.536805,5.6\n",
-    "UMa 81,3.552276,0.966016,5.6\n",
-    "Vir 83,3.597545,-0.282380,5.6\n",
-    "Aql 58,5.213066,0.004775,5.61\n",
-    "Cet 93,0.795761,0.075970,5.61\n",
-    "Cet Phi4,0.256265,-0.198618,5.61\n",
-    "CrA Eta2,4.928737,-0.758064,5.61\n",
-    "Equ 3,5.517764,0.096042,5.61\n",
-    "Gru Upsilon,6.051464,-0.678797,5.61\n",
-    "Hya 1,2.201660,-0.065469,5.61\n",
-    "Leo 44,2.728182,0.153322,5.61\n",
-    "Ori Lambda,1.462331,0.173398,5.61\n",
-    "Pic Iota,1.269378,-0.933077,5.61\n",
-    "Pic Nu,1.670847,-0.983842,5.61\n",
-    "Ari Theta,0.602684,0.347340,5.62\n",
-    "Boo 2,3.582456,0.392626,5.62\n",
-    "Cyg 40,5.356292,0.670909,5.62\n",
-    "Gru Pi2,5.860525,-0.801605,5.62\n",
-    "Her 78,4.589460,0.495804,5.62\n",
-    "Ind Kappa2,5.785105,-1.040846,5.62\n",
-    "Lup Xi2,4.175278,-0.592787,5.62\n",
-    "Lyn 43,2.539476,0.693904,5.62\n",
-    "Sco 4,4.169163,-0.458425,5.62\n",
-    "And 59,0.571072,0.681367,5.63\n",
-    "Ari 10,0.539547,0.452661,5.63\n",
-    "Ari Rho3,0.769843,0.314562,5.63\n",
-    "Cet 49,0.412901,-0.273600,5.63\n",
-    "Cet 64,0.573130,0.149570,5.63\n",
-    "Cnc Zeta1,2.147679,0.308012,5.63\n",
-    "Her 108,4.803808,0.521136,5.63\n",
-    "Her 28,4.331013,0.096362,5.63\n",
-    "Hya 55,3.871904,-0.447231,5.63\n",
-    "Leo 18,2.558602,0.206123,5.63\n",
-    "Ori 66,1.592497,0.072581,5.63\n",
-    "Peg 73,6.172517,0.584637,5.63\n",
-    "Psc 32,0.010886,0.148101,5.63\n",
-    "Ser 4,3.996011,0.006497,5.63\n",
-    "Ser 45,4.222061,0.172642,5.63\n",
-    "Tau 32,1.033533,0.392316,5.63\n",
-    "Vul 5,5.088595,0.350772,5.63\n",
-    "Boo 40,3.925311,0.685308,5.64\n",
-    "Cnc 15,2.151766,0.517606,5.64\n",
-    "Cnc 45,2.282912,0.221322,5.64\n",
-    "CrB Sigma,4.252844,0.590944,5.64\n",
-    "Leo 15,2.546239,0.523153,5.64\n",
-    "Lib Zeta1,4.050284,-0.291756,5.64\n",
-    "Lyn 29,2.172237,1.039712,5.64\n",
-    "Men Zeta,1.745526,-1.410464,5.64\n",
-    "Ori 35,1.456935,0.249679,5.64\n",
-    "Peg 11,5.703881,0.046881,5.64\n",
-    "Sge 1,5.040904,0.370572,5.64\n",
-    "Sgr Kappa2,5.340213,-0.740417,5.64\n",
-    "Tau 18,0.982453,0.433525,5.64\n",
-    "Tau 63,1.149372,0.292818,5.64\n",
-    "UMa Pi1,2.265416,1.134828,5.64\n",
-    "And 44,0.306800,0.734459,5.65\n",
-    "Aps Kappa2,4.103065,-1.281886,5.65\n",
-    "Cet 81,0.688082,-0.059273,5.65\n",
-    "Cha Pi,3.042371,-1.324647,5.65\n",
-    "CrA Kappa2,4.858059,-0.675898,5.65\n",
-    "Cyg 79,5.687279,0.668180,5.65\n",
-    "Gem 35,1.790817,0.234107,5.65\n",
-    "Hya 59,3.921115,-0.482710,5.65\n",
-    "Lup Nu2,4.022126,-0.843304,5.65\n",
-    "Men Pi,1.471153,-1.404452,5.65\n",
-    "Oct Pi1,3.935048,-1.452599,5.65\n",
-    "Oct Pi2,3.947840,-1.449292,5.65\n",
-    "Peg 19,5.764619,0.144116,5.65\n",
-    "Peg 38,5.890617,0.568497,5.65\n",
-    "Sex 18,2.665685,-0.146928,5.65\n",
-    "Sgr 51,5.131392,-0.431431,5.65\n",
-    "Tau 51,1.127425,0.376628,5.65\n",
-    "Vir 71,3.530874,0.188816,5.65\n",
-    "Vol Kappa2,2.181712,-1.248003,5.65\n",
-    "Aqr Tau1,5.967775,-0.245330,5.66\n",
-    "CVn 2,3.211959,0.709656,5.66\n",
-    "Cas 21,0.199186,1.308788,5.66\n",
-    "Cet 47,0.378998,-0.227882,5.66\n",
-    "Cnc 49,2.289654,0.175958,5.66\n",
-    "Cnc Sigma1,2.323804,0.566781,5.66\n",
-    "Com 4,3.193313,0.451522,5.66\n",
-    "Dra 48,4.960008,1.009062,5.66\n",
-    "Sge Epsilon,5.136897,0.287330,5.66\n",
-    "And 56,0.506822,0.650164,5.67\n",
-    "Aql 45,5.151870,-0.010840,5.67\n",
-    "Aqr 26,5.681781,0.022432,5.67\n",
-    "Boo 46,3.963628,0.459041,5.67\n",
-    "Cnc Omicron2,2.345664,0.271947,5.67\n",
-    "Leo 49,2.770870,0.150976,5.67\n",
-    "Ori 63,1.592482,0.094597,5.67\n",
-    "Peg 4,5.665913,0.100735,5.67\n",
-    "Psc 51,0.141357,0.121397,5.67\n",
-    "Sco 12,4.242306,-0.495979,5.67\n",
-    "Tau 31,1.012306,0.114052,5.67\n",
-    "UMa 43,2.841331,0.987546,5.67\n",
-    "Vir 33,3.343942,0.166504,5.67\n",
-    "Vul 14,5.232388,0.403195,5.67\n",
-    "Aql 62,5.255128,-0.012382,5.68\n",
-    "Ari 31,0.683435,0.217250,5.68\n",
-    "Com 25,3.302912,0.298267,5.68\n",
-    "Crv 6,3.243520,-0.433549,5.68\n",
-    "Dra 41,4.713058,1.396336,5.68\n",
-    "Gem 41,1.833745,0.280630,5.68\n",
-    "Leo 67,2.918271,0.430369,5.68\n",
-    "Mic Delta,5.524054,-0.525780,5.68\n",
-    "Psc 16,6.180160,0.036691,5.68\n",
-    "Psc 72,0.284009,0.260859,5.68\n",
-    "Ari Mu,0.708458,0.349269,5.69\n",
-    "Aur 51,1.739475,0.687500,5.69\n",
-    "Boo 39,3.881998,0.850334,5.69\n",
-    "Cap 37,5.649849,-0.350540,5.69\n",
-    "Cet Kappa2,0.877522,0.064151,5.69\n",
-    "Com 20,3.271271,0.364706,5.69\n",
-    "Cyg 43,5.353965,0.861902,5.69\n",
-    "Cyg 77,5.682712,0.716933,5.69\n",
-    "Her 16,4.256327,0.328267,5.69\n",
-    "Hyi Pi2,0.591121,-1.182398,5.69\n",
-    "Leo 8,2.517827,0.286893,5.69\n",
-    "Lup Kappa2,3.979176,-0.850737,5.69\n",
-    "Men Delta,1.125672,-1.399996,5.69\n",
-    "Per 3,0.517316,0.858775,5.69\n",
-    "Pup 10,2.060863,-0.259118,5.69\n",
-    "Scl Tau,0.419490,-0.521984,5.69\n",
-    "Sgr 33,4.948016,-0.372797,5.69\n",
-    "Tau 120,1.455285,0.323589,5.69\n",
-    "Tau 13,0.970032,0.343835,5.69\n",
-    "Vir 108,3.863737,0.012518,5.69\n",
-    "Vol Gamma1,1.870571,-1.230409,5.69\n",
-    "And 5,6.055231,0.860375,5.7\n",
-    "Aqr 19,5.607823,-0.170145,5.7\n",
-    "Ari 15,0.569966,0.340344,5.7\n",
-    "Boo 7,3.635586,0.312986,5.7\n",
-    "CMa Nu1,1.729534,-0.325678,5.7\n",
-    "Cas 2,6.063863,1.035557,5.7\n",
-    "Cet 38,0.326464,-0.016998,5.7\n",
-    "Com 29,3.354974,0.246484,5.7\n",
-    "Gru Tau3,6.007409,-0.837220,5.7\n",
-    "Her 10,4.239550,0.410060,5.7\n",
-    "Peg 23,5.783927,0.505515,5.7\n",
-    "Phe Xi,0.182271,-0.986140,5.7\n",
-    "Pic Mu,1.710306,-1.025454,5.7\n",
-    "UMa 73,3.261955,0.972371,5.7\n",
-    "UMa 84,3.606701,0.950031,5.7\n",
-    "UMa 86,3.638357,0.937741,5.7\n",
-    "Aql 57,5.212542,-0.143592,5.71\n",
-    "Ari 19,0.580562,0.266681,5.71\n",
-    "Cet 84,0.703506,-0.012145,5.71\n",
-    "Dor Eta1,1.597660,-1.152611,5.71\n",
-    "For Chi2,0.905637,-0.622758,5.71\n",
-    "For Zeta,0.783660,-0.441117,5.71\n",
-    "Gem 53,1.902198,0.486903,5.71\n",
-    "Her 84,4.639783,0.424600,5.71\n",
-    "Hya Chi2,2.905799,-0.476262,5.71\n",
-    "Leo 3,2.480491,0.142913,5.71\n",
-    "Phe Tau,0.004691,-0.851895,5.71\n",
-    "Ser Upsilon,4.133325,0.246358,5.71\n",
-    "Sgr 63,5.244613,-0.238010,5.71\n",
-    "And 23,0.058963,0.716201,5.72\n",
-    "Aql Pi,5.186689,0.206225,5.72\n",
-    "Ari 55,0.827337,0.507488,5.72\n",
-    "Cet 12,0.131074,-0.069067,5.72\n",
-    "Del Theta,5.404987,0.232391,5.72\n",
-    "Dra 71,5.321560,1.086598,5.72\n",
-    "Eri 46,1.195172,-0.117616,5.72\n",
-    "Her 50,4.409793,0.520224,5.72\n",
-    "Hya 3,2.249162,-0.139316,5.72\n",
-    "Tau 131,1.515033,0.252869,5.72\n",
-    "Tau 45,1.096670,0.096396,5.72\n",
-    "Tau 60,1.143445,0.245694,5.72\n",
-    "UMa 22,2.508445,1.260225,5.72\n",
-    "Vir 11,3.185473,0.101350,5.72\n",
-    "Aur 36,1.575058,0.836047,5.73\n",
-    "Cnc Psi,2.140006,0.445185,5.73\n",
-    "Gem 37,1.812132,0.442887,5.73\n",
-    "Lac 8,5.916106,0.691747,5.73\n",
-    "Lib 4,3.853803,-0.436289,5.73\n",
-    "Lyr Zeta2,4.907880,0.656147,5.73\n",
-    "Oct Gamma2,6.272473,-1.434137,5.73\n",
-    "Oph 73,4.754117,0.069697,5.73\n",
-    "Pav Theta,4.924577,-1.135821,5.73\n",
-    "Per 55,1.154041,0.595691,5.73\n",
-    "PsA 8,5.655667,-0.456777,5.73\n",
-    "Ser 47,4.225733,0.148949,5.73\n",
-    "UMa 5,2.327295,1.081445,5.73\n",
-    "UMa 62,3.061184,0.554074,5.73\n",
-    "Vir 80,3.558385,-0.094180,5.73\n",
-    "Ari 7,0.505491,0.411500,5.74\n",
-    "Boo 38,3.880354,0.804878,5.74\n",
-    "CMa 17,1.810975,-0.356130,5.74\n",
-    "Her 73,4.555789,0.400732,5.74\n",
-    "Hor Gamma,0.721948,-1.111852,5.74\n",
-    "Leo 85,3.009377,0.269013,5.74\n",
-    "Mus Zeta1,3.238451,-1.192191,5.74\n",
-    "Oph 14,4.370777,0.020614,5.74\n",
-    "Psc 66,0.238179,0.334900,5.74\n",
-    "And 13,6.139734,0.748955,5.75\n",
-    "Aqr 44,5.834236,-0.094025,5.75\n",
-    "Boo 1,3.580870,0.348290,5.75\n",
-    "Cep 25,5.839050,1.096144,5.75\n",
-    "Cet 77,0.675057,-0.137173,5.75\n",
-    "Cnc Upsilon1,2.231876,0.420295,5.75\n",
-    "Cyg Iota1,5.093882,0.913166,5.75\n",
-    "Dra 68,5.286522,1.083476,5.75\n",
-    "Dra 76,5.421807,1.440440,5.75\n",
-    "Eri Rho1,0.790489,-0.133741,5.75\n",
-    "For Iota1,0.681355,-0.524379,5.75\n",
-    "Gem 3,1.613266,0.403404,5.75\n",
-    "Her 4,4.169199,0.742919,5.75\n",
-    "Lep 1,1.320989,-0.397848,5.75\n",
-    "Oph 12,4.347433,-0.040574,5.75\n",
-    "Oph 26,4.451280,-0.436143,5.75\n",
-    "Ori 68,1.623251,0.345410,5.75\n",
-    "Peg 34,5.875753,0.076683,5.75\n",
-    "Peg 52,6.017881,0.204708,5.75\n",
-    "Peg 85,0.009468,0.472669,5.75\n",
-    "Per 8,0.602131,1.010541,5.75\n",
-    "Vir 66,3.510526,-0.090127,5.75\n",
-    "Aqr 50,5.866277,-0.236133,5.76\n",
-    "Boo 10,3.659294,0.378669,5.76\n",
-    "Gem 59,1.939744,0.482375,5.76\n",
-    "Pav Mu1,5.237660,-1.168488,5.76\n",
-    "Per 56,1.154637,0.592709,5.76\n",
-    "Tau 21,0.985704,0.428561,5.76\n",
-    "And 12,6.112528,0.666405,5.77\n",
-    "Ari Omicron,0.717978,0.267239,5.77\n",
-    "Cam 1,1.186955,0.940922,5.77\n",
-    "Eri 59,1.259001,-0.285003,5.77\n",
-    "Her 37,4.366137,0.073648,5.77\n",
-    "Her 79,4.614294,0.424290,5.77\n",
-    "Hya 48,3.665199,-0.436512,5.77\n",
-    "Hya 57,3.874449,-0.465067,5.77\n",
-    "LMi 32,2.749359,0.679374,5.77\n",
-    "Leo 89,3.029746,0.053407,5.77\n",
-    "Mic Theta2,5.604310,-0.715701,5.77\n",
-    "Oct Upsilon,5.897569,-1.500411,5.77\n",
-    "Per 11,0.711425,0.961778,5.77\n",
-    "Psc 21,6.237189,0.018782,5.77\n",
-    "Psc 44,0.110843,0.033855,5.77\n",
-    "Sex 19,2.673866,0.080542,5.77\n",
-    "Tau 117,1.431286,0.300875,5.77\n",
-    "Tau 6,0.927642,0.163600,5.77\n",
-    "Aqr 51,5.864808,-0.084421,5.78\n",
-    "Aur 64,1.911296,0.713549,5.78\n",
-    "Cap 19,5.475091,-0.312816,5.78\n",
-    "Cap 35,5.616673,-0.369942,5.78\n",
-    "Cas 44,0.450855,1.056816,5.78\n",
-    "Cnc 1,2.081261,0.275592,5.78\n",
-    "Com 30,3.356661,0.480877,5.78\n",
-    "CrB Upsilon,4.261861,0.508768,5.78\n",
-    "Gem 47,1.882272,0.468737,5.78\n",
-    "Lyn 33,2.245933,0.635639,5.78\n",
-    "Peg 25,5.793788,0.378785,5.78\n",
-    "Sco 11,4.221981,-0.222452,5.78\n",
-    "And 10,6.108100,0.734401,5.79\n",
-    "Aql 56,5.210404,-0.149647,5.79\n",
-    "Ari 20,0.592394,0.449999,5.79\n",
-    "Ari 56,0.838791,0.475723,5.79\n",
-    "Aur 53,1.738275,0.505869,5.79\n",
-    "CVn 19,3.471169,0.713059,5.79\n",
-    "Dra Psi1,4.633704,1.259376,5.79\n",
-    "For Lambda2,0.684940,-0.603506,5.79\n",
-    "Men Nu,1.138675,-1.423840,5.79\n",
-    "Peg 80,6.245457,0.162548,5.79\n",
-    "Per 2,0.489376,0.886501,5.79\n",
-    "Psc 35,0.065363,0.153953,5.79\n",
-    "Sex 35,2.807137,0.082864,5.79\n",
-    "Sex 41,2.837476,-0.155296,5.79\n",
-    "Tau 89,1.213687,0.279834,5.79\n",
-    "Tau 99,1.299449,0.417982,5.79\n",
-    "UMi 24,4.584980,1.517879,5.79\n",
-    "Vir 44,3.401901,-0.066531,5.79\n",
-    "Aql 35,5.100797,0.034039,5.8\n",
-    "Aqr 74,5.992930,-0.202749,5.8\n",
-    "Ari 47,0.777050,0.360735,5.8\n",
-    "Cep 13,5.737275,0.988055,5.8\n",
-    "Dra Mu,4.473839,0.950686,5.8\n",
-    "Gem 5,1.621142,0.426214,5.8\n",
-    "Lib Xi1,3.902476,-0.207665,5.8\n",
-    "Peg 21,5.774058,0.198730,5.8\n",
-    "Sge 15,5.253892,0.297928,5.8\n",
-    "UMa 39,2.808766,0.998314,5.8\n",
-    "And 45,0.310545,0.658411,5.81\n",
-    "Aqr 35,5.798784,-0.323230,5.81\n",
-    "CMi Delta3,1.982098,0.058842,5.81\n",
-    "Cas 38,0.398066,1.226351,5.81\n",
-    "Leo 56,2.862449,0.107953,5.81\n",
-    "Nor Zeta,4.247157,-0.969370,5.81\n",
-    "Oph 53,4.601611,0.167319,5.81\n",
-    "Ser Tau7,4.109865,0.322256,5.81\n",
-    "Tau 98,1.300954,0.437210,5.81\n",
-    "UMa 71,3.250908,0.990954,5.81\n",
-    "Vul 8,5.100507,0.432294,5.81\n",
-    "Aqr 15,5.577134,-0.078879,5.82\n",
-    "Ari 40,0.735373,0.319109,5.82\n",
-    "Cet 30,0.295702,-0.170790,5.82\n",
-    "Cnc 66,2.362310,0.562912,5.82\n",
-    "Equ 9,5.589766,0.128359,5.82\n",
-    "Gem 52,1.896729,0.434325,5.82\n",
-    "Leo 39,2.693232,0.403278,5.82\n",
-    "Lib Zeta3,4.060828,-0.289889,5.82\n",
-    "Peg 40,5.929218,0.340727,5.82\n",
-    "UMa 32,2.696679,1.136355,5.82\n",
-    "Cep Rho1,5.876124,1.375072,5.83\n",
-    "Cnc Omega1,2.098460,0.443188,5.83\n",
-    "Dra Mu,4.473846,0.950686,5.83\n",
-    "For Iota2,0.690765,-0.526988,5.83\n",
-    "Ari 4,0.472032,0.295930,5.84\n",
-    "Eri 6,0.777086,-0.412004,5.84\n",
-    "Mon 12,1.711819,0.084750,5.84\n",
-    "UMa 66,3.124023,0.987832,5.84\n",
-    "Cap Xi2,5.290231,-0.220217,5.85\n",
-    "Gem 33,1.788221,0.282792,5.85\n",
-    "Gem 48,1.886875,0.421119,5.85\n",
-    "Her 21,4.294295,0.121266,5.85\n",
-    "Her 77,4.567250,0.842296,5.85\n",
-    "Hya 60,3.936183,-0.489749,5.85\n",
-    "LMi 38,2.788716,0.661654,5.85\n",
-    "LMi 7,2.490236,0.587400,5.85\n",
-    "Lyn 11,1.735039,0.992351,5.85\n",
-    "Men Xi,1.303972,-1.439383,5.85\n",
-    "Vir 12,3.200199,0.179110,5.85\n",
-    "Ari 1,0.480584,0.388777,5.86\n",
-    "Gru Sigma2,5.920942,-0.708449,5.86\n",
-    "Her 100,4.746532,0.455555,5.86\n",
-    "Aqr 16,5.589730,-0.079587,5.87\n",
-    "Aur 39,1.592860,0.750172,5.87\n",
-    "Aur Psi9,1.817491,0.807637,5.87\n",
-    "Cap 4,5.314629,-0.380656,5.87\n",
-    "Cet 42,0.348215,-0.008882,5.87\n",
-    "Cnc 50,2.299180,0.211359,5.87\n",
-    "Com 2,3.160253,0.374533,5.87\n",
-    "Lep 12,1.493267,-0.390493,5.87\n",
-    "Lib 18,3.922162,-0.194502,5.87\n",
-    "Psc 14,6.170393,-0.021773,5.87\n",
-    "Psc 54,0.171755,0.370892,5.87\n",
-    "Ret Theta,1.124297,-1.104018,5.87\n",
-    "Sco 3,4.165483,-0.440584,5.87\n",
-    "Sgr Rho2,5.069520,-0.319541,5.87\n",
-    "Vir 25,3.302119,-0.101787,5.87\n",
-    "Vir 64,3.500091,0.089967,5.87\n",
-    "Boo Pi2,3.842917,0.286544,5.88\n",
-    "Cap 44,5.685730,-0.251323,5.88\n",
-    "Cas 9,0.018442,1.087127,5.88\n",
-    "Cnc 36,2.256260,0.168521,5.88\n",
-    "Cyg 42,5.364008,0.636255,5.88\n",
-    "Lyn 6,1.705129,1.015132,5.88\n",
-    "Psc 112,0.524268,0.054057,5.88\n",
-    "Ser Psi,4.119108,0.043895,5.88\n",
-    "Aql 10,4.968872,0.242717,5.89\n",
-    "Aqr 12,5.515582,-0.101631,5.89\n",
-    "Aqr 60,5.908150,-0.027474,5.89\n",
-    "For Epsilon,0.792503,-0.490292,5.89\n",
-    "Lyn 30,2.183560,1.007811,5.89\n",
-    "Psc 53,0.160519,0.265843,5.89\n",
-    "Tau 105,1.343576,0.378819,5.89\n",
-    "Tri 13,0.649299,0.522411,5.89\n",
-    "Vir 65,3.505123,-0.085948,5.89\n",
-    "Aql 5,4.915174,-0.016784,5.9\n",
-    "Ari 49,0.793696,0.461853,5.9\n",
-    "Ari 59,0.872359,0.472480,5.9\n",
-    "Aur 47,1.701914,0.814817,5.9\n",
-    "Cru Kappa,3.376419,-1.053776,5.9\n",
-    "Eri 56,1.239569,-0.148416,5.9\n",
-    "For Lambda1,0.668097,-0.604757,5.9\n",
-    "For Sigma,0.988104,-0.512046,5.9\n",
-    "Her 100,4.746532,0.455487,5.9\n",
-    "LMi 27,2.718808,0.591807,5.9\n",
-    "LMi 33,2.756995,0.565128,5.9\n",
-    "Ori 59,1.563844,0.032061,5.9\n",
-    "Scl Lambda2,0.192866,-0.670585,5.9\n",
-    "Tau 39,1.070483,0.384128,5.9\n",
-    "Tau 76,1.171072,0.257276,5.9\n",
-    "Vir 13,3.223063,-0.013740,5.9\n",
-    "Aql Upsilon,5.173440,0.132878,5.91\n",
-    "Ari Rho2,0.767109,0.319948,5.91\n",
-    "CVn 17,3.447258,0.671932,5.91\n",
-    "Leo 55,2.861060,0.012862,5.91\n",
-    "Leo 76,2.962333,0.028808,5.91\n",
-    "Lyr Nu1,4.929530,0.572691,5.91\n",
-    "Oct Omega,3.975591,-1.479821,5.91\n",
-    "Sex 17,2.662173,-0.146753,5.91\n",
-    "TrA Eta1,4.369381,-1.191992,5.91\n",
-    "Vir 92,3.649767,0.018336,5.91\n",
-    "Boo 26,3.807181,0.388510,5.92\n",
-    "CMa 26,1.885843,-0.452782,5.92\n",
-    "Cam 51,2.036225,1.142420,5.92\n",
-    "For Eta2,0.742841,-0.625589,5.92\n",
-    "For Psi,0.757357,-0.670851,5.92\n",
-    "Her 39,4.370355,0.469789,5.92\n",
-    "Lac 14,5.979338,0.732229,5.92\n",
-    "Oph Rho,4.300426,-0.409212,5.92\n",
-    "Ori 57,1.548740,0.344698,5.92\n",
-    "Sgr 57,5.201954,-0.332398,5.92\n",
-    "Tau 7,0.935686,0.426985,5.92\n",
-    "Vul 20,5.288399,0.462144,5.92\n",
-    "Ant Zeta2,2.493799,-0.556270,5.93\n",
-    "Cap 17,5.437428,-0.375493,5.93\n",
-    "Cet 14,0.155102,-0.008824,5.93\n",
-    "Cet 61,0.540194,-0.005939,5.93\n",
-    "Cet 63,0.574199,-0.031857,5.93\n",
-    "Gem 61,1.950136,0.353555,5.93\n",
-    "Mon 16,1.773865,0.149875,5.93\n",
-    "Psc 24,6.252322,-0.055075,5.93\n",
-    "Psc 62,0.210705,0.127409,5.93\n",
-    "Ser Tau5,4.086201,0.281328,5.93\n",
-    "And 6,6.066997,0.759989,5.94\n",
-    "Cam 26,1.511921,0.979401,5.94\n",
-    "Cap Omicron,5.366444,-0.324340,5.94\n",
-    "Cet 34,0.312959,-0.039289,5.94\n",
-    "Crt Kappa,2.998294,-0.215665,5.94\n",
-    "Cyg 69,5.610288,0.639969,5.94\n",
-    "Equ 4,5.521545,0.103993,5.94\n",
-    "Lib 47,4.166995,-0.338298,5.94\n",
-    "Lyn 4,1.667051,1.036241,5.94\n",
-    "Lyn 8,1.735250,1.073048,5.94\n",
-    "Oph Tau,4.725843,-0.142773,5.94\n",
-    "Ser 61,4.851797,-0.017507,5.94\n",
-    "UMa 58,3.012955,0.753517,5.94\n",
-    "Vir 50,3.445956,-0.180283,5.94\n",
-    "Aqr 45,5.842548,-0.232216,5.95\n",
-    "Aur 5,1.310328,0.687568,5.95\n",
-    "Boo 3,3.607254,0.448588,5.95\n",
-    "CVn 10,3.337906,0.685546,5.95\n",
-    "Cet 33,0.307876,0.042683,5.95\n",
-    "Cnc 20,2.196337,0.319958,5.95\n",
-    "Cnc 29,2.219281,0.248026,5.95\n",
-    "Cnc Rho1,2.323891,0.494466,5.95\n",
-    "Dra 37,4.779075,1.200016,5.95\n",
-    "Leo 62,2.895545,-0.000015,5.95\n",
-    "Leo 90,3.031237,0.293162,5.95\n",
-    "Sgr 16,4.778777,-0.355839,5.95\n",
-    "Vir 10,3.183866,0.033122,5.95\n",
-    "Com 38,3.408453,0.298854,5.96\n",
-    "Cyg 16,5.156641,0.881832,5.96\n",
-    "Dra 74,5.364524,1.415312,5.96\n",
-    "Eri 21,0.955648,-0.098194,5.96\n",
-    "Leo 35,2.690156,0.410206,5.97\n",
-    "Peg 79,6.238054,0.503397,5.97\n",
-    "PsA 21,5.983636,-0.515502,5.97\n",
-    "PsA 6,5.638475,-0.592447,5.97\n",
-    "Psc 105,0.434936,0.286336,5.97\n",
-    "Sex 25,2.720277,-0.071108,5.97\n",
-    "Sgr 9,4.729290,-0.425172,5.97\n",
-    "And 39,0.274475,0.721606,5.98\n",
-    "Cnc 75,2.394541,0.464767,5.98\n",
-    "Cnc Lambda,2.183996,0.419267,5.98\n",
-    "Del 15,5.452539,0.218956,5.98\n",
-    "Lyr 19,5.025530,0.545997,5.98\n",
-    "Peg 69,6.142134,0.439251,5.98\n",
-    "Per 7,0.602466,1.003855,5.98\n",
-    "Psc 87,0.323439,0.281585,5.98\n",
-    "Aql 64,5.271025,-0.011839,5.99\n",
-    "Aqr 17,5.597875,-0.162655,5.99\n",
-    "Aqr 4,5.460386,-0.098199,5.99\n",
-    "Cap 45,5.689846,-0.257426,5.99\n",
-    "Cnc 5,2.100962,0.287199,5.99\n",
-    "Cnc Mu1,2.121913,0.395065,5.99\n",
-    "Com 39,3.431114,0.369195,5.99\n",
-    "Del 10,5.416062,0.254522,5.99\n",
-    "Psc 60,0.206792,0.117650,5.99\n",
-    "Vir 46,3.406003,-0.058793,5.99\n",
-    "Aur 62,1.828436,0.664137,6\n",
-    "Cap 47,5.699685,-0.161894,6\n",
-    "Cas 52,0.536158,1.132743,6\n",
-    "CrB Zeta1,4.098775,0.639430,6\n",
-    "Oct Mu1,5.419458,-1.329602,6\n",
-    "Peg 18,5.760161,0.117242,6\n",
-    "Psc 73,0.283078,0.098723,6\n",
-    "Tau 129,1.513019,0.276155,6\n",
-    "UMa 51,2.899515,0.667438,6\n",
-    "Cam 53,2.101842,1.052860,6.01\n",
-    "Cnc 79,2.401348,0.383909,6.01\n",
-    "For Tau,0.954673,-0.487698,6.01\n",
-    "Ser Tau6,4.105829,0.279684,6.01\n",
-    "Sex 6,2.579742,-0.074060,6.01\n",
-    "Vir 73,3.543222,-0.326881,6.01\n",
-    "And 9,6.101627,0.729087,6.02\n",
-    "Aql Omega2,5.060946,0.201324,6.02\n",
-    "Ari 16,0.572468,0.452685,6.02\n",
-    "Cnc Zeta1,2.147679,0.308012,6.02\n",
-    "Gem 44,1.855750,0.395094,6.02\n",
-    "Gem 58,1.935003,0.400471,6.02\n",
-    "Lyr Epsilon1,4.905851,0.692392,6.02\n",
-    "Psc 97,0.392183,0.320365,6.02\n",
-    "Sex 7,2.583975,0.042833,6.02\n",
-    "Tau 85,1.186228,0.276664,6.02\n",
-    "Vir 37,3.366806,0.053349,6.02\n",
-    "Aqr 39,5.813823,-0.247730,6.03\n",
-    "Ari 66,0.909506,0.398008,6.03\n",
-    "Aur 54,1.743373,0.493283,6.03\n",
-    "Cyg 61,5.527989,0.676199,6.03\n",
-    "Hya Phi2,2.776288,-0.285264,6.03\n",
-    "Oph 16,4.387300,0.017807,6.03\n",
-    "Psc 88,0.325969,0.122091,6.03\n",
-    "Ari 29,0.667159,0.262405,6.04\n",
-    "Cet 26,0.278453,0.023853,6.04\n",
-    "Dra 40,4.712636,1.396278,6.04\n",
-    "Gru Tau1,5.993599,-0.848196,6.04\n",
-    "LMi 44,2.835702,0.488236,6.04\n",
-    "Leo 45,2.738640,0.170388,6.04\n",
-    "Mic Beta,5.462793,-0.579052,6.04\n",
-    "Peg 33,5.862823,0.363872,6.04\n",
-    "Cam 24,1.496736,0.987536,6.05\n",
-    "Cyg 11,5.130417,0.644802,6.05\n",
-    "Ind Rho,5.998071,-1.223015,6.05\n",
-    "Men Iota,1.464353,-1.375683,6.05\n",
-    "CVn 4,3.245367,0.742512,6.06\n",
-    "Cen 3,3.629565,-0.575867,6.06\n",
-    "Hyi Tau2,0.470257,-1.399347,6.06\n",
-    "Lyn 23,2.010728,0.996282,6.06\n",
-    "Psc 48,0.123097,0.287019,6.06\n",
-    "Scl Lambda1,0.186379,-0.671312,6.06\n",
-    "Tau 33,1.034384,0.404490,6.06\n",
-    "Cas 55,0.586802,1.161071,6.07\n",
-    "Cnc 67,2.364114,0.486995,6.07\n",
-    "Equ 6,5.543689,0.175386,6.07\n",
-    "Leo 43,2.718379,0.114188,6.07\n",
-    "Pup 2,2.031061,-0.256403,6.07\n",
-    "UMa 76,3.322954,1.094549,6.07\n",
-    "Vir 34,3.347658,0.208707,6.07\n",
-    "Ari 65,0.892016,0.363092,6.08\n",
-    "CMa 12,1.775982,-0.366791,6.08\n",
-    "Cam 12,1.336064,1.030113,6.08\n",
-    "Cam 8,1.308001,0.927739,6.08\n",
-    "Cnc 21,2.198766,0.185562,6.08\n",
-    "CrB Eta,4.028242,0.528621,6.08\n",
-    "Cyg Mu2,5.690377,0.501661,6.08\n",
-    "Del 1,5.368196,0.190168,6.08\n",
-    "Gem 8,1.641991,0.418355,6.08\n",
-    "Her 56,4.428926,0.449083,6.08\n",
-    "Lib Iota2,3.985110,-0.342914,6.08\n",
-    "Ser 43,4.205204,0.087034,6.08\n",
-    "Tau 110,1.412095,0.291460,6.08\n",
-    "Tau 96,1.264207,0.277580,6.08\n",
-    "UMa 75,3.272805,1.025686,6.08\n",
-    "Aur 41,1.621455,0.850169,6.09\n",
-    "Cir Zeta,3.903894,-1.151767,6.09\n",
-    "Leo 20,2.573641,0.369651,6.09\n",
-    "Per 49,1.083217,0.658474,6.09\n",
-    "Per 57,1.192998,0.751607,6.09\n",
-    "Phe Theta,6.193592,-0.813983,6.09\n",
-    "Psc 67,0.244237,0.474894,6.09\n",
-    "Vir 72,3.536161,-0.112928,6.09\n",
-    "And 59,0.571137,0.681430,6.1\n",
-    "Aql 8,4.936526,-0.057906,6.1\n",
-    "Aur 38,1.585195,0.748950,6.1\n",
-    "Cnc 28,2.219244,0.421405,6.1\n",
-    "Gem 39,1.827316,0.455201,6.1\n",
-    "Oph 19,4.394579,0.036031,6.1\n",
-    "Ser 39,4.159127,0.230325,6.1\n",
-    "UMa 60,3.048036,0.817410,6.1\n",
-    "And 26,0.081601,0.764299,6.11\n",
-    "Ari 53,0.817810,0.312065,6.11\n",
-    "Cyg 76,5.679178,0.712186,6.11\n",
-    "Eri 7,0.789107,-0.050241,6.11\n",
-    "Hya 21,2.410445,-0.124088,6.11\n",
-    "Phe Omega,0.270657,-0.994881,6.11\n",
-    "Pic Kappa,1.406597,-0.979731,6.11\n",
-    "PsA 7,5.658423,-0.576797,6.11\n",
-    "Psc 1,5.999533,0.018583,6.11\n",
-    "Psc 36,0.072293,0.143815,6.11\n",
-    "Pup 22,2.193792,-0.227848,6.11\n",
-    "Tau 11,0.963298,0.442082,6.11\n",
-    "Vir 38,3.373663,-0.062013,6.11\n",
-    "And 66,0.645176,0.882608,6.12\n",
-    "Ari 60,0.874526,0.447900,6.12\n",
-    "Aur 59,1.802162,0.678395,6.12\n",
-    "Cet 27,0.286292,-0.174169,6.12\n",
-    "Col Pi1,1.599958,-0.738250,6.12\n",
-    "Ind Gamma,5.612353,-0.954007,6.12\n",
-    "Ind Kappa1,5.753049,-1.029958,6.12\n",
-    "Leo 42,2.713282,0.261373,6.12\n",
-    "Mon 1,1.566506,-0.163751,6.12\n",
-    "Psc 75,0.290423,0.226127,6.12\n",
-    "Ser 8,4.030525,-0.017846,6.12\n",
-    "Ser Tau3,4.082121,0.308148,6.12\n",
-    "Aql 68,5.359972,-0.058604,6.13\n",
-    "Cam 15,1.393922,1.014337,6.13\n",
-    "Cnc 46,2.292301,0.535777,6.13\n",
-    "Crt Psi,2.934364,-0.322886,6.13\n",
-    "Hya 10,2.290839,0.099144,6.13\n",
-    "Psc 59,0.206065,0.341716,6.13\n",
-    "Pup 14,2.114866,-0.344320,6.13\n",
-    "Sge 18,5.307234,0.376967,6.13\n",
-    "Tau 95,1.235824,0.420430,6.13\n",
-    "Tuc Theta,0.145684,-1.243828,6.13\n",
-    "Aur 17,1.388911,0.589349,6.14\n",
-    "Cam 30,1.537155,1.029119,6.14\n",
-    "Cnc 25,2.207107,0.297511,6.14\n",
-    "Eri 14,0.857808,-0.159775,6.14\n",
-    "Eri 32,1.022283,-0.051536,6.14\n",
-    "For Gamma1,0.741110,-0.428658,6.14\n",
-    "Her 8,4.227086,0.300298,6.14\n",
-    "LMi 13,2.542559,0.612494,6.14\n",
-    "Ser Tau8,4.122039,0.301317,6.14\n",
-    "Tau 14,0.976454,0.343219,6.14\n",
-    "Aqr 82,6.032483,-0.114741,6.15\n",
-    "Ari 11,0.553357,0.448632,6.15\n",
-    "Ari 26,0.657291,0.346540,6.15\n",
-    "Cam 19,1.471538,1.119711,6.15\n",
-    "Cam 23,1.501609,1.072970,6.15\n",
-    "Cet 18,0.198437,-0.224813,6.15\n",
-    "LMi 43,2.831593,0.513403,6.15\n",
-    "Cet 21,0.236899,-0.152556,6.16\n",
-    "Col Nu1,1.471640,-0.486448,6.16\n",
-    "Hyi Sigma,0.505455,-1.367436,6.16\n",
-    "Pup 21,2.170251,-0.284227,6.16\n",
-    "Lib 26,3.990528,-0.310121,6.17\n",
-    "Lib 28,4.018162,-0.316928,6.17\n",
-    "Oph 61,4.645048,0.045020,6.17\n",
-    "Ori 13,1.342325,0.165317,6.17\n",
-    "Peg 60,6.072960,0.468572,6.17\n",
-    "PsA 19,5.944453,-0.512443,6.17\n",
-    "Vir 104,3.784776,-0.106819,6.17\n",
-    "Ant Zeta1,2.490447,-0.556576,6.18\n",
-    "Cas 13,0.137103,1.160983,6.18\n",
-    "Gem 82,2.044479,0.403889,6.18\n",
-    "LMi 9,2.502388,0.636817,6.18\n",
-    "Peg 3,5.662408,0.115512,6.18\n",
-    "Aqr 70,5.971222,-0.184229,6.19\n",
-    "Aqr 78,5.997686,-0.125746,6.19\n",
-    "Cet 10,0.116166,-0.000868,6.19\n",
-    "Cyg 44,5.371193,0.644652,6.19\n",
-    "Her 63,4.498819,0.423029,6.19\n",
-    "Ind Pi,5.743151,-1.010536,6.19\n",
-    "Oct Eta,2.876434,-1.476442,6.19\n",
-    "Vir 27,3.322991,0.181975,6.19\n",
-    "Vir 85,3.602294,-0.275195,6.19\n",
-    "Cnc Zeta2,2.147722,0.308012,6.2\n",
-    "Dra 69,5.234286,1.334852,6.2\n",
-    "LMi 48,2.856682,0.444899,6.2\n",
-    "Leo 88,3.018322,0.250707,6.2\n",
-    "Sgr 54,5.151877,-0.284372,6.2\n",
-    "Aqr 11,5.500245,-0.082559,6.21\n",
-    "Aqr 81,6.027465,-0.123240,6.21\n",
-    "CVn 7,3.272703,0.899465,6.21\n",
-    "Car Eta,2.814605,-1.041685,6.21\n",
-    "Cet 44,0.366701,-0.139757,6.21\n",
-    "Her 97,4.723305,0.400083,6.21\n",
-    "Lib 2,3.767410,-0.204451,6.21\n",
-    "Peg 41,5.933174,0.343500,6.21\n",
-    "Psc 26,6.261936,0.123414,6.21\n",
-    "Psc 3,6.024142,0.003243,6.21\n",
-    "Sex 14,2.647621,0.097937,6.21\n",
-    "Gem 16,1.692722,0.357725,6.22\n",
-    "Psc 101,0.417890,0.255890,6.22\n",
-    "Ser Tau2,4.067323,0.280232,6.22\n",
-    "Tuc Lambda1,0.228660,-1.213081,6.22\n",
-    "Ari 27,0.658455,0.308991,6.23\n",
-    "Boo 11,3.670318,0.477988,6.23\n",
-    "Cnc 53,2.323368,0.493216,6.23\n",
-    "Psc 42,0.097848,0.235314,6.23\n",
-    "Sge 9,5.202667,0.325887,6.23\n",
-    "Sgr 26,4.895038,-0.415970,6.23\n",
-    "Tri 5,0.573413,0.550239,6.23\n",
-    "Leo 13,2.537891,0.452263,6.24\n",
-    "Lyn 32,2.239970,0.635935,6.24\n",
-    "Sex 4,2.576550,0.075810,6.24\n",
-    "Cap 20,5.496049,-0.332228,6.25\n",
-    "Cap 27,5.539457,-0.358777,6.25\n",
-    "Dra 55,5.016789,1.151544,6.25\n",
-    "Gem 9,1.644878,0.414356,6.25\n",
-    "Her Kappa,4.224053,0.297656,6.25\n",
-    "Lyn 25,2.070346,0.827044,6.25\n",
-    "Peg 45,5.957987,0.338012,6.25\n",
-    "Per 10,0.633845,0.988031,6.25\n",
-    "Psc 78,0.296801,0.558719,6.25\n",
-    "Psc 9,6.140272,0.019591,6.25\n",
-    "Sge 2,5.080515,0.295620,6.25\n",
-    "Tau 113,1.422858,0.291475,6.25\n",
-    "Vir 41,3.376463,0.216746,6.25\n",
-    "Aql Psi,5.168654,0.232177,6.26\n",
-    "Car Upsilon,2.561758,-1.135729,6.26\n",
-    "Cet 1,6.276000,-0.276591,6.26\n",
-    "Lyn 28,2.125658,0.755034,6.26\n",
-    "Oph 29,4.458676,-0.329615,6.26\n",
-    "Peg 74,6.185723,0.293661,6.26\n",
-    "Sex 33,2.798650,-0.030398,6.26\n",
-    "Vir 20,3.285793,0.179691,6.26\n",
-    "Ari 54,0.821846,0.328035,6.27\n",
-    "CVn 11,3.354072,0.845908,6.27\n",
-    "Cnc 12,2.132385,0.238077,6.27\n",
-    "Com 8,3.225885,0.402032,6.27\n",
-    "Pav Tau,5.046074,-1.207603,6.27\n",
-    "Pic Theta,1.417076,-0.913093,6.27\n",
-    "Psc 109,0.457843,0.350515,6.27\n",
-    "Tau 108,1.376461,0.388942,6.27\n",
-    "CVn 15,3.445716,0.672543,6.28\n",
-    "Gru Sigma1,5.918797,-0.708303,6.28\n",
-    "Her 57,4.439754,0.442489,6.28\n",
-    "LMi 35,2.776630,0.634025,6.28\n",
-    "Psc 25,6.252991,0.036487,6.28\n",
-    "Ser 7,4.024671,0.219344,6.28\n",
-    "Sex 36,2.815027,0.043425,6.28\n",
-    "Sgr 6,4.718432,-0.299445,6.28\n",
-    "Vir 54,3.462064,-0.328587,6.28\n",
-    "Aqr 100,6.159711,-0.372967,6.29\n",
-    "Cnc 61,2.347373,0.527676,6.29\n",
-    "Com 22,3.288069,0.423819,6.29\n",
-    "Peg 65,6.120324,0.363528,6.29\n",
-    "Ser 40,4.165541,0.149754,6.29\n",
-    "Aur 60,1.803027,0.670871,6.3\n",
-    "Cnc Epsilon,2.270892,0.341125,6.3\n",
-    "Cnc Phi2,2.211259,0.470109,6.3\n",
-    "Leo 54,2.860689,0.431950,6.3\n",
-    "Lib Omicron,4.018722,-0.271370,6.3\n",
-    "Psc Zeta,0.321817,0.132267,6.3\n",
-    "Sco Nu,4.241048,-0.339462,6.3\n",
-    "Tel Mu,5.107597,-0.961851,6.3\n",
-    "Cnc Omega2,2.101944,0.437898,6.31\n",
-    "Hya 37,2.529811,-0.184486,6.31\n",
-    "Cap 3,5.307459,-0.215320,6.32\n",
-    "Cnc Phi2,2.211245,0.470095,6.32\n",
-    "Com 32,3.369380,0.297996,6.32\n",
-    "CrA Kappa1,4.858073,-0.675796,6.32\n",
-    "Cyg 48,5.399743,0.551044,6.32\n",
-    "Psc 31,0.010487,0.156328,6.32\n",
-    "Tau 48,1.116014,0.268790,6.32\n",
-    "UMa 35,2.748479,1.145392,6.32\n",
-    "Cet 71,0.632565,-0.048520,6.33\n",
-    "Com 9,3.226648,0.491431,6.33\n",
-    "Del 14,5.453303,0.137256,6.33\n",
-    "Gem 79,2.029622,0.354588,6.33\n",
-    "Hyi Tau1,0.442245,-1.381399,6.33\n",
-    "Lib 5,3.865744,-0.269823,6.33\n",
-    "Vul 7,5.102245,0.353948,6.33\n",
-    "Aql 46,5.158379,0.212814,6.34\n",
-    "Cae Gamma2,1.328348,-0.623175,6.34\n",
-    "Cap Xi1,5.288195,-0.216290,6.34\n",
-    "Cas 35,0.353807,1.128501,6.34\n",
-    "Sgr 53,5.147950,-0.408892,6.34\n",
-    "UMa 28,2.556573,1.110960,6.34\n",
-    "UMa 41,2.820343,1.001223,6.34\n",
-    "Aqr 53,5.875535,-0.292212,6.35\n",
-    "Cam 47,1.929840,1.045486,6.35\n",
-    "LMi 50,2.864842,0.445059,6.35\n",
-    "Psc 77,0.287194,0.085667,6.35\n",
-    "Aqr 20,5.606267,-0.059312,6.36\n",
-    "Cnc Upsilon2,2.238392,0.420358,6.36\n",
-    "Leo 7,2.512758,0.250973,6.36\n",
-    "Per 5,0.573704,1.006110,6.36\n",
-    "Pup 8,2.058100,-0.223742,6.36\n",
-    "Tau 62,1.151903,0.424134,6.36\n",
-    "Aqr 29,5.770248,-0.296081,6.37\n",
-    "Aqr 56,5.891752,-0.254571,6.37\n",
-    "CVn 9,3.310766,0.713394,6.37\n",
-    "Cae Zeta,1.255881,-0.523953,6.37\n",
-    "Leo 80,2.992512,0.067370,6.37\n",
-    "Aqr 58,5.897853,-0.190338,6.38\n",
-    "Aur 43,1.650565,0.809144,6.38\n",
-    "Cnc 54,2.317034,0.267918,6.38\n",
-    "Cnc 70,2.374368,0.486918,6.38\n",
-    "Psc 13,6.160838,-0.018951,6.38\n",
-    "UMi Lambda,4.524533,1.554002,6.38\n",
-    "Cet 9,0.099760,-0.213095,6.39\n",
-    "Cnc 39,2.269393,0.349202,6.39\n",
-    "Com 3,3.187524,0.293375,6.39\n",
-    "For Chi1,0.898539,-0.626937,6.39\n",
-    "Gem 6,1.624545,0.399826,6.39\n",
-    "UMi 20,4.243492,1.312672,6.39\n",
-    "Cet 32,0.306305,-0.155441,6.4\n",
-    "Gem 19,1.708779,0.277566,6.4\n",
-    "Gem 40,1.830261,0.452288,6.4\n",
-    "Hya 34,2.521383,-0.164488,6.4\n",
-    "Vir 17,3.239913,0.092599,6.4\n",
-    "Aql 24,5.056430,0.005920,6.41\n",
-    "Aqr 67,5.948249,-0.121523,6.41\n",
-    "Dra 20,4.434969,1.135148,6.41\n",
-    "Mon 24,1.899449,-0.002817,6.41\n",
-    "Vir 35,3.350407,0.062357,6.41\n",
-    "Vul 26,5.393671,0.451735,6.41\n",
-    "Cru Gamma,3.278070,-0.996253,6.42\n",
-    "Gem 25,1.751220,0.492120,6.42\n",
-    "Peg 39,5.901795,0.353080,6.42\n",
-    "Pic Iota,1.269458,-0.933048,6.42\n",
-    "PsA Zeta,5.894391,-0.455070,6.43\n",
-    "Tau 22,0.986322,0.428095,6.43\n",
-    "UMa 68,3.192854,0.995788,6.43\n",
-    "Leo 34,2.668768,0.233089,6.44\n",
-    "Her 34,4.320126,0.854528,6.45\n",
-    "Leo 19,2.563154,0.201906,6.45\n",
-    "Lib 23,3.985801,-0.441728,6.45\n",
-    "Lyn 7,1.721535,0.966093,6.45\n",
-    "Mon 14,1.722524,0.132165,6.45\n",
-    "Sex 13,2.636058,0.055870,6.45\n",
-    "UMi 3,3.695473,1.301904,6.45\n",
-    "Ari 36,0.716974,0.310038,6.46\n",
-    "Aur 22,1.411019,0.505040,6.46\n",
-    "Cnc 34,2.236923,0.175687,6.46\n",
-    "Gem 32,1.771087,0.221545,6.46\n",
-    "LMi 22,2.683902,0.549221,6.46\n",
-    "Leo 23,2.578869,0.228047,6.46\n",
-    "Leo 64,2.913224,0.407074,6.46\n",
-    "Peg 28,5.805416,0.366136,6.46\n",
-    "Tau 70,1.158993,0.278220,6.46\n",
-    "PsA 13,5.778778,-0.522144,6.47\n",
-    "Vir 96,3.704505,-0.180370,6.47\n",
-    "Aur Psi8,1.806198,0.672039,6.48\n",
-    "Cam 18,1.451081,0.998697,6.48\n",
-    "Cas 16,0.150164,1.165012,6.48\n",
-    "Sge Theta,5.279374,0.365040,6.48\n",
-    "Aql 57,5.212579,-0.143767,6.49\n",
-    "Aur 18,1.393616,0.593160,6.49\n",
-    "Cam 49,2.035301,1.096600,6.49\n",
-    "Cet 43,0.360323,-0.007849,6.49\n",
-    "LMi 24,2.689851,0.500604,6.49\n",
-    "Peg 61,6.090203,0.493017,6.49\n",
-    "Ari 30,0.685078,0.430180,6.5\n",
-    "Boo Mu2,4.033958,0.651842,6.5\n",
-    "Cam 14,1.367996,1.094171,6.5\n",
-    "For Chi3,0.908408,-0.625759,6.5\n",
-    "Leo 83,2.996534,0.052588,6.5\n",
-    "PsA 5,5.624600,-0.545217,6.5\n",
-    "Cnc Pi1,2.409834,0.261732,6.51\n",
-    "For Eta1,0.731126,-0.620479,6.51\n",
-    "Ser 14,4.086521,-0.009803,6.51\n",
-    "Sgr 25,4.863127,-0.422762,6.51\n",
-    "Aur 42,1.647496,0.810255,6.52\n",
-    "Her 49,4.416039,0.261349,6.52\n",
-    "Cnc 37,2.260580,0.167110,6.53\n",
-    "Dra 17,4.346895,0.923701,6.53\n",
-    "Lyn 19,1.932290,0.964896,6.53\n",
-    "Men Lambda,1.517571,-1.268893,6.53\n",
-    "Cam 29,1.529636,0.993422,6.54\n",
-    "Hya 29,2.475066,-0.160982,6.54\n",
-    "Psc 61,0.209061,0.365215,6.54\n",
-    "UMa 65,3.120191,0.811176,6.54\n",
-    "Oct Mu2,5.418062,-1.315115,6.55\n",
-    "Sgr 65,5.259724,-0.221051,6.55\n",
-    "Com 24,3.294767,0.320743,6.56\n",
-    "Com 28,3.352072,0.236545,6.56\n",
-    "Aqr 53,5.875520,-0.292192,6.57\n",
-    "Cnc Iota,2.298017,0.502049,6.57\n",
-    "Dra 65,5.246191,1.128084,6.57\n",
-    "Oph 52,4.604651,-0.384738,6.57\n",
-    "Aur 6,1.310684,0.692110,6.58\n",
-    "Cnc 35,2.248522,0.341910,6.58\n",
-    "Vir 48,3.420438,-0.063937,6.59\n",
-    "Cha Mu2,2.636000,-1.423592,6.6\n",
-    "Lib 17,3.919239,-0.194691,6.6\n",
-    "Sex 40,2.833055,-0.070235,6.61\n",
-    "Sgr 30,4.934228,-0.386804,6.61\n",
-    "Gru Pi1,5.858772,-0.801940,6.62\n",
-    "Mus Iota2,3.522533,-1.303620,6.63\n",
-    "CrB Sigma,4.252844,0.590939,6.66\n",
-    "Sex 23,2.709769,0.039963,6.66\n",
-    "Hya 17,2.336530,-0.139122,6.67\n",
-    "Her 88,4.668996,0.844638,6.68\n",
-    "Boo Kappa1,3.723929,0.903867,6.69\n",
-    "Her 61,4.465876,0.618094,6.69\n",
-    "Eri 55,1.237373,-0.153521,6.7\n",
-    "Ori Theta1,1.462971,-0.094034,6.7\n",
-    "Sex 12,2.616765,0.059075,6.7\n",
-    "Sco 25,4.393234,-0.445558,6.71\n",
-    "Ori Theta1,1.462870,-0.094025,6.73\n",
-    "Cap Omicron,5.366342,-0.324399,6.74\n",
-    "Mon 6,1.647533,-0.187191,6.75\n",
-    "Ari 52,0.809156,0.440788,6.8\n",
-    "Oph Omicron,4.529166,-0.423839,6.8\n",
-    "Aur 41,1.621447,0.850203,6.82\n",
-    "Eri 55,1.237337,-0.153477,6.82\n",
-    "Ori Delta,1.448660,-0.004964,6.85\n",
-    "Pup 2,2.031032,-0.256321,6.89\n",
-    "Hya 17,2.336523,-0.139108,6.91\n",
-    "Her 36,4.365876,0.073430,6.93\n",
-    "Ant Zeta1,2.490396,-0.556610,7\n",
-    "Ari 52,0.809156,0.440788,7\n",
-    "Psc 65,0.217643,0.483645,7\n",
-    "Cnc 24,2.210736,0.428202,7.02\n",
-    "UMa 65,3.120591,0.811050,7.03\n",
-    "Cap 31,5.577469,-0.304773,7.05\n",
-    "Ari 30,0.684874,0.430195,7.09\n",
-    "Psc 65,0.217672,0.483636,7.1\n",
-    "Psc 77,0.287354,0.085686,7.25\n",
-    "Aqr 12,5.515575,-0.101636,7.31\n",
-    "Cnc 24,2.210758,0.428221,7.81\n",
-    "Ori Theta1,1.462884,-0.093991,7.96\n",
-    0L };
+STAR( "Sirius", 1.767793, -0.291751, -1.46 )
+STAR( "Canopus", 1.675305, -0.919716, -0.72 )
+STAR( "Arcturus", 3.733528, 0.334798, -0.04 )
+STAR( "Cen Alpha1", 3.837972, -1.061776, -0.01 )
+STAR( "Vega", 4.873563, 0.676902, 0.03 )
+STAR( "Capella", 1.381821, 0.802818, 0.08 )
+STAR( "Rigel", 1.372432, -0.143146, 0.12 )
+STAR( "Procyon", 2.004082, 0.091193, 0.38 )
+STAR( "Achernar", 0.426362, -0.998968, 0.46 )
+STAR( "Betelgeuse", 1.549729, 0.129276, 0.5 )
+STAR( "Hadar (Agena)", 3.681874, -1.053709, 0.61 )
+STAR( "Altair", 5.195772, 0.154782, 0.77 )
+STAR( "Aldebaran", 1.203928, 0.288139, 0.85 )
+STAR( "Antares", 4.317101, -0.461324, 0.96 )
+STAR( "Spica", 3.513319, -0.194803, 0.98 )
+STAR( "Pollux", 2.030320, 0.489148, 1.14 )
+STAR( "Fomalhaut", 6.011139, -0.517005, 1.16 )
+STAR( "Cru Beta", 3.349810, -1.041763, 1.25 )
+STAR( "Deneb", 5.416768, 0.790290, 1.25 )
+STAR( "Cen Alpha2", 3.837986, -1.061781, 1.33 )
+STAR( "Cru Alpha1", 3.257650, -1.101288, 1.33 )
+STAR( "Regulus", 2.654522, 0.208867, 1.35 )
+STAR( "CMa Epsilon", 1.826596, -0.505661, 1.5 )
+STAR( "Cru Gamma", 3.277576, -0.996816, 1.63 )
+STAR( "Sco Lambda", 4.597234, -0.647585, 1.63 )
+STAR( "Ori Gamma", 1.418655, 0.110824, 1.64 )
+STAR( "Tau Beta", 1.423716, 0.499295, 1.65 )
+STAR( "Car Beta", 2.413790, -1.216795, 1.68 )
+STAR( "Ori Epsilon", 1.467007, -0.020978, 1.7 )
+STAR( "Cru Alpha2", 3.257693, -1.101293, 1.73 )
+STAR( "Gru Alpha", 5.795511, -0.819626, 1.74 )
+STAR( "UMa Epsilon", 3.377336, 0.976681, 1.77 )
+STAR( "Vel Gamma2", 2.135992, -0.826181, 1.78 )
+STAR( "Per Alpha", 0.891529, 0.870241, 1.79 )
+STAR( "UMa Alpha", 2.896061, 1.077755, 1.79 )
+STAR( "CMa Delta", 1.869211, -0.460651, 1.84 )
+STAR( "Sgr Epsilon", 4.817858, -0.600127, 1.85 )
+STAR( "Car Epsilon", 2.192628, -1.038641, 1.86 )
+STAR( "UMa Eta", 3.610824, 0.860680, 1.86 )
+STAR( "Sco Theta", 4.613429, -0.750453, 1.87 )
+STAR( "Aur Beta", 1.568738, 0.784482, 1.9 )
+STAR( "TrA Alpha", 4.401131, -1.204762, 1.92 )
+STAR( "Gem Gamma", 1.735345, 0.286219, 1.93 )
+STAR( "Pav Alpha", 5.347900, -0.990213, 1.94 )
+STAR( "Vel Delta", 2.289450, -0.954841, 1.96 )
+STAR( "CMa Beta", 1.669844, -0.313388, 1.98 )
+STAR( "Castor", 1.983567, 0.556556, 1.98 )
+STAR( "Hya Alpha", 2.476564, -0.151121, 1.98 )
+STAR( "Ari Alpha", 0.554898, 0.409498, 2 )
+STAR( "Polaris", 0.662404, 1.557952, 2.02 )
+STAR( "Sgr Sigma", 4.953528, -0.458963, 2.02 )
+STAR( "Cet Beta", 0.190197, -0.313927, 2.04 )
+STAR( "Ori Zeta", 1.486839, -0.033908, 2.05 )
+STAR( "And Alpha", 0.036601, 0.507726, 2.06 )
+STAR( "And Beta", 0.304262, 0.621696, 2.06 )
+STAR( "Cen Theta", 3.694353, -0.634776, 2.06 )
+STAR( "Ori Kappa", 1.517375, -0.168768, 2.06 )
+STAR( "Oph Alpha", 4.603022, 0.219213, 2.08 )
+STAR( "UMi Beta", 3.886434, 1.294259, 2.08 )
+STAR( "Gru Beta", 5.945762, -0.818293, 2.1 )
+STAR( "Algol", 0.821039, 0.714809, 2.12 )
+STAR( "Leo Beta", 3.093858, 0.254328, 2.14 )
+STAR( "Cen Gamma", 3.322743, -0.854508, 2.17 )
+STAR( "Cyg Gamma", 5.332977, 0.702611, 2.2 )
+STAR( "Vel Lambda", 2.391087, -0.758040, 2.21 )
+STAR( "Cas Alpha", 0.176751, 0.986761, 2.23 )
+STAR( "CrB Alpha", 4.078347, 0.466260, 2.23 )
+STAR( "Dra Gamma", 4.697583, 0.898651, 2.23 )
+STAR( "Ori Delta", 1.448652, -0.005221, 2.23 )
+STAR( "Car Iota", 2.430764, -1.034549, 2.25 )
+STAR( "Pup Zeta", 2.110038, -0.698190, 2.25 )
+STAR( "And Gamma1", 0.540616, 0.738793, 2.26 )
+STAR( "Cas Beta", 0.040048, 1.032357, 2.27 )
+STAR( "Mizar A", 3.507785, 0.958627, 2.27 )
+STAR( "Sco Epsilon", 4.407669, -0.598532, 2.29 )
+STAR( "Cen Epsilon", 3.577430, -0.933165, 2.3 )
+STAR( "Lup Alpha", 3.848146, -0.827082, 2.3 )
+STAR( "Cen Eta", 3.820118, -0.735792, 2.31 )
+STAR( "Sco Delta", 4.190245, -0.394823, 2.32 )
+STAR( "UMa Beta", 2.887829, 0.984060, 2.37 )
+STAR( "Peg Epsilon", 5.690588, 0.172351, 2.39 )
+STAR( "Phe Alpha", 0.114683, -0.738381, 2.39 )
+STAR( "Sco Kappa", 4.635980, -0.681202, 2.41 )
+STAR( "Peg Beta", 6.037857, 0.490137, 2.42 )
+STAR( "Oph Eta", 4.495874, -0.274448, 2.43 )
+STAR( "Cep Alpha", 5.578858, 1.092324, 2.44 )
+STAR( "UMa Gamma", 3.114671, 0.937150, 2.44 )
+STAR( "CMa Eta", 1.937730, -0.511435, 2.45 )
+STAR( "Cyg Epsilon", 5.437624, 0.592893, 2.46 )
+STAR( "Cas Gamma", 0.247437, 1.059706, 2.47 )
+STAR( "Peg Alpha", 6.042163, 0.265382, 2.49 )
+STAR( "Vel Kappa", 2.452682, -0.960120, 2.5 )
+STAR( "Cet Alpha", 0.795347, 0.071379, 2.53 )
+STAR( "Cen Zeta", 3.645731, -0.825337, 2.55 )
+STAR( "Leo Delta", 2.941352, 0.358205, 2.56 )
+STAR( "Oph Zeta", 4.350924, -0.184433, 2.56 )
+STAR( "Lep Alpha", 1.451809, -0.311056, 2.58 )
+STAR( "Crv Gamma", 3.210562, -0.306165, 2.59 )
+STAR( "Cen Delta", 3.178063, -0.885275, 2.6 )
+STAR( "Sgr Zeta", 4.985584, -0.521509, 2.6 )
+STAR( "Leo Gamma1", 2.705137, 0.346302, 2.61 )
+STAR( "Lib Beta", 4.001196, -0.163765, 2.61 )
+STAR( "Aur Theta", 1.569582, 0.649481, 2.62 )
+STAR( "Sco Beta1", 4.212512, -0.345672, 2.62 )
+STAR( "Ari Beta", 0.500211, 0.363169, 2.64 )
+STAR( "Col Alpha", 1.481995, -0.594706, 2.64 )
+STAR( "Crv Beta", 3.291633, -0.408349, 2.65 )
+STAR( "Ser Alpha", 4.120148, 0.112147, 2.65 )
+STAR( "Boo Eta", 3.642000, 0.321102, 2.68 )
+STAR( "Cas Delta", 0.374446, 1.051304, 2.68 )
+STAR( "Lup Beta", 3.920584, -0.752828, 2.68 )
+STAR( "Aur Iota", 1.295878, 0.578858, 2.69 )
+STAR( "Mus Alpha", 3.303836, -1.206643, 2.69 )
+STAR( "Sco Upsilon", 4.584820, -0.650935, 2.69 )
+STAR( "Vel Mu", 2.822067, -0.862542, 2.69 )
+STAR( "Boo Epsilon", 3.861483, 0.472533, 2.7 )
+STAR( "Pup Pi", 1.907398, -0.647474, 2.7 )
+STAR( "Sgr Delta", 4.803997, -0.520598, 2.7 )
+STAR( "Aql Gamma", 5.176036, 0.185238, 2.72 )
+STAR( "Dra Eta", 4.293474, 1.073625, 2.74 )
+STAR( "Oph Delta", 4.251382, -0.064480, 2.74 )
+STAR( "Cen Iota", 3.493262, -0.640749, 2.75 )
+STAR( "Lib Alpha2", 3.887190, -0.279980, 2.75 )
+STAR( "Car Theta", 2.805428, -1.123895, 2.76 )
+STAR( "Her Beta", 4.320650, 0.375066, 2.77 )
+STAR( "Oph Beta", 4.640278, 0.079713, 2.77 )
+STAR( "Ori Iota", 1.463604, -0.103149, 2.77 )
+STAR( "Lup Gamma", 4.080325, -0.718499, 2.78 )
+STAR( "Dra Beta", 4.583380, 0.912831, 2.79 )
+STAR( "Eri Beta", 1.343249, -0.088774, 2.79 )
+STAR( "Cru Delta", 3.207675, -1.025362, 2.8 )
+STAR( "Hyi Beta", 0.112363, -1.348340, 2.8 )
+STAR( "Her Zeta", 4.368937, 0.551577, 2.81 )
+STAR( "Pup Rho", 2.127309, -0.424188, 2.81 )
+STAR( "Sgr Lambda", 4.834431, -0.443692, 2.81 )
+STAR( "Sco Tau", 4.345361, -0.492464, 2.82 )
+STAR( "Peg Gamma", 0.057756, 0.265004, 2.83 )
+STAR( "Vir Epsilon", 3.412890, 0.191274, 2.83 )
+STAR( "Lep Beta", 1.432239, -0.362321, 2.84 )
+STAR( "Ara Beta", 4.560982, -0.969181, 2.85 )
+STAR( "Per Zeta", 1.021592, 0.556474, 2.85 )
+STAR( "TrA Beta", 4.167592, -1.107072, 2.85 )
+STAR( "Hyi Alpha", 0.518232, -1.074594, 2.86 )
+STAR( "Tuc Alpha", 5.840315, -1.051731, 2.86 )
+STAR( "Cap Delta", 5.703038, -0.281473, 2.87 )
+STAR( "Cyg Delta", 5.170429, 0.787682, 2.87 )
+STAR( "Tau Eta", 0.992591, 0.420712, 2.87 )
+STAR( "Gem Mu", 1.670978, 0.392937, 2.88 )
+STAR( "Per Epsilon", 1.037831, 0.698311, 2.89 )
+STAR( "Sco Pi", 4.183780, -0.455778, 2.89 )
+STAR( "Sco Sigma", 4.281242, -0.446678, 2.89 )
+STAR( "Sgr Pi", 5.016789, -0.366931, 2.89 )
+STAR( "TrA Gamma", 4.009501, -1.198682, 2.89 )
+STAR( "CMi Beta", 1.951060, 0.144678, 2.9 )
+STAR( "CVn Alpha2", 3.386062, 0.668781, 2.9 )
+STAR( "Aqr Beta", 5.635486, -0.097234, 2.91 )
+STAR( "Per Gamma", 0.806328, 0.933863, 2.93 )
+STAR( "Pup Tau", 1.788686, -0.883394, 2.93 )
+STAR( "Peg Eta", 5.947217, 0.527463, 2.94 )
+STAR( "Ara Alpha", 4.589525, -0.870502, 2.95 )
+STAR( "Crv Delta", 3.271903, -0.288251, 2.95 )
+STAR( "Eri Gamma", 1.038602, -0.235770, 2.95 )
+STAR( "Aqr Alpha", 5.784821, -0.005580, 2.96 )
+STAR( "Gem Epsilon", 1.762484, 0.438621, 2.98 )
+STAR( "Leo Epsilon", 2.556260, 0.414937, 2.98 )
+STAR( "Aql Zeta", 4.997794, 0.241961, 2.99 )
+STAR( "Aur Epsilon", 1.317585, 0.764861, 2.99 )
+STAR( "Sgr Gamma2", 4.737733, -0.531002, 2.99 )
+STAR( "Crv Epsilon", 3.185771, -0.394789, 3 )
+STAR( "Hya Gamma", 3.485953, -0.404422, 3 )
+STAR( "Tau Zeta", 1.473254, 0.369006, 3 )
+STAR( "Tri Beta", 0.565239, 0.610642, 3 )
+STAR( "Car Upsilon", 2.561714, -1.135720, 3.01 )
+STAR( "Gru Gamma", 5.733094, -0.652142, 3.01 )
+STAR( "Per Delta", 0.972694, 0.834049, 3.01 )
+STAR( "UMa Psi", 2.921958, 0.776647, 3.01 )
+STAR( "CMa Omicron2", 1.845795, -0.415970, 3.02 )
+STAR( "CMa Zeta", 1.659430, -0.524704, 3.02 )
+STAR( "Boo Gamma", 3.805160, 0.668607, 3.03 )
+STAR( "Sco Iota1", 4.658218, -0.700347, 3.03 )
+STAR( "Cen Mu", 3.619886, -0.741309, 3.04 )
+STAR( "Mira", 0.608007, -0.051967, 3.04 )
+STAR( "Mus Beta", 3.343535, -1.188710, 3.05 )
+STAR( "UMa Mu", 2.715420, 0.724302, 3.05 )
+STAR( "UMi Gamma", 4.017435, 1.253738, 3.05 )
+STAR( "Dra Delta", 5.028970, 1.180919, 3.07 )
+STAR( "Cap Beta", 5.327668, -0.257984, 3.08 )
+STAR( "Cyg Beta1", 5.108237, 0.487989, 3.08 )
+STAR( "Sco Mu1", 4.415116, -0.664054, 3.08 )
+STAR( "Hya Nu", 2.834524, -0.282632, 3.11 )
+STAR( "Hya Zeta", 2.336094, 0.103770, 3.11 )
+STAR( "Ind Alpha", 5.399903, -0.825390, 3.11 )
+STAR( "Sgr Eta", 4.789300, -0.641612, 3.11 )
+STAR( "Col Beta", 1.531352, -0.624275, 3.12 )
+STAR( "Ara Zeta", 4.444568, -0.977215, 3.13 )
+STAR( "Cen Kappa", 3.923333, -0.734856, 3.13 )
+STAR( "Cen Lambda", 3.035913, -1.099902, 3.13 )
+STAR( "Lyn Alpha", 2.448064, 0.600262, 3.13 )
+STAR( "Her Delta", 4.516178, 0.433525, 3.14 )
+STAR( "UMa Iota", 2.352733, 0.838485, 3.14 )
+STAR( "Her Pi", 4.516243, 0.642441, 3.16 )
+STAR( "Aur Eta", 1.337424, 0.719677, 3.17 )
+STAR( "Dra Zeta", 4.488929, 1.146938, 3.17 )
+STAR( "Pup Nu", 1.735563, -0.753914, 3.17 )
+STAR( "Sgr Phi", 4.911604, -0.471079, 3.17 )
+STAR( "UMa Theta", 2.499559, 0.901938, 3.17 )
+STAR( "Cir Alpha", 3.850662, -1.134033, 3.19 )
+STAR( "Lep Epsilon", 1.332828, -0.390450, 3.19 )
+STAR( "Ori Pi3", 1.264666, 0.121499, 3.19 )
+STAR( "Cyg Zeta", 5.554234, 0.527560, 3.2 )
+STAR( "Oph Kappa", 4.440416, 0.163625, 3.2 )
+STAR( "Cep Gamma", 6.193068, 1.354943, 3.21 )
+STAR( "Lup Delta", 4.020242, -0.709433, 3.22 )
+STAR( "Aql Theta", 5.285315, -0.014336, 3.23 )
+STAR( "Cep Beta", 5.622840, 1.231519, 3.23 )
+STAR( "Eri Theta1", 0.777813, -0.703450, 3.24 )
+STAR( "Hyi Gamma", 0.991514, -1.295713, 3.24 )
+STAR( "Lyr Gamma", 4.969578, 0.570538, 3.24 )
+STAR( "Oph Epsilon", 4.268734, -0.081900, 3.24 )
+STAR( "Pup Sigma", 1.960136, -0.755752, 3.25 )
+STAR( "Ser Eta", 4.805371, -0.050595, 3.26 )
+STAR( "And Delta", 0.171602, 0.538623, 3.27 )
+STAR( "Aqr Delta", 5.998042, -0.276126, 3.27 )
+STAR( "Dor Alpha", 1.195536, -0.960716, 3.27 )
+STAR( "Hya Pi", 3.692993, -0.465697, 3.27 )
+STAR( "Oph Theta", 4.546626, -0.436323, 3.27 )
+STAR( "Pic Alpha", 1.781065, -1.081081, 3.27 )
+STAR( "Gem Eta", 1.635708, 0.392815, 3.28 )
+STAR( "Dra Iota", 4.035768, 1.029153, 3.29 )
+STAR( "Lib Sigma", 3.944750, -0.441253, 3.29 )
+STAR( "Lep Mu", 1.365422, -0.282840, 3.31 )
+STAR( "Phe Beta", 0.288343, -0.815394, 3.31 )
+STAR( "UMa Delta", 3.208904, 0.995405, 3.31 )
+STAR( "Car Omega", 2.677931, -1.222395, 3.32 )
+STAR( "Sgr Tau", 5.004470, -0.482942, 3.32 )
+STAR( "Sco Eta", 4.503619, -0.754666, 3.33 )
+STAR( "Ara Gamma", 4.561389, -0.983973, 3.34 )
+STAR( "Leo Theta", 2.941927, 0.269295, 3.34 )
+STAR( "Oph Nu", 4.708142, -0.170582, 3.34 )
+STAR( "Pup Xi", 2.047686, -0.433884, 3.34 )
+STAR( "Cep Zeta", 5.806950, 1.015801, 3.35 )
+STAR( "Ret Alpha", 1.110138, -1.090375, 3.35 )
+STAR( "Aql Delta", 5.085446, 0.054362, 3.36 )
+STAR( "Gem Xi", 1.768411, 0.225070, 3.36 )
+STAR( "Ori Eta", 1.415797, -0.041835, 3.36 )
+STAR( "UMa Omicron", 2.226451, 1.059730, 3.36 )
+STAR( "Lup Epsilon", 4.025958, -0.779978, 3.37 )
+STAR( "Vir Zeta", 3.554770, -0.010399, 3.37 )
+STAR( "Cas Epsilon", 0.499142, 1.111251, 3.38 )
+STAR( "Hya Epsilon", 2.298497, 0.112031, 3.38 )
+STAR( "Vir Delta", 3.384208, 0.059298, 3.38 )
+STAR( "Per Rho", 0.807986, 0.677891, 3.39 )
+STAR( "Peg Zeta", 5.940497, 0.189043, 3.4 )
+STAR( "Tau Theta2", 1.172258, 0.276998, 3.4 )
+STAR( "Cen Nu", 3.619398, -0.727589, 3.41 )
+STAR( "Lup Eta", 4.189321, -0.670153, 3.41 )
+STAR( "Lup Zeta", 3.980594, -0.909302, 3.41 )
+STAR( "Phe Gamma", 0.385565, -0.756048, 3.41 )
+STAR( "Tri Alpha", 0.493412, 0.516249, 3.41 )
+STAR( "Her Mu", 4.653302, 0.483815, 3.42 )
+STAR( "Pav Beta", 5.432155, -1.155461, 3.42 )
+STAR( "Cep Eta", 5.433603, 1.079292, 3.43 )
+STAR( "Aql Lambda", 5.001452, -0.085216, 3.44 )
+STAR( "Cas Eta", 0.214239, 1.009077, 3.44 )
+STAR( "Leo Zeta", 2.690818, 0.408708, 3.44 )
+STAR( "Cet Eta", 0.299280, -0.177713, 3.45 )
+STAR( "Lyr Beta", 4.930904, 0.582290, 3.45 )
+STAR( "UMa Lambda", 2.692592, 0.748998, 3.45 )
+STAR( "Boo Delta", 3.994637, 0.581452, 3.47 )
+STAR( "CMa Sigma", 1.840093, -0.487553, 3.47 )
+STAR( "Car Chi", 2.080338, -0.924714, 3.47 )
+STAR( "Cet Gamma", 0.712531, 0.056476, 3.47 )
+STAR( "Sge Gamma", 5.230563, 0.340203, 3.47 )
+STAR( "Tau Lambda", 1.050165, 0.217996, 3.47 )
+STAR( "Her Alpha1", 4.514505, 0.251158, 3.48 )
+STAR( "Peg Mu", 5.977767, 0.429380, 3.48 )
+STAR( "UMa Nu", 2.960420, 0.577602, 3.48 )
+STAR( "Gru Epsilon", 5.971448, -0.895650, 3.49 )
+STAR( "Boo Beta", 3.935485, 0.704948, 3.5 )
+STAR( "Cet Tau", 0.454084, -0.278162, 3.5 )
+STAR( "Sgr Xi2", 4.964284, -0.368381, 3.51 )
+STAR( "Tel Alpha", 4.830082, -0.802299, 3.51 )
+STAR( "Cep Iota", 5.976356, 1.155418, 3.52 )
+STAR( "Cnc Beta", 2.166455, 0.160318, 3.52 )
+STAR( "Leo Eta", 2.649992, 0.292566, 3.52 )
+STAR( "Leo Omicron", 2.535745, 0.172652, 3.52 )
+STAR( "Gem Delta", 1.920400, 0.383662, 3.53 )
+STAR( "Her Eta", 4.375962, 0.679321, 3.53 )
+STAR( "Peg Theta", 5.804092, 0.108172, 3.53 )
+STAR( "Ser Mu", 4.143499, -0.059870, 3.53 )
+STAR( "Tau Epsilon", 1.172061, 0.334759, 3.53 )
+STAR( "Eri Delta", 0.974105, -0.170402, 3.54 )
+STAR( "Hya Xi", 3.023790, -0.556023, 3.54 )
+STAR( "Ori Lambda", 1.462317, 0.173384, 3.54 )
+STAR( "Ser Xi", 4.614592, -0.268756, 3.54 )
+STAR( "Vel Phi", 2.604308, -0.952387, 3.54 )
+STAR( "Lep Zeta", 1.513877, -0.258692, 3.55 )
+STAR( "Lup Iota", 3.749854, -0.803860, 3.55 )
+STAR( "Cet Iota", 0.084772, -0.154006, 3.56 )
+STAR( "Crt Delta", 2.964187, -0.257935, 3.56 )
+STAR( "Eri Phi", 0.595637, -0.899058, 3.56 )
+STAR( "Eri Upsilon4", 1.125279, -0.589892, 3.56 )
+STAR( "Lup Phi1", 4.022140, -0.632881, 3.56 )
+STAR( "Pav Delta", 5.274065, -1.155093, 3.56 )
+STAR( "And 51", 0.427577, 0.848725, 3.57 )
+STAR( "Cap Alpha2", 5.314768, -0.218947, 3.57 )
+STAR( "Dra Chi", 4.804266, 1.269426, 3.57 )
+STAR( "Gem Kappa", 2.026531, 0.425826, 3.57 )
+STAR( "Sco Mu2", 4.417145, -0.663531, 3.57 )
+STAR( "Boo Rho", 3.804076, 0.530081, 3.58 )
+STAR( "Gem Lambda", 1.911543, 0.288682, 3.58 )
+STAR( "Lib Upsilon", 4.088543, -0.491048, 3.58 )
+STAR( "Cru Epsilon", 3.234793, -1.054198, 3.59 )
+STAR( "Cet Theta", 0.366621, -0.142826, 3.6 )
+STAR( "Gem Theta", 1.801129, 0.592733, 3.6 )
+STAR( "Lep Gamma", 1.503005, -0.391797, 3.6 )
+STAR( "Ori Tau", 1.385821, -0.119458, 3.6 )
+STAR( "Tau Omicron", 0.893667, 0.157584, 3.6 )
+STAR( "UMa Kappa", 2.372012, 0.823039, 3.6 )
+STAR( "Vel Psi", 2.490149, -0.706277, 3.6 )
+STAR( "Hya Lambda", 2.664194, -0.215621, 3.61 )
+STAR( "Vir Beta", 3.100992, 0.030800, 3.61 )
+STAR( "And Omicron", 6.029771, 0.738730, 3.62 )
+STAR( "Ara Delta", 4.586282, -1.059134, 3.62 )
+STAR( "Mus Delta", 3.413297, -1.248764, 3.62 )
+STAR( "Pav Eta", 4.650139, -1.129645, 3.62 )
+STAR( "Psc Eta", 0.399171, 0.267835, 3.62 )
+STAR( "Sco Zeta2", 4.426955, -0.739346, 3.62 )
+STAR( "Ari 41", 0.741692, 0.475786, 3.63 )
+STAR( "Del Beta", 5.399831, 0.254736, 3.63 )
+STAR( "Tau 27", 0.999906, 0.419810, 3.63 )
+STAR( "Mus Lambda", 3.078790, -1.164634, 3.64 )
+STAR( "Dra Alpha", 3.684339, 1.123570, 3.65 )
+STAR( "Ind Beta", 5.475141, -1.020218, 3.65 )
+STAR( "Tau Gamma", 1.133562, 0.272751, 3.65 )
+STAR( "Vir Gamma", 3.323369, -0.025298, 3.65 )
+STAR( "Aqr 88", 6.062605, -0.369530, 3.66 )
+STAR( "Ara Theta", 4.741325, -0.874265, 3.66 )
+STAR( "Cas Zeta", 0.161319, 0.940679, 3.66 )
+STAR( "Lib Tau", 4.095662, -0.519720, 3.66 )
+STAR( "Ser Beta", 4.128525, 0.269164, 3.67 )
+STAR( "UMa 23", 2.493763, 1.100639, 3.67 )
+STAR( "Cap Gamma", 5.672720, -0.290811, 3.68 )
+STAR( "CrB Beta", 4.048415, 0.507993, 3.68 )
+STAR( "Pyx Alpha", 2.284600, -0.579212, 3.68 )
+STAR( "Vir Gamma", 3.323369, -0.025298, 3.68 )
+STAR( "Eri Tau4", 0.870556, -0.379745, 3.69 )
+STAR( "Ori Pi4", 1.270629, 0.097826, 3.69 )
+STAR( "Psc Gamma", 6.096282, 0.057286, 3.69 )
+STAR( "Eri Chi", 0.505964, -0.900745, 3.7 )
+STAR( "Her Xi", 4.702637, 0.510470, 3.7 )
+STAR( "Tau 17", 0.981202, 0.420857, 3.7 )
+STAR( "Aql Beta", 5.215538, 0.111817, 3.71 )
+STAR( "Lep Eta", 1.555110, -0.247274, 3.71 )
+STAR( "Ser Epsilon", 4.148720, 0.078152, 3.71 )
+STAR( "UMa Chi", 3.080724, 0.833909, 3.71 )
+STAR( "Aur Delta", 1.568731, 0.947447, 3.72 )
+STAR( "Cyg Tau", 5.562328, 0.664020, 3.72 )
+STAR( "Cyg Xi", 5.519306, 0.766684, 3.72 )
+STAR( "Ori Pi5", 1.283915, 0.042596, 3.72 )
+STAR( "Vir 109", 3.866988, 0.033035, 3.72 )
+STAR( "Cet Zeta", 0.486336, -0.180380, 3.73 )
+STAR( "Eri Epsilon", 0.929082, -0.165079, 3.73 )
+STAR( "Oph 72", 4.744459, 0.166921, 3.73 )
+STAR( "Aqr Lambda", 5.989163, -0.132291, 3.74 )
+STAR( "Cap Zeta", 5.614142, -0.391153, 3.74 )
+STAR( "Tau Xi", 0.903950, 0.169869, 3.74 )
+STAR( "Aur Zeta", 1.319811, 0.716909, 3.75 )
+STAR( "Cep Delta", 5.886872, 1.019539, 3.75 )
+STAR( "Dra Xi", 4.684151, 0.992617, 3.75 )
+STAR( "Her Gamma", 4.284434, 0.334284, 3.75 )
+STAR( "Oph Gamma", 4.659564, 0.047250, 3.75 )
+STAR( "Ara Eta", 4.406018, -1.030467, 3.76 )
+STAR( "Dor Beta", 1.455714, -1.090651, 3.76 )
+STAR( "Oct Nu", 5.678756, -1.350710, 3.76 )
+STAR( "Peg Iota", 5.790181, 0.442354, 3.76 )
+STAR( "Per Eta", 0.744805, 0.975561, 3.76 )
+STAR( "Tau Delta1", 1.147270, 0.306174, 3.76 )
+STAR( "Aqr Epsilon", 5.444016, -0.165734, 3.77 )
+STAR( "Cyg Kappa", 5.048816, 0.931458, 3.77 )
+STAR( "Del Alpha", 5.408943, 0.277716, 3.77 )
+STAR( "Lac Alpha", 5.896122, 0.877595, 3.77 )
+STAR( "Per Nu", 0.982591, 0.743137, 3.77 )
+STAR( "Sgr Omicron", 4.994623, -0.379464, 3.77 )
+STAR( "Vol Beta", 2.206692, -1.154307, 3.77 )
+STAR( "Vol Gamma2", 1.870768, -1.230438, 3.78 )
+STAR( "Cyg 31", 5.295467, 0.815791, 3.79 )
+STAR( "Cyg Iota2", 5.103801, 0.902854, 3.79 )
+STAR( "Gem Iota", 1.944849, 0.485168, 3.79 )
+STAR( "Gem Zeta", 1.850522, 0.359019, 3.79 )
+STAR( "Her Iota", 4.622788, 0.802963, 3.8 )
+STAR( "Leo Gamma2", 2.705159, 0.346283, 3.8 )
+STAR( "Per Kappa", 0.826835, 0.782906, 3.8 )
+STAR( "Ser Delta", 4.078842, 0.183914, 3.8 )
+STAR( "Ser Delta", 4.078842, 0.183943, 3.8 )
+STAR( "UMa Upsilon", 2.578680, 1.030418, 3.8 )
+STAR( "Hya Mu", 2.731833, -0.293850, 3.81 )
+STAR( "Lep Delta", 1.532930, -0.364410, 3.81 )
+STAR( "Ori Sigma", 1.478061, -0.045379, 3.81 )
+STAR( "And Lambda", 6.185294, 0.810846, 3.82 )
+STAR( "Eri Upsilon2", 1.202314, -0.533411, 3.82 )
+STAR( "Lyn 38", 2.438421, 0.642325, 3.82 )
+STAR( "Oph Lambda", 4.323675, 0.034625, 3.82 )
+STAR( "Sge Delta", 5.180959, 0.323482, 3.82 )
+STAR( "Aps Alpha", 3.874020, -1.379591, 3.83 )
+STAR( "Cen Phi", 3.657650, -0.734798, 3.83 )
+STAR( "Dra Epsilon", 5.184384, 1.226404, 3.83 )
+STAR( "Her Omicron", 4.745303, 0.502000, 3.83 )
+STAR( "LMi 46", 2.850610, 0.597164, 3.83 )
+STAR( "Per Omicron", 0.978773, 0.563538, 3.83 )
+STAR( "Aqr Gamma", 5.854082, -0.024212, 3.84 )
+STAR( "CrB Gamma", 4.113494, 0.458944, 3.84 )
+STAR( "Dra Lambda", 3.016816, 1.210056, 3.84 )
+STAR( "Her 109", 4.815792, 0.379953, 3.84 )
+STAR( "Tau Theta1", 1.171880, 0.278593, 3.84 )
+STAR( "CMa Omega", 1.897224, -0.467273, 3.85 )
+STAR( "Col Delta", 1.667284, -0.583575, 3.85 )
+STAR( "Leo Rho", 2.761162, 0.162432, 3.85 )
+STAR( "Pic Beta", 1.515317, -0.891277, 3.85 )
+STAR( "Ret Beta", 0.978257, -1.131095, 3.85 )
+STAR( "Sct Alpha", 4.866007, -0.143888, 3.85 )
+STAR( "Ser Gamma", 4.173315, 0.273348, 3.85 )
+STAR( "TrA Delta", 4.256153, -1.111523, 3.85 )
+STAR( "Cen Tau", 3.306104, -0.847202, 3.86 )
+STAR( "Her Theta", 4.696041, 0.650145, 3.86 )
+STAR( "Hor Alpha", 1.108291, -0.738177, 3.86 )
+STAR( "Sgr Mu", 4.772443, -0.367547, 3.86 )
+STAR( "And Mu", 0.247633, 0.671942, 3.87 )
+STAR( "CMa Omicron1", 1.806990, -0.422088, 3.87 )
+STAR( "Cen Upsilon1", 3.659432, -0.781971, 3.87 )
+STAR( "Col Epsilon", 1.445184, -0.619078, 3.87 )
+STAR( "Dra Kappa", 3.287691, 1.218036, 3.87 )
+STAR( "Eri 53", 1.213789, -0.249650, 3.87 )
+STAR( "For Alpha", 0.838071, -0.505918, 3.87 )
+STAR( "Lup Kappa1", 3.979067, -0.850635, 3.87 )
+STAR( "Mus Gamma", 3.283255, -1.258959, 3.87 )
+STAR( "Tau 20", 0.985355, 0.425298, 3.87 )
+STAR( "Hya Theta", 2.418874, 0.040390, 3.88 )
+STAR( "Leo Mu", 2.586418, 0.453907, 3.88 )
+STAR( "Phe Epsilon", 0.041066, -0.798444, 3.88 )
+STAR( "Sco Rho", 4.175198, -0.509883, 3.88 )
+STAR( "Vir Mu", 3.853076, -0.098757, 3.88 )
+STAR( "Aps Gamma", 4.334743, -1.377016, 3.89 )
+STAR( "Cen Pi", 2.971452, -0.951049, 3.89 )
+STAR( "Cyg Eta", 5.219873, 0.612320, 3.89 )
+STAR( "Eri Eta", 0.769814, -0.155300, 3.89 )
+STAR( "Her Tau", 4.274922, 0.808320, 3.89 )
+STAR( "Vir Eta", 3.228452, -0.011640, 3.89 )
+STAR( "Aql Eta", 5.203146, 0.017550, 3.9 )
+STAR( "Gru Iota", 6.066590, -0.789703, 3.9 )
+STAR( "Cen Sigma", 3.263940, -0.876689, 3.91 )
+STAR( "Hya Iota", 2.530102, -0.019945, 3.91 )
+STAR( "Lib Gamma", 4.082005, -0.258125, 3.91 )
+STAR( "Tau Nu", 1.060971, 0.104531, 3.91 )
+STAR( "Equ Alpha", 5.566829, 0.091591, 3.92 )
+STAR( "Her Epsilon", 4.451855, 0.539767, 3.92 )
+STAR( "Phe Zeta", 0.298386, -0.964222, 3.92 )
+STAR( "Eri Nu", 1.205666, -0.058512, 3.93 )
+STAR( "Mon Alpha", 2.012568, -0.166698, 3.93 )
+STAR( "Sgr Rho1", 5.068756, -0.311493, 3.93 )
+STAR( "Cnc Delta", 2.289370, 0.316850, 3.94 )
+STAR( "Cyg Nu", 5.485453, 0.718504, 3.94 )
+STAR( "Leo Iota", 2.984186, 0.183769, 3.94 )
+STAR( "Phe Kappa", 0.114334, -0.762360, 3.94 )
+STAR( "CMa Nu2", 1.730858, -0.336078, 3.95 )
+STAR( "Lup Chi", 4.149338, -0.586906, 3.95 )
+STAR( "Mizar B", 3.507850, 0.958564, 3.95 )
+STAR( "Peg Lambda", 5.962619, 0.411297, 3.95 )
+STAR( "Per Tau", 0.760345, 0.920879, 3.95 )
+STAR( "Phe Delta", 0.398161, -0.856482, 3.95 )
+STAR( "Vol Zeta", 2.015070, -1.267216, 3.95 )
+STAR( "CMa Kappa", 1.788272, -0.567382, 3.96 )
+STAR( "Cen Rho", 3.192433, -0.914005, 3.96 )
+STAR( "Col Eta", 1.567073, -0.747268, 3.96 )
+STAR( "Eri 43", 1.152077, -0.593708, 3.96 )
+STAR( "Pav Epsilon", 5.238569, -1.272529, 3.96 )
+STAR( "Pup 3", 2.023746, -0.505355, 3.96 )
+STAR( "Sco Omega1", 4.218490, -0.360745, 3.96 )
+STAR( "Aqr 98", 6.121611, -0.350821, 3.97 )
+STAR( "Aur Nu", 1.533664, 0.683272, 3.97 )
+STAR( "Gru Delta1", 5.887301, -0.759141, 3.97 )
+STAR( "Oph 67", 4.715203, 0.051167, 3.97 )
+STAR( "Pyx Beta", 2.269379, -0.616247, 3.97 )
+STAR( "Sgr Alpha", 5.078414, -0.708885, 3.97 )
+STAR( "Cas 50", 0.538587, 1.263992, 3.98 )
+STAR( "Cyg 32", 5.303496, 0.832774, 3.98 )
+STAR( "Mon Gamma", 1.635613, -0.109515, 3.98 )
+STAR( "Vol Delta", 1.906030, -1.186077, 3.98 )
+STAR( "Tuc Gamma", 6.097439, -1.016407, 3.99 )
+STAR( "Cet Upsilon", 0.523621, -0.367877, 4 )
+STAR( "Vol Alpha", 2.366870, -1.158831, 4 )
+STAR( "Alcor", 3.513457, 0.959723, 4.01 )
+STAR( "Aqr Tau2", 5.975971, -0.237234, 4.01 )
+STAR( "Cyg 41", 5.364248, 0.530032, 4.01 )
+STAR( "Dra Theta", 4.197030, 1.022157, 4.01 )
+STAR( "Pav Zeta", 4.900165, -1.246655, 4.01 )
+STAR( "Psc Omega", 6.280182, 0.119788, 4.01 )
+STAR( "Pyx Gamma", 2.314881, -0.483631, 4.01 )
+STAR( "Sco Nu", 4.241128, -0.339651, 4.01 )
+STAR( "Sgr Beta1", 5.072967, -0.775954, 4.01 )
+STAR( "Tri Gamma", 0.599150, 0.590745, 4.01 )
+STAR( "Aql 12", 4.981519, -0.100163, 4.02 )
+STAR( "Aql Epsilon", 4.972545, 0.262992, 4.02 )
+STAR( "Aqr Eta", 5.913859, -0.002051, 4.02 )
+STAR( "Cnc Iota", 2.298148, 0.501957, 4.02 )
+STAR( "Crv Alpha", 3.178303, -0.431601, 4.02 )
+STAR( "Cyg Rho", 5.646060, 0.795730, 4.02 )
+STAR( "Eri Mu", 1.245736, -0.056806, 4.02 )
+STAR( "Nor Gamma2", 4.275359, -0.875380, 4.02 )
+STAR( "Cam Beta", 1.323912, 1.054916, 4.03 )
+STAR( "Cru Mu1", 3.379801, -0.997940, 4.03 )
+STAR( "Del Epsilon", 5.380908, 0.197280, 4.03 )
+STAR( "Oph 70", 4.736191, 0.043624, 4.03 )
+STAR( "Vir Nu", 3.079895, 0.113960, 4.03 )
+STAR( "Cru Zeta", 3.222031, -1.117064, 4.04 )
+STAR( "Eri Omicron1", 1.098968, -0.119337, 4.04 )
+STAR( "Lyr 13", 4.953833, 0.767004, 4.04 )
+STAR( "Per 48", 1.084991, 0.832740, 4.04 )
+STAR( "Per Xi", 1.042682, 0.624673, 4.04 )
+STAR( "Boo Theta", 3.775133, 0.904968, 4.05 )
+STAR( "Cen Psi", 3.754887, -0.661223, 4.05 )
+STAR( "Leo Sigma", 2.972019, 0.105234, 4.05 )
+STAR( "Lup Lambda", 3.965577, -0.790280, 4.05 )
+STAR( "Lup Rho", 3.830503, -0.862644, 4.05 )
+STAR( "Per Iota", 0.824959, 0.865916, 4.05 )
+STAR( "And Zeta", 0.206552, 0.423543, 4.06 )
+STAR( "Ara Epsilon1", 4.448779, -0.927827, 4.06 )
+STAR( "Gem Upsilon", 1.989334, 0.469421, 4.06 )
+STAR( "Boo Upsilon", 3.619275, 0.275723, 4.07 )
+STAR( "CMa Theta", 1.807245, -0.210113, 4.07 )
+STAR( "Cap Theta", 5.523734, -0.300769, 4.07 )
+STAR( "Cet Delta", 0.695877, 0.005735, 4.07 )
+STAR( "Cha Alpha", 2.175233, -1.342502, 4.07 )
+STAR( "Cir Beta", 4.003407, -1.026273, 4.07 )
+STAR( "Ori Omicron2", 1.293165, 0.235872, 4.07 )
+STAR( "Per Phi", 0.452302, 0.884683, 4.07 )
+STAR( "Cep Mu", 5.687621, 1.025905, 4.08 )
+STAR( "Crt Alpha", 2.878812, -0.319376, 4.08 )
+STAR( "Crt Gamma", 2.988360, -0.308642, 4.08 )
+STAR( "Peg 1", 5.594158, 0.345653, 4.08 )
+STAR( "Vir Iota", 3.735070, -0.104729, 4.08 )
+STAR( "And Upsilon", 0.422355, 0.722663, 4.09 )
+STAR( "Eri Tau3", 0.795834, -0.412324, 4.09 )
+STAR( "Hyi Delta", 0.618494, -1.198333, 4.09 )
+STAR( "Ori Phi2", 1.470025, 0.162151, 4.09 )
+STAR( "Ser Kappa", 4.139659, 0.316632, 4.09 )
+STAR( "Cap Omega", 5.462102, -0.469828, 4.11 )
+STAR( "Cha Gamma", 2.772754, -1.371965, 4.11 )
+STAR( "CrA Alpha", 5.015516, -0.661557, 4.11 )
+STAR( "CrA Beta", 5.017945, -0.686627, 4.11 )
+STAR( "Eri Iota", 0.701041, -0.695611, 4.11 )
+STAR( "Gru Delta2", 5.889432, -0.763572, 4.11 )
+STAR( "Hyi Epsilon", 0.696343, -1.191483, 4.11 )
+STAR( "Mus Epsilon", 3.218249, -1.186140, 4.11 )
+STAR( "Tau 5", 0.920108, 0.225787, 4.11 )
+STAR( "TrA Epsilon", 4.087212, -1.157449, 4.11 )
+STAR( "CMa Gamma", 1.848995, -0.272853, 4.12 )
+STAR( "Gru Zeta", 6.025226, -0.920734, 4.12 )
+STAR( "Hya Upsilon1", 2.580811, -0.259123, 4.12 )
+STAR( "Ori Mu", 1.581196, 0.168381, 4.12 )
+STAR( "Per Theta", 0.716458, 0.859197, 4.12 )
+STAR( "Vir Omicron", 3.164318, 0.152421, 4.12 )
+STAR( "Lac 1", 5.829269, 0.658842, 4.13 )
+STAR( "Peg Kappa", 5.692588, 0.447590, 4.13 )
+STAR( "Psc Iota", 6.195701, 0.098199, 4.13 )
+STAR( "Sgr Iota", 5.215313, -0.730740, 4.13 )
+STAR( "Tel Zeta", 4.838191, -0.856448, 4.13 )
+STAR( "And Kappa", 6.197701, 0.773772, 4.14 )
+STAR( "Cap Psi", 5.437115, -0.441059, 4.14 )
+STAR( "CrB Theta", 4.070675, 0.547321, 4.14 )
+STAR( "Ori 29", 1.413484, -0.136276, 4.14 )
+STAR( "Per Mu", 1.112204, 0.844904, 4.14 )
+STAR( "CrB Epsilon", 4.178267, 0.469106, 4.15 )
+STAR( "Cru Eta", 3.171620, -1.127720, 4.15 )
+STAR( "Gem Nu", 1.697173, 0.352770, 4.15 )
+STAR( "Lib Theta", 4.161847, -0.291984, 4.15 )
+STAR( "Mon Delta", 1.884367, -0.008601, 4.15 )
+STAR( "Oct Beta", 5.960539, -1.420378, 4.15 )
+STAR( "Aqr Theta", 5.833036, -0.135845, 4.16 )
+STAR( "Cas Kappa", 0.143990, 1.098365, 4.16 )
+STAR( "Gem 1", 1.588773, 0.406022, 4.16 )
+STAR( "Hya Delta", 2.258703, 0.099547, 4.16 )
+STAR( "Oph 44", 4.565650, -0.421938, 4.17 )
+STAR( "PsA Epsilon", 5.936985, -0.472000, 4.17 )
+STAR( "Boo Lambda", 3.736677, 0.804393, 4.18 )
+STAR( "Gem Rho", 1.959619, 0.554743, 4.18 )
+STAR( "Tau 23", 0.987536, 0.417977, 4.18 )
+STAR( "Cen 2", 3.619137, -0.601280, 4.19 )
+STAR( "Cep Epsilon", 5.825182, 0.995599, 4.19 )
+STAR( "Her 110", 4.911626, 0.358602, 4.19 )
+STAR( "Peg Xi", 5.963325, 0.212455, 4.19 )
+STAR( "Vir Kappa", 3.721464, -0.179308, 4.19 )
+STAR( "Her Sigma", 4.337594, 0.740664, 4.2 )
+STAR( "Ori 32", 1.443322, 0.103813, 4.2 )
+STAR( "Pup 11", 2.080687, -0.399331, 4.2 )
+STAR( "Aqr Psi1", 6.090726, -0.158612, 4.21 )
+STAR( "LMi Beta", 2.739658, 0.640662, 4.21 )
+STAR( "Ori Zeta", 1.486846, -0.033908, 4.21 )
+STAR( "PsA Delta", 6.003707, -0.567925, 4.21 )
+STAR( "Aqr Phi", 6.083883, -0.105573, 4.22 )
+STAR( "Cep Theta", 5.365062, 1.099456, 4.22 )
+STAR( "Cyg 52", 5.435224, 0.536160, 4.22 )
+STAR( "Dra Phi", 4.802964, 1.245079, 4.22 )
+STAR( "Pav Gamma", 5.613168, -1.140854, 4.22 )
+STAR( "Pav Lambda", 4.940227, -1.085377, 4.22 )
+STAR( "Sct Beta", 4.918229, -0.082864, 4.22 )
+STAR( "Tau Kappa1", 1.157888, 0.389102, 4.22 )
+STAR( "Cen 1", 3.602738, -0.576725, 4.23 )
+STAR( "Cyg Chi", 5.194820, 0.574461, 4.23 )
+STAR( "Cyg Pi2", 5.701962, 0.860612, 4.23 )
+STAR( "Cyg Sigma", 5.573782, 0.687568, 4.23 )
+STAR( "Eri Tau6", 0.989813, -0.405784, 4.23 )
+STAR( "Lup Theta", 4.217552, -0.642320, 4.23 )
+STAR( "Per 16", 0.744317, 0.668786, 4.23 )
+STAR( "Per Psi", 0.944616, 0.841123, 4.23 )
+STAR( "Tuc Zeta", 0.087579, -1.132278, 4.23 )
+STAR( "UMi Epsilon", 4.389365, 1.431820, 4.23 )
+STAR( "Aps Beta", 4.376748, -1.352936, 4.24 )
+STAR( "Cap Alpha1", 5.312993, -0.218312, 4.24 )
+STAR( "And Phi", 0.303266, 0.824527, 4.25 )
+STAR( "Ant Alpha", 2.736465, -0.542235, 4.25 )
+STAR( "Cet Pi", 0.716123, -0.241878, 4.25 )
+STAR( "Cnc Alpha", 2.349591, 0.206957, 4.25 )
+STAR( "Dor Gamma", 1.117127, -0.898612, 4.25 )
+STAR( "Eri Kappa", 0.641343, -0.832590, 4.25 )
+STAR( "Lyn 31", 2.194032, 0.753774, 4.25 )
+STAR( "Per 58", 1.207288, 0.720205, 4.25 )
+STAR( "Tau 88", 1.202772, 0.177340, 4.25 )
+STAR( "UMi 5", 3.785292, 1.321146, 4.25 )
+STAR( "Aur Pi", 1.570513, 0.801751, 4.26 )
+STAR( "CVn Beta", 3.288818, 0.721825, 4.26 )
+STAR( "Cha Beta", 3.221638, -1.384259, 4.26 )
+STAR( "Com Beta", 3.455199, 0.486564, 4.26 )
+STAR( "Her Phi", 4.227057, 0.784264, 4.26 )
+STAR( "Psc Omicron", 0.459865, 0.159833, 4.26 )
+STAR( "Ser Omicron", 4.631297, -0.224716, 4.26 )
+STAR( "Vir Tau", 3.672376, 0.026956, 4.26 )
+STAR( "Aqr Iota", 5.787672, -0.242072, 4.27 )
+STAR( "Cen Xi2", 3.433543, -0.871026, 4.27 )
+STAR( "Cet Mu", 0.719694, 0.176526, 4.27 )
+STAR( "Del Gamma2", 5.439573, 0.281420, 4.27 )
+STAR( "Eri Lambda", 1.348907, -0.152789, 4.27 )
+STAR( "Eri Tau5", 0.932828, -0.377563, 4.27 )
+STAR( "Lup Mu", 4.007858, -0.835576, 4.27 )
+STAR( "Tau 90", 1.213695, 0.218355, 4.27 )
+STAR( "Vel Gamma1", 2.135796, -0.826341, 4.27 )
+STAR( "Cap Iota", 5.594857, -0.293816, 4.28 )
+STAR( "Cet Xi2", 0.646463, 0.147655, 4.28 )
+STAR( "Gem Sigma", 2.021579, 0.504114, 4.28 )
+STAR( "Gru Theta", 6.051406, -0.759577, 4.28 )
+STAR( "Hya Beta", 3.110657, -0.591807, 4.28 )
+STAR( "Oph Phi", 4.324657, -0.289948, 4.28 )
+STAR( "Psc Epsilon", 0.274642, 0.137706, 4.28 )
+STAR( "Psc Theta", 6.143421, 0.111333, 4.28 )
+STAR( "Tau 10", 0.946288, 0.007010, 4.28 )
+STAR( "Tau Tau", 1.231526, 0.400674, 4.28 )
+STAR( "Tau Upsilon", 1.161989, 0.398173, 4.28 )
+STAR( "And Iota", 6.187789, 0.755170, 4.29 )
+STAR( "Cam Alpha", 1.283035, 1.157900, 4.29 )
+STAR( "Cep Nu", 5.696093, 1.066760, 4.29 )
+STAR( "Cep Xi", 5.776124, 1.127968, 4.29 )
+STAR( "Lep Lambda", 1.394409, -0.229976, 4.29 )
+STAR( "Oph 45", 4.569948, -0.521277, 4.29 )
+STAR( "Peg Pi2", 5.803162, 0.579071, 4.29 )
+STAR( "Per Lambda", 1.075923, 0.878798, 4.29 )
+STAR( "PsA Beta", 5.897053, -0.564546, 4.29 )
+STAR( "Sgr Beta2", 5.075505, -0.781903, 4.29 )
+STAR( "Tau Delta3", 1.158419, 0.312904, 4.29 )
+STAR( "Tau Mu", 1.114982, 0.155199, 4.29 )
+STAR( "Cyg 33", 5.294449, 0.987294, 4.3 )
+STAR( "Hya Eta", 2.283000, 0.059317, 4.3 )
+STAR( "Leo Upsilon", 3.041011, -0.014380, 4.3 )
+STAR( "Lyr Delta2", 4.950205, 0.644007, 4.3 )
+STAR( "Tau 19", 0.982657, 0.427034, 4.3 )
+STAR( "Boo Mu1", 4.033849, 0.652356, 4.31 )
+STAR( "Crv Eta", 3.281524, -0.282675, 4.31 )
+STAR( "Leo Lambda", 2.494599, 0.400868, 4.31 )
+STAR( "Scl Alpha", 0.255720, -0.512385, 4.31 )
+STAR( "Aql 71", 5.403270, -0.019291, 4.32 )
+STAR( "CMi Gamma", 1.955481, 0.155780, 4.32 )
+STAR( "Eri 54", 1.223658, -0.343335, 4.32 )
+STAR( "Hya 12", 2.296744, -0.236453, 4.32 )
+STAR( "Lup Omicron", 3.890513, -0.760537, 4.32 )
+STAR( "Oct Delta", 3.782630, -1.460278, 4.32 )
+STAR( "Sco Omega2", 4.221101, -0.364226, 4.32 )
+STAR( "UMi Zeta", 4.119232, 1.357769, 4.32 )
+STAR( "CMa Xi1", 1.709790, -0.408727, 4.33 )
+STAR( "Cas Theta", 0.310247, 0.962544, 4.33 )
+STAR( "Cru Theta1", 3.154792, -1.105016, 4.33 )
+STAR( "Lup Omega", 4.093030, -0.742943, 4.33 )
+STAR( "Lyr Kappa", 4.799052, 0.629443, 4.33 )
+STAR( "Psc Alpha", 0.532529, 0.048234, 4.33 )
+STAR( "Ser Nu", 4.541470, -0.224221, 4.33 )
+STAR( "Cen Upsilon2", 3.672711, -0.795933, 4.34 )
+STAR( "Lup 2", 4.004796, -0.526197, 4.34 )
+STAR( "Mon Zeta", 2.131891, -0.052079, 4.34 )
+STAR( "Oph Sigma", 4.566283, 0.072261, 4.34 )
+STAR( "Peg 9", 5.692006, 0.302815, 4.34 )
+STAR( "PsA Iota", 5.693904, -0.576410, 4.34 )
+STAR( "Ari Delta", 0.836144, 0.344295, 4.35 )
+STAR( "Aur Kappa", 1.637897, 0.514838, 4.35 )
+STAR( "Cha Theta", 2.184461, -1.352359, 4.35 )
+STAR( "Dor Delta", 1.504357, -1.147302, 4.35 )
+STAR( "Eri Theta2", 0.777857, -0.703445, 4.35 )
+STAR( "Lup Tau2", 3.779423, -0.792021, 4.35 )
+STAR( "Lyn 15", 1.820706, 1.019665, 4.35 )
+STAR( "Pav Pi", 4.749826, -1.111222, 4.35 )
+STAR( "Vol Epsilon", 2.128996, -1.197596, 4.35 )
+STAR( "And Pi", 0.160927, 0.588515, 4.36 )
+STAR( "Aql Iota", 5.134417, -0.022452, 4.36 )
+STAR( "Cen Chi", 3.691575, -0.718722, 4.36 )
+STAR( "Col Gamma", 1.560048, -0.615810, 4.36 )
+STAR( "Com Gamma", 3.259133, 0.493375, 4.36 )
+STAR( "Her 102", 4.750604, 0.363281, 4.36 )
+STAR( "Her 111", 4.917560, 0.317325, 4.36 )
+STAR( "Hya Rho", 2.305725, 0.101888, 4.36 )
+STAR( "Lac 5", 5.888435, 0.832643, 4.36 )
+STAR( "Lep Kappa", 1.366731, -0.225870, 4.36 )
+STAR( "Lyr Theta", 5.045609, 0.665557, 4.36 )
+STAR( "Lyr Zeta1", 4.907750, 0.656331, 4.36 )
+STAR( "Ori Pi2", 1.268033, 0.155339, 4.36 )
+STAR( "Pav Xi", 4.813734, -1.073271, 4.36 )
+STAR( "Per Sigma", 0.918807, 0.837676, 4.36 )
+STAR( "Phe Eta", 0.189165, -1.002920, 4.36 )
+STAR( "Tau 37", 1.067683, 0.385403, 4.36 )
+STAR( "UMi Delta", 4.591154, 1.511218, 4.36 )
+STAR( "And Epsilon", 0.168228, 0.511585, 4.37 )
+STAR( "CMa Iota", 1.815739, -0.297651, 4.37 )
+STAR( "Cet Xi1", 0.580322, 0.154403, 4.37 )
+STAR( "Col Kappa", 1.643017, -0.613318, 4.37 )
+STAR( "Leo 31", 2.652486, 0.174489, 4.37 )
+STAR( "Scl Beta", 6.165252, -0.660054, 4.37 )
+STAR( "Sge Alpha", 5.149143, 0.314402, 4.37 )
+STAR( "Sge Beta", 5.153296, 0.305016, 4.37 )
+STAR( "Sgr Theta1", 5.234839, -0.615689, 4.37 )
+STAR( "Tuc Beta1", 0.137641, -1.098825, 4.37 )
+STAR( "Oph Iota", 4.424446, 0.177418, 4.38 )
+STAR( "Tau 119", 1.449554, 0.324534, 4.38 )
+STAR( "Vir Theta", 3.446807, -0.096672, 4.38 )
+STAR( "Aqr 99", 6.135036, -0.360270, 4.39 )
+STAR( "Aqr Psi2", 6.099504, -0.160265, 4.39 )
+STAR( "Cep Kappa", 5.274770, 1.356320, 4.39 )
+STAR( "Eri Omega", 1.277996, -0.095169, 4.39 )
+STAR( "Ind Theta", 5.584472, -0.932874, 4.39 )
+STAR( "Lyr Eta", 5.034220, 0.683229, 4.39 )
+STAR( "Oph Xi", 4.542234, -0.368487, 4.39 )
+STAR( "CMa Tau", 1.914219, -0.435532, 4.4 )
+STAR( "Ind Delta", 5.750504, -0.959800, 4.4 )
+STAR( "Peg Upsilon", 6.132127, 0.408480, 4.4 )
+STAR( "Pup 16", 2.133781, -0.335889, 4.4 )
+STAR( "Vir 110", 3.939644, 0.036502, 4.4 )
+STAR( "Cep Pi", 6.055849, 1.315760, 4.41 )
+STAR( "Gem Tau", 1.881203, 0.527880, 4.41 )
+STAR( "Her Lambda", 4.584711, 0.455715, 4.41 )
+STAR( "Her Nu", 4.705859, 0.526905, 4.41 )
+STAR( "Hya 58", 3.884616, -0.487999, 4.41 )
+STAR( "Ori Chi1", 1.546282, 0.353885, 4.41 )
+STAR( "Ori Phi1", 1.460928, 0.165622, 4.41 )
+STAR( "Phe Psi", 0.495877, -0.808131, 4.41 )
+STAR( "Psc 30", 0.008552, -0.104967, 4.41 )
+STAR( "Scl Gamma", 6.103518, -0.567790, 4.41 )
+STAR( "UMa Xi", 2.959133, 0.550288, 4.41 )
+STAR( "And Eta", 0.249611, 0.408712, 4.42 )
+STAR( "Aqr 3", 5.444278, -0.087751, 4.42 )
+STAR( "Aqr Zeta2", 5.885403, -0.000349, 4.42 )
+STAR( "Eri Pi", 0.986729, -0.211214, 4.42 )
+STAR( "Leo 60", 2.889960, 0.352203, 4.42 )
+STAR( "Lup Sigma", 3.807501, -0.880640, 4.42 )
+STAR( "Oph Chi", 4.306702, -0.322125, 4.42 )
+STAR( "Ori Nu", 1.603834, 0.257756, 4.42 )
+STAR( "Boo Zeta", 3.844735, 0.239605, 4.43 )
+STAR( "CMa Nu3", 1.736123, -0.318304, 4.43 )
+STAR( "Cyg 39", 5.340104, 0.561821, 4.43 )
+STAR( "Cyg Upsilon", 5.575971, 0.609067, 4.43 )
+STAR( "Del Delta", 5.425611, 0.263099, 4.43 )
+STAR( "Eri Omicron2", 1.113833, -0.133566, 4.43 )
+STAR( "Lac Beta", 5.862386, 0.911571, 4.43 )
+STAR( "Psc Delta", 0.212421, 0.132383, 4.43 )
+STAR( "Ser Lambda", 4.129638, 0.128335, 4.43 )
+STAR( "Cet 7", 0.063879, -0.330439, 4.44 )
+STAR( "Hya Sigma", 2.263503, 0.058318, 4.44 )
+STAR( "Mon Epsilon", 1.674505, 0.080159, 4.44 )
+STAR( "Pav Kappa", 4.960880, -1.173448, 4.44 )
+STAR( "Psc Nu", 0.442579, 0.095775, 4.44 )
+STAR( "Ret Epsilon", 1.119112, -1.035014, 4.44 )
+STAR( "Vul Alpha", 5.099438, 0.430485, 4.44 )
+STAR( "Aql Mu", 5.122934, 0.128786, 4.45 )
+STAR( "Cae Alpha", 1.224181, -0.730663, 4.45 )
+STAR( "Cha Delta2", 2.817747, -1.405693, 4.45 )
+STAR( "Dra Tau", 5.042038, 1.280296, 4.45 )
+STAR( "Lep Iota", 1.362659, -0.207156, 4.45 )
+STAR( "Oph 68", 4.720039, 0.022781, 4.45 )
+STAR( "Oph Omega", 4.329013, -0.374659, 4.45 )
+STAR( "Boo Sigma", 3.816511, 0.519148, 4.46 )
+STAR( "For Beta", 0.737794, -0.565588, 4.46 )
+STAR( "Gru Lambda", 5.786268, -0.690161, 4.46 )
+STAR( "Lac 11", 5.936367, 0.772769, 4.46 )
+STAR( "Leo Kappa", 2.463772, 0.456966, 4.46 )
+STAR( "Ori Rho", 1.366993, 0.049936, 4.46 )
+STAR( "PsA Gamma", 5.988777, -0.573787, 4.46 )
+STAR( "Aqr 86", 6.050540, -0.414394, 4.47 )
+STAR( "Cam 7", 1.297158, 0.938153, 4.47 )
+STAR( "Eri Tau1", 0.720399, -0.324151, 4.47 )
+STAR( "Leo Phi", 2.952494, -0.063734, 4.47 )
+STAR( "Mon 18", 1.779625, 0.042101, 4.47 )
+STAR( "Nor Epsilon", 4.307407, -0.829991, 4.47 )
+STAR( "Ori Pi6", 1.302663, 0.029918, 4.47 )
+STAR( "CMa Lambda", 1.693704, -0.568628, 4.48 )
+STAR( "Crt Beta", 2.930662, -0.398386, 4.48 )
+STAR( "Cyg Theta", 5.133195, 0.876524, 4.48 )
+STAR( "LMi 21", 2.650413, 0.615136, 4.48 )
+STAR( "Lyn 2", 1.656419, 1.029933, 4.48 )
+STAR( "Ori Xi", 1.622894, 0.247992, 4.48 )
+STAR( "Tuc Delta", 5.878851, -1.133877, 4.48 )
+STAR( "UMa 15", 2.394904, 0.900672, 4.48 )
+STAR( "Aqr Omega2", 6.207794, -0.253858, 4.49 )
+STAR( "Equ Delta", 5.560975, 0.174654, 4.49 )
+STAR( "Gem 30", 1.762732, 0.230868, 4.49 )
+STAR( "Lib 16", 3.914701, -0.075859, 4.49 )
+STAR( "Sex Alpha", 2.652631, -0.006487, 4.49 )
+STAR( "Tau 71", 1.162157, 0.272591, 4.49 )
+STAR( "Boo Tau", 3.609610, 0.304676, 4.5 )
+STAR( "Cap 24", 5.528890, -0.436434, 4.5 )
+STAR( "Leo 54", 2.860653, 0.431964, 4.5 )
+STAR( "Mon 13", 1.714364, 0.127986, 4.5 )
+STAR( "Oph Psi", 4.293961, -0.349720, 4.5 )
+STAR( "PsA Mu", 5.796166, -0.575760, 4.5 )
+STAR( "Psc Lambda", 6.204849, 0.031067, 4.5 )
+STAR( "Pup Omicron", 2.042413, -0.452690, 4.5 )
+STAR( "Tuc Epsilon", 6.282822, -1.144538, 4.5 )
+STAR( "UMa 26", 2.508147, 0.908468, 4.5 )
+STAR( "Ant Epsilon", 2.483800, -0.627470, 4.51 )
+STAR( "Aqr Nu", 5.539653, -0.198473, 4.51 )
+STAR( "Ari 39", 0.732638, 0.510460, 4.51 )
+STAR( "Cap 36", 5.623116, -0.380608, 4.51 )
+STAR( "Cir Gamma", 4.028998, -1.035344, 4.51 )
+STAR( "Dra Rho", 5.248285, 1.184618, 4.51 )
+STAR( "Eri Upsilon1", 1.193413, -0.519526, 4.51 )
+STAR( "Ind Eta", 5.428141, -0.906194, 4.51 )
+STAR( "Lac 6", 5.892617, 0.752644, 4.51 )
+STAR( "Pic Gamma", 1.526414, -0.980293, 4.51 )
+STAR( "Psc Tau", 0.312676, 0.525165, 4.51 )
+STAR( "Ret Gamma", 1.051110, -1.084887, 4.51 )
+STAR( "And 7", 6.076146, 0.862304, 4.52 )
+STAR( "And Sigma", 0.079972, 0.642024, 4.52 )
+STAR( "Aur Tau", 1.523563, 0.683839, 4.52 )
+STAR( "Cas Iota", 0.650426, 1.176396, 4.52 )
+STAR( "Her Rho", 4.553928, 0.648317, 4.52 )
+STAR( "Peg 55", 6.051951, 0.164226, 4.52 )
+STAR( "Ser Iota", 4.108294, 0.343311, 4.52 )
+STAR( "Sgr 59", 5.222665, -0.474206, 4.52 )
+STAR( "Vir Lambda", 3.748575, -0.233370, 4.52 )
+STAR( "Vul 23", 5.304790, 0.485449, 4.52 )
+STAR( "And Nu", 0.217352, 0.716962, 4.53 )
+STAR( "Cyg Lambda", 5.442846, 0.636885, 4.53 )
+STAR( "Leo 93", 3.089167, 0.352886, 4.53 )
+STAR( "Per 17", 0.748368, 0.611908, 4.53 )
+STAR( "Psc Beta", 6.038301, 0.066672, 4.53 )
+STAR( "Tel Epsilon", 4.761389, -0.802056, 4.53 )
+STAR( "Aur 16", 1.388315, 0.582445, 4.54 )
+STAR( "Boo Kappa2", 3.724024, 0.903911, 4.54 )
+STAR( "Boo Psi", 3.946386, 0.470323, 4.54 )
+STAR( "CMa Xi2", 1.723760, -0.400810, 4.54 )
+STAR( "CMi 6", 1.962608, 0.209556, 4.54 )
+STAR( "Cas 48", 0.532136, 1.237560, 4.54 )
+STAR( "Cas Omicron", 0.195150, 0.842723, 4.54 )
+STAR( "Cas Rho", 6.258678, 1.003555, 4.54 )
+STAR( "Lib Iota1", 3.980318, -0.345430, 4.54 )
+STAR( "Lup Phi2", 4.028031, -0.643304, 4.54 )
+STAR( "Sgr 3", 4.658109, -0.485740, 4.54 )
+STAR( "Tuc Beta2", 0.137706, -1.098961, 4.54 )
+STAR( "Boo Xi", 3.889415, 0.333377, 4.55 )
+STAR( "Cae Gamma1", 1.328225, -0.619301, 4.55 )
+STAR( "Cet 2", 0.016319, -0.302572, 4.55 )
+STAR( "Cyg 63", 5.526592, 0.831620, 4.55 )
+STAR( "LMi 10", 2.505522, 0.635256, 4.55 )
+STAR( "Peg 70", 6.148599, 0.222714, 4.55 )
+STAR( "Sco Omicron", 4.278835, -0.421836, 4.55 )
+STAR( "Cen 3", 3.629529, -0.575862, 4.56 )
+STAR( "Cep 11", 5.680705, 1.244619, 4.56 )
+STAR( "Lup Tau1", 3.779234, -0.789262, 4.56 )
+STAR( "Ret Delta", 1.041722, -1.071637, 4.56 )
+STAR( "UMa 24", 2.506649, 1.218768, 4.56 )
+STAR( "Her Omega", 4.299691, 0.244928, 4.57 )
+STAR( "Hya Tau2", 2.495741, -0.020682, 4.57 )
+STAR( "Lac 2", 5.851333, 0.812218, 4.57 )
+STAR( "Lac 4", 5.866561, 0.863526, 4.57 )
+STAR( "Ori Omega", 1.479974, 0.071932, 4.57 )
+STAR( "Peg 2", 5.628461, 0.412576, 4.57 )
+STAR( "Scl Delta", 6.234869, -0.490966, 4.57 )
+STAR( "Dra Psi1", 4.633580, 1.259236, 4.58 )
+STAR( "Pyx Kappa", 2.391312, -0.451313, 4.58 )
+STAR( "Sgr 62", 5.247587, -0.483626, 4.58 )
+STAR( "Tau 136", 1.541678, 0.481924, 4.58 )
+STAR( "Vul 13", 5.207459, 0.420270, 4.58 )
+STAR( "Aqr Zeta1", 5.885374, -0.000354, 4.59 )
+STAR( "Ara Sigma", 4.606186, -0.811675, 4.59 )
+STAR( "CrA Delta", 5.010615, -0.706800, 4.59 )
+STAR( "Dra Pi", 5.064371, 1.146938, 4.59 )
+STAR( "Her 113", 4.951274, 0.395230, 4.59 )
+STAR( "Ori 42", 1.463400, -0.084445, 4.59 )
+STAR( "Ori Psi2", 1.426094, 0.054028, 4.59 )
+STAR( "Phe Mu", 0.180322, -0.804335, 4.59 )
+STAR( "Pup 1", 2.022575, -0.495867, 4.59 )
+STAR( "Sco 13", 4.242474, -0.487407, 4.59 )
+STAR( "Sco 2", 4.160916, -0.442043, 4.59 )
+STAR( "UMa Phi", 2.583553, 0.943603, 4.59 )
+STAR( "Vul 31", 5.463441, 0.472931, 4.59 )
+STAR( "Ant Iota", 2.865474, -0.648176, 4.6 )
+STAR( "Boo Omicron", 3.862595, 0.296085, 4.6 )
+STAR( "Hya Tau1", 2.483378, -0.048326, 4.6 )
+STAR( "Hya Upsilon2", 2.640356, -0.228022, 4.6 )
+STAR( "Mon Beta", 1.696533, -0.122745, 4.6 )
+STAR( "Peg Tau", 6.111430, 0.414346, 4.6 )
+STAR( "Sgr 52", 5.134351, -0.434301, 4.6 )
+STAR( "UMa Pi2", 2.269859, 1.122732, 4.6 )
+STAR( "And Theta", 0.074576, 0.675122, 4.61 )
+STAR( "Cyg 47", 5.383919, 0.615243, 4.61 )
+STAR( "Psc 33", 0.023278, -0.099615, 4.61 )
+STAR( "Sgr Upsilon", 5.068989, -0.278467, 4.61 )
+STAR( "Cru Lambda", 3.380063, -1.032304, 4.62 )
+STAR( "Her Chi", 4.156829, 0.740921, 4.62 )
+STAR( "Lib 37", 4.076122, -0.175658, 4.62 )
+STAR( "Oph Mu", 4.615720, -0.141701, 4.62 )
+STAR( "Ori Upsilon", 1.448318, -0.127433, 4.62 )
+STAR( "Psc Xi", 0.495477, 0.055632, 4.62 )
+STAR( "Ser Theta1", 4.957695, 0.073367, 4.62 )
+STAR( "Ser Zeta", 4.714498, -0.064407, 4.62 )
+STAR( "Ari Epsilon", 0.781958, 0.372458, 4.63 )
+STAR( "Cam Gamma", 1.005128, 1.244982, 4.63 )
+STAR( "Cas Upsilon2", 0.247240, 1.032905, 4.63 )
+STAR( "CrB Delta", 4.143390, 0.454978, 4.63 )
+STAR( "Lac 9", 5.922658, 0.899635, 4.63 )
+STAR( "Leo 72", 2.946130, 0.403093, 4.63 )
+STAR( "Leo Chi", 2.901683, 0.128039, 4.63 )
+STAR( "Nor Iota1", 4.204200, -1.008369, 4.63 )
+STAR( "Oph Upsilon", 4.310098, -0.146113, 4.63 )
+STAR( "Ori Chi2", 1.587901, 0.351480, 4.63 )
+STAR( "Per Omega", 0.834660, 0.691354, 4.63 )
+STAR( "CrA Theta", 4.858575, -0.738492, 4.64 )
+STAR( "Lyn 21", 1.949155, 0.858901, 4.64 )
+STAR( "Oph 66", 4.713538, 0.076247, 4.64 )
+STAR( "Oph 71", 4.744270, 0.152435, 4.64 )
+STAR( "Pav Nu", 4.849281, -1.086962, 4.64 )
+STAR( "Sco 1", 4.149426, -0.449447, 4.64 )
+STAR( "Tau Iota", 1.322501, 0.376817, 4.64 )
+STAR( "Vul 15", 5.240795, 0.484392, 4.64 )
+STAR( "And 3", 6.039639, 0.873576, 4.65 )
+STAR( "Dra 10", 3.627805, 1.129635, 4.65 )
+STAR( "Eri Tau8", 1.019752, -0.429569, 4.65 )
+STAR( "Gem 38", 1.809230, 0.229996, 4.65 )
+STAR( "Her 69", 4.527697, 0.650862, 4.65 )
+STAR( "Nor Eta", 4.202818, -0.859221, 4.65 )
+STAR( "Oph 20", 4.406229, -0.188200, 4.65 )
+STAR( "Ori Pi1", 1.286729, 0.177165, 4.65 )
+STAR( "Psc Phi", 0.321788, 0.429065, 4.65 )
+STAR( "Tau Rho", 1.194889, 0.259084, 4.65 )
+STAR( "Aql Nu", 5.089896, 0.005910, 4.66 )
+STAR( "Aqr Pi", 5.869877, 0.024042, 4.66 )
+STAR( "Ari 35", 0.713192, 0.483582, 4.66 )
+STAR( "CMa 27", 1.894788, -0.459938, 4.66 )
+STAR( "Cnc Gamma", 2.283262, 0.374698, 4.66 )
+STAR( "Dra Omicron", 4.935798, 1.036522, 4.66 )
+STAR( "Eri Tau9", 1.046870, -0.419165, 4.66 )
+STAR( "Mon 15", 1.749598, 0.172710, 4.66 )
+STAR( "Peg Psi", 6.273404, 0.438800, 4.66 )
+STAR( "Psc Chi", 0.311774, 0.367125, 4.66 )
+STAR( "UMa 83", 3.581147, 0.954375, 4.66 )
+STAR( "Vir Chi", 3.312839, -0.139549, 4.66 )
+STAR( "Vir Pi", 3.145403, 0.115439, 4.66 )
+STAR( "Cet Chi", 0.478155, -0.186513, 4.67 )
+STAR( "Cyg Pi1", 5.681461, 0.893429, 4.67 )
+STAR( "Her 93", 4.712636, 0.292357, 4.67 )
+STAR( "Lep Theta", 1.597653, -0.260670, 4.67 )
+STAR( "Lup Psi1", 4.100506, -0.600602, 4.67 )
+STAR( "Mic Gamma", 5.503423, -0.563004, 4.67 )
+STAR( "Per 34", 0.913542, 0.864093, 4.67 )
+STAR( "UMa Tau", 2.403835, 1.108522, 4.67 )
+STAR( "Aps Delta1", 4.277569, -1.373501, 4.68 )
+STAR( "CMa Pi", 1.813499, -0.351446, 4.68 )
+STAR( "Cap Epsilon", 5.659579, -0.339748, 4.68 )
+STAR( "Del Zeta", 5.390049, 0.256113, 4.68 )
+STAR( "Dra Sigma", 5.115386, 1.215816, 4.68 )
+STAR( "Mon 28", 2.099726, -0.024304, 4.68 )
+STAR( "Ori 11", 1.328930, 0.268853, 4.68 )
+STAR( "Sct Zeta", 4.815618, -0.155931, 4.68 )
+STAR( "Aqr 66", 5.949777, -0.328650, 4.69 )
+STAR( "Aqr 89", 6.064641, -0.391957, 4.69 )
+STAR( "Aqr Omicron", 5.774051, -0.037617, 4.69 )
+STAR( "Aqr Xi", 5.662510, -0.137081, 4.69 )
+STAR( "Cru Iota", 3.340698, -1.064321, 4.69 )
+STAR( "Cyg Phi", 5.146001, 0.526275, 4.69 )
+STAR( "Equ Gamma", 5.542911, 0.176831, 4.69 )
+STAR( "For Nu", 0.543190, -0.511328, 4.69 )
+STAR( "Hyi Eta2", 0.501499, -1.180667, 4.69 )
+STAR( "Ind Epsilon", 5.774247, -0.991105, 4.69 )
+STAR( "Pyx Lambda", 2.457445, -0.503246, 4.69 )
+STAR( "Sgr Gamma1", 4.734300, -0.516268, 4.69 )
+STAR( "Tau Pi", 1.163291, 0.256801, 4.69 )
+STAR( "Tau Sigma2", 1.218567, 0.277822, 4.69 )
+STAR( "Vir 74", 3.542866, -0.109185, 4.69 )
+STAR( "CVn 24", 3.553730, 0.855493, 4.7 )
+STAR( "Cet Lambda", 0.784155, 0.155465, 4.7 )
+STAR( "Crt Theta", 3.039847, -0.171081, 4.7 )
+STAR( "Hya Omicron", 3.055257, -0.606410, 4.7 )
+STAR( "Leo Pi", 2.618925, 0.140397, 4.7 )
+STAR( "Per Pi", 0.779995, 0.692246, 4.7 )
+STAR( "Sct Gamma", 4.839791, -0.254222, 4.7 )
+STAR( "Sgr Omega", 5.217836, -0.459012, 4.7 )
+STAR( "And 65", 0.635402, 0.877527, 4.71 )
+STAR( "Aql Xi", 5.210891, 0.147679, 4.71 )
+STAR( "Aqr 101", 6.166583, -0.365026, 4.71 )
+STAR( "Aur Lambda", 1.392518, 0.699862, 4.71 )
+STAR( "Cas Chi", 0.409854, 1.033792, 4.71 )
+STAR( "LMi 37", 2.786942, 0.558088, 4.71 )
+STAR( "Mic Epsilon", 5.576058, -0.561516, 4.71 )
+STAR( "Ori 31", 1.438733, -0.019063, 4.71 )
+STAR( "Per 52", 1.112160, 0.706572, 4.71 )
+STAR( "Phe Iota", 6.174437, -0.743772, 4.71 )
+STAR( "UMa Omega", 2.853519, 0.753808, 4.71 )
+STAR( "Cru Theta2", 3.160442, -1.102447, 4.72 )
+STAR( "Dor Zeta", 1.333039, -1.003089, 4.72 )
+STAR( "Lup Pi", 3.949331, -0.821197, 4.72 )
+STAR( "Mus Mu", 3.090273, -1.166137, 4.72 )
+STAR( "Nor Delta", 4.217108, -0.788423, 4.72 )
+STAR( "Pup 19", 2.143577, -0.225618, 4.72 )
+STAR( "Pyx Theta", 2.449977, -0.453184, 4.72 )
+STAR( "Ret Kappa", 0.913585, -1.098467, 4.72 )
+STAR( "Sct Delta", 4.896841, -0.157996, 4.72 )
+STAR( "Aqr Mu", 5.465731, -0.156789, 4.73 )
+STAR( "CVn 20", 3.479932, 0.708124, 4.73 )
+STAR( "Cap Kappa", 5.683919, -0.329281, 4.73 )
+STAR( "Cas Lambda", 0.138637, 0.951592, 4.73 )
+STAR( "Cen 4", 3.635557, -0.557245, 4.73 )
+STAR( "Cep 9", 5.663244, 1.083534, 4.73 )
+STAR( "Crt Zeta", 3.075110, -0.320282, 4.73 )
+STAR( "Cyg Mu1", 5.690399, 0.501656, 4.73 )
+STAR( "Eri 17", 0.918996, -0.088580, 4.73 )
+STAR( "Oph 41", 4.523072, -0.007772, 4.73 )
+STAR( "Ori 22", 1.403950, -0.006676, 4.73 )
+STAR( "Sco Zeta1", 4.424388, -0.739360, 4.73 )
+STAR( "Aur Upsilon", 1.531701, 0.651105, 4.74 )
+STAR( "Cas Psi", 0.374955, 1.189093, 4.74 )
+STAR( "Com 11", 3.231986, 0.310543, 4.74 )
+STAR( "Cyg 59", 5.497031, 0.829400, 4.74 )
+STAR( "Cyg 8", 5.112818, 0.601319, 4.74 )
+STAR( "LMi 30", 2.731069, 0.589853, 4.74 )
+STAR( "Leo 61", 2.887771, -0.043367, 4.74 )
+STAR( "Lib Kappa", 4.110018, -0.343461, 4.74 )
+STAR( "Ori Omicron1", 1.276417, 0.248719, 4.74 )
+STAR( "Vir 61", 3.483699, -0.319594, 4.74 )
+STAR( "Ari Gamma2", 0.495368, 0.336737, 4.75 )
+STAR( "Boo Iota", 3.735725, 0.896527, 4.75 )
+STAR( "Cep Omicron", 6.102653, 1.188773, 4.75 )
+STAR( "Cet Sigma", 0.663603, -0.266071, 4.75 )
+STAR( "CrA Zeta", 4.987780, -0.734701, 4.75 )
+STAR( "Eri Tau2", 0.746296, -0.366592, 4.75 )
+STAR( "Hyi Nu", 0.743838, -1.310165, 4.75 )
+STAR( "Lup Psi2", 4.113232, -0.605813, 4.75 )
+STAR( "Aur Chi", 1.451801, 0.561855, 4.76 )
+STAR( "Boo 44", 3.943528, 0.831727, 4.76 )
+STAR( "Cap Nu", 5.326149, -0.222689, 4.76 )
+STAR( "Cet Phi1", 0.192815, -0.185170, 4.76 )
+STAR( "CrB Tau", 4.227936, 0.636885, 4.76 )
+STAR( "Her Upsilon", 4.201000, 0.803491, 4.76 )
+STAR( "Pav Phi1", 5.391235, -1.057350, 4.76 )
+STAR( "Peg 56", 6.052424, 0.444506, 4.76 )
+STAR( "Psc Upsilon", 0.346739, 0.475849, 4.76 )
+STAR( "Ser Rho", 4.150677, 0.366131, 4.76 )
+STAR( "Sgr 4", 4.711487, -0.415670, 4.76 )
+STAR( "UMa Rho", 2.367299, 1.180361, 4.76 )
+STAR( "Vir 69", 3.523180, -0.278792, 4.76 )
+STAR( "Ara Lambda", 4.626839, -0.862464, 4.77 )
+STAR( "Cet 20", 0.231292, -0.019969, 4.77 )
+STAR( "Dra 45", 4.854524, 0.995633, 4.77 )
+STAR( "Hya 51", 3.765970, -0.484397, 4.77 )
+STAR( "Leo 87", 3.012067, -0.052423, 4.77 )
+STAR( "Mon 17", 1.777312, 0.140276, 4.77 )
+STAR( "Phe Lambda1", 0.137081, -0.851784, 4.77 )
+STAR( "Sco Xi", 4.207851, -0.198497, 4.77 )
+STAR( "Vul 1", 5.044947, 0.373331, 4.77 )
+STAR( "Aps Zeta", 4.546539, -1.182819, 4.78 )
+STAR( "Aur 2", 1.276854, 0.640589, 4.78 )
+STAR( "Cap Rho", 5.361913, -0.310906, 4.78 )
+STAR( "Com 36", 3.398694, 0.303852, 4.78 )
+STAR( "Cyg 57", 5.468320, 0.774703, 4.78 )
+STAR( "Oct Theta", 0.006960, -1.345053, 4.78 )
+STAR( "Ori 56", 1.537810, 0.032376, 4.78 )
+STAR( "UMa 55", 2.963271, 0.666464, 4.78 )
+STAR( "Ant Theta", 2.549061, -0.484668, 4.79 )
+STAR( "Ari Lambda", 0.514559, 0.411830, 4.79 )
+STAR( "Aur Psi2", 1.742413, 0.741571, 4.79 )
+STAR( "Cep 24", 5.802376, 1.262591, 4.79 )
+STAR( "Eri 32", 1.022290, -0.051570, 4.79 )
+STAR( "Eri 64", 1.308692, -0.218821, 4.79 )
+STAR( "Gru Mu1", 5.827720, -0.721635, 4.79 )
+STAR( "Hya 26", 2.442472, -0.209003, 4.79 )
+STAR( "Leo 40", 2.704104, 0.339830, 4.79 )
+STAR( "Peg 35", 5.881141, 0.081953, 4.79 )
+STAR( "Peg Omicron", 5.941784, 0.511512, 4.79 )
+STAR( "Sco 22", 4.320592, -0.438339, 4.79 )
+STAR( "Vir Psi", 3.378754, -0.166485, 4.79 )
+STAR( "CVn 5", 3.246421, 0.899931, 4.8 )
+STAR( "Cas Xi", 0.183543, 0.881609, 4.8 )
+STAR( "Com 41", 3.434713, 0.482142, 4.8 )
+STAR( "Dra Omega", 4.611822, 1.200054, 4.8 )
+STAR( "Eri Zeta", 0.854484, -0.153933, 4.8 )
+STAR( "Hya 27", 2.445570, -0.166781, 4.8 )
+STAR( "Mus Eta", 3.469925, -1.184982, 4.8 )
+STAR( "Ori 49", 1.478665, -0.125892, 4.8 )
+STAR( "Peg Chi", 0.063719, 0.352673, 4.8 )
+STAR( "Tau Delta2", 1.152339, 0.304453, 4.8 )
+STAR( "UMa Sigma2", 2.401515, 1.171722, 4.8 )
+STAR( "Vir Sigma", 3.480208, 0.095465, 4.8 )
+STAR( "Boo 34", 3.854661, 0.462997, 4.81 )
+STAR( "Boo Omega", 3.936190, 0.436473, 4.81 )
+STAR( "Com 12", 3.239789, 0.451100, 4.81 )
+STAR( "Com 23", 3.293662, 0.394953, 4.81 )
+STAR( "Cyg 34", 5.313597, 0.663802, 4.81 )
+STAR( "Eri Psi", 1.315273, -0.125208, 4.81 )
+STAR( "Oph 51", 4.587671, -0.418229, 4.81 )
+STAR( "Peg 32", 5.852620, 0.494461, 4.81 )
+STAR( "Pic Delta", 1.615731, -0.959383, 4.81 )
+STAR( "Scl Eta", 0.121860, -0.576085, 4.81 )
+STAR( "Sco Iota2", 4.669570, -0.699712, 4.81 )
+STAR( "Sgr 21", 4.822999, -0.358520, 4.81 )
+STAR( "Tuc Nu", 5.903583, -1.081794, 4.81 )
+STAR( "Vir Phi", 3.788244, -0.038887, 4.81 )
+STAR( "And 58", 0.560636, 0.660767, 4.82 )
+STAR( "Aqr 104", 6.203613, -0.310955, 4.82 )
+STAR( "Aqr Sigma", 5.893308, -0.186367, 4.82 )
+STAR( "CVn 25", 3.566842, 0.633467, 4.82 )
+STAR( "CrB Kappa", 4.150531, 0.622341, 4.82 )
+STAR( "Dra 42", 4.825770, 1.144301, 4.82 )
+STAR( "Dra Upsilon", 4.949746, 1.244371, 4.82 )
+STAR( "Her 52", 4.403626, 0.802561, 4.82 )
+STAR( "Her 68", 4.526184, 0.577704, 4.82 )
+STAR( "Lup Pi", 3.949331, -0.821197, 4.82 )
+STAR( "Mic Theta1", 5.588370, -0.712264, 4.82 )
+STAR( "Oph 30", 4.455215, -0.073697, 4.82 )
+STAR( "Ori 15", 1.351321, 0.272223, 4.82 )
+STAR( "Ser Sigma", 4.285103, 0.017962, 4.82 )
+STAR( "Tau 139", 1.562048, 0.452981, 4.82 )
+STAR( "UMi 4", 3.703800, 1.353459, 4.82 )
+STAR( "Vul 29", 5.404070, 0.370029, 4.82 )
+STAR( "And 60", 0.581289, 0.771988, 4.83 )
+STAR( "And Omega", 0.382474, 0.792496, 4.83 )
+STAR( "Ari Gamma1", 0.495368, 0.336776, 4.83 )
+STAR( "Boo 12", 3.710563, 0.437932, 4.83 )
+STAR( "Boo Zeta", 3.844735, 0.239605, 4.83 )
+STAR( "CMa 15", 1.804445, -0.352978, 4.83 )
+STAR( "Cas Upsilon1", 0.239990, 1.029269, 4.83 )
+STAR( "Cet Kappa1", 0.869879, 0.058822, 4.83 )
+STAR( "Col Omicron", 1.385290, -0.609037, 4.83 )
+STAR( "Crt Epsilon", 2.987175, -0.189533, 4.83 )
+STAR( "Cyg 30", 5.294020, 0.817090, 4.83 )
+STAR( "Dor Theta", 1.369022, -1.172604, 4.83 )
+STAR( "Dra 18", 4.367330, 1.127294, 4.83 )
+STAR( "Sct Eta", 4.961367, -0.102034, 4.83 )
+STAR( "Ser Pi", 4.198804, 0.398013, 4.83 )
+STAR( "Sgr 60", 5.231421, -0.457199, 4.83 )
+STAR( "Sgr Nu1", 4.948750, -0.396975, 4.83 )
+STAR( "UMa 18", 2.426829, 0.942861, 4.83 )
+STAR( "And Gamma2", 0.540667, 0.738812, 4.84 )
+STAR( "Cap Eta", 5.517008, -0.346535, 4.84 )
+STAR( "Cet Epsilon", 0.696226, -0.207209, 4.84 )
+STAR( "Cyg 55", 5.449522, 0.804844, 4.84 )
+STAR( "Her 29", 4.331056, 0.200504, 4.84 )
+STAR( "Hyi Zeta", 0.722319, -1.180133, 4.84 )
+STAR( "Leo 58", 2.882237, 0.063137, 4.84 )
+STAR( "Lyn 27", 2.131294, 0.898961, 4.84 )
+STAR( "Peg Nu", 5.784370, 0.088289, 4.84 )
+STAR( "Psc Mu", 0.393506, 0.107231, 4.84 )
+STAR( "Tau 47", 1.108022, 0.161681, 4.84 )
+STAR( "UMa 36", 2.751628, 0.977045, 4.84 )
+STAR( "And 8", 6.098813, 0.855478, 4.85 )
+STAR( "Cas 1", 6.050249, 1.037070, 4.85 )
+STAR( "Cen Xi1", 3.418896, -0.864413, 4.85 )
+STAR( "Cet 56", 0.509069, -0.393169, 4.85 )
+STAR( "CrB Xi", 4.285205, 0.539166, 4.85 )
+STAR( "Gru Eta", 5.958692, -0.933756, 4.85 )
+STAR( "Gru Rho", 5.949391, -0.722818, 4.85 )
+STAR( "Per 53", 1.141242, 0.811559, 4.85 )
+STAR( "Sgr Psi", 5.041994, -0.440812, 4.85 )
+STAR( "Vir Xi", 3.077386, 0.144135, 4.85 )
+STAR( "Aur Mu", 1.367589, 0.671680, 4.86 )
+STAR( "Boo 20", 3.751382, 0.284610, 4.86 )
+STAR( "Boo 31", 3.846909, 0.142448, 4.86 )
+STAR( "Cet Nu", 0.680133, 0.097622, 4.86 )
+STAR( "Cir Epsilon", 4.003996, -1.110214, 4.86 )
+STAR( "Oph 74", 4.803444, 0.058944, 4.86 )
+STAR( "Psc 27", 6.277397, -0.062066, 4.86 )
+STAR( "Sgr 56", 5.176479, -0.344896, 4.86 )
+STAR( "Tau 126", 1.489180, 0.288571, 4.86 )
+STAR( "Tau 132", 1.522872, 0.428784, 4.86 )
+STAR( "Tuc Kappa", 0.330602, -1.202115, 4.86 )
+STAR( "Cas Tau", 6.226717, 1.023670, 4.87 )
+STAR( "Col Lambda", 1.540755, -0.589946, 4.87 )
+STAR( "CrA Epsilon", 4.968618, -0.647648, 4.87 )
+STAR( "Dra Nu2", 4.591379, 0.962951, 4.87 )
+STAR( "Eri 39", 1.110008, -0.179008, 4.87 )
+STAR( "Lyn 12", 1.772535, 1.037453, 4.87 )
+STAR( "Oph 58", 4.640089, -0.378446, 4.87 )
+STAR( "Tel Lambda", 4.967476, -0.923953, 4.87 )
+STAR( "Tri Delta", 0.598008, 0.597324, 4.87 )
+STAR( "UMa Xi", 2.959126, 0.550288, 4.87 )
+STAR( "And Xi", 0.359276, 0.794629, 4.88 )
+STAR( "Cas Sigma", 6.278858, 0.973108, 4.88 )
+STAR( "Dra Nu1", 4.590987, 0.963145, 4.88 )
+STAR( "Eri 15", 0.865545, -0.392898, 4.88 )
+STAR( "Gem 81", 2.033847, 0.323060, 4.88 )
+STAR( "Hya 9", 2.276440, -0.278264, 4.88 )
+STAR( "Lac 10", 5.930898, 0.681556, 4.88 )
+STAR( "Lib 48", 4.180893, -0.249223, 4.88 )
+STAR( "Pav Rho", 5.399998, -1.073901, 4.88 )
+STAR( "Tau 114", 1.429577, 0.382872, 4.88 )
+STAR( "Vir Rho", 3.324350, 0.178644, 4.88 )
+STAR( "Aql 70", 5.396238, -0.044506, 4.89 )
+STAR( "Ari Zeta", 0.850419, 0.367295, 4.89 )
+STAR( "Cas Nu", 0.213083, 0.889565, 4.89 )
+STAR( "Cet 6", 0.049153, -0.269968, 4.89 )
+STAR( "Cet Rho", 0.636827, -0.214511, 4.89 )
+STAR( "Cyg 15", 5.167382, 0.651958, 4.89 )
+STAR( "Dra 19", 4.433260, 1.136815, 4.89 )
+STAR( "Ind Zeta", 5.451900, -0.806812, 4.89 )
+STAR( "Pyx Delta", 2.336669, -0.483141, 4.89 )
+STAR( "Pyx Zeta", 2.267655, -0.515939, 4.89 )
+STAR( "Aur 63", 1.883450, 0.686273, 4.9 )
+STAR( "Cet 46", 0.373588, -0.254799, 4.9 )
+STAR( "Com 35", 3.374143, 0.370795, 4.9 )
+STAR( "Com 37", 3.404592, 0.537300, 4.9 )
+STAR( "Cyg 72", 5.649529, 0.672548, 4.9 )
+STAR( "For Omega", 0.671275, -0.492750, 4.9 )
+STAR( "Gem Omicron", 2.003485, 0.603608, 4.9 )
+STAR( "Her 42", 4.357862, 0.853961, 4.9 )
+STAR( "Lyn 16", 1.822204, 0.787042, 4.9 )
+STAR( "Mic Alpha", 5.454016, -0.589567, 4.9 )
+STAR( "Peg Rho", 6.000566, 0.153865, 4.9 )
+STAR( "Sct Epsilon", 4.902288, -0.144431, 4.9 )
+STAR( "Tel Iota", 5.127850, -0.839489, 4.9 )
+STAR( "Aps Eta", 3.744735, -1.413852, 4.91 )
+STAR( "Aql 69", 5.365360, -0.050362, 4.91 )
+STAR( "Aur Psi1", 1.679436, 0.860239, 4.91 )
+STAR( "Boo 6", 3.620307, 0.371130, 4.91 )
+STAR( "Cha Epsilon", 3.139942, -1.365230, 4.91 )
+STAR( "Eri 45", 1.186293, -0.000766, 4.91 )
+STAR( "Her 60", 4.474057, 0.222369, 4.91 )
+STAR( "Hya Phi3", 2.786345, -0.294553, 4.91 )
+STAR( "Lup 1", 3.990790, -0.550113, 4.91 )
+STAR( "Ori 51", 1.494336, 0.025739, 4.91 )
+STAR( "Per 12", 0.707942, 0.701516, 4.91 )
+STAR( "Tau 134", 1.525192, 0.220804, 4.91 )
+STAR( "TrA Zeta", 4.313007, -1.223204, 4.91 )
+STAR( "Vul 30", 5.431792, 0.441054, 4.91 )
+STAR( "Cyg Psi", 5.216920, 0.915231, 4.92 )
+STAR( "Lib Delta", 3.931238, -0.148683, 4.92 )
+STAR( "Mon 20", 1.877225, -0.073953, 4.92 )
+STAR( "PsA Tau", 5.803860, -0.568076, 4.92 )
+STAR( "Sco Beta2", 4.212534, -0.345609, 4.92 )
+STAR( "Boo 45", 3.958850, 0.434049, 4.93 )
+STAR( "CrA Gamma", 5.002194, -0.646877, 4.93 )
+STAR( "Cyg 28", 5.277119, 0.642974, 4.93 )
+STAR( "Hor Delta", 1.094511, -0.732927, 4.93 )
+STAR( "Lep 17", 1.592547, -0.287708, 4.93 )
+STAR( "Lyr Lambda", 4.974254, 0.561046, 4.93 )
+STAR( "Mon 27", 2.093239, -0.064223, 4.93 )
+STAR( "Peg 78", 6.213336, 0.512458, 4.93 )
+STAR( "Per 24", 0.781304, 0.614060, 4.93 )
+STAR( "Per 54", 1.136253, 0.603302, 4.93 )
+STAR( "UMa 78", 3.406577, 0.983779, 4.93 )
+STAR( "And Tau", 0.438863, 0.708201, 4.94 )
+STAR( "Aur Omega", 1.305754, 0.661310, 4.94 )
+STAR( "Boo Pi1", 3.842895, 0.286554, 4.94 )
+STAR( "Cas Pi", 0.189666, 0.820736, 4.94 )
+STAR( "Cet 3", 0.019642, -0.183424, 4.94 )
+STAR( "Com 31", 3.367169, 0.480673, 4.94 )
+STAR( "Cyg 22", 5.217931, 0.671719, 4.94 )
+STAR( "Dra 6", 3.293145, 1.222113, 4.94 )
+STAR( "Gem Chi", 2.109747, 0.485100, 4.94 )
+STAR( "Hya 54", 3.865912, -0.444065, 4.94 )
+STAR( "Hya Chi1", 2.903057, -0.476363, 4.94 )
+STAR( "Lac 15", 5.986625, 0.755946, 4.94 )
+STAR( "Lib 11", 3.887794, -0.040128, 4.94 )
+STAR( "Lib Epsilon", 4.032576, -0.180157, 4.94 )
+STAR( "Nor Kappa", 4.247601, -0.953483, 4.94 )
+STAR( "Nor Mu", 4.337507, -0.768735, 4.94 )
+STAR( "Psc Kappa", 6.138905, 0.021914, 4.94 )
+STAR( "Sco Psi", 4.241150, -0.175653, 4.94 )
+STAR( "Tau 109", 1.393107, 0.385655, 4.94 )
+STAR( "Tau Omega2", 1.122509, 0.359165, 4.94 )
+STAR( "Tel Xi", 5.268218, -0.922945, 4.94 )
+STAR( "Tri 6", 0.577580, 0.528888, 4.94 )
+STAR( "Vir 78", 3.552320, 0.063860, 4.94 )
+STAR( "And Psi", 6.222251, 0.810187, 4.95 )
+STAR( "Aql Kappa", 5.135159, -0.122653, 4.95 )
+STAR( "Aql Rho", 5.298281, 0.265246, 4.95 )
+STAR( "Com 14", 3.256792, 0.475922, 4.95 )
+STAR( "Com 7", 3.212897, 0.417924, 4.95 )
+STAR( "Cyg Omega1", 5.367142, 0.854368, 4.95 )
+STAR( "Dra 4", 3.272980, 1.207787, 4.95 )
+STAR( "Her 106", 4.800957, 0.383299, 4.95 )
+STAR( "Hya Psi", 3.442902, -0.403486, 4.95 )
+STAR( "Leo Tau", 3.001690, 0.049849, 4.95 )
+STAR( "Mon 3", 1.578825, -0.184971, 4.95 )
+STAR( "Ori 69", 1.623396, 0.281531, 4.95 )
+STAR( "Ori Psi1", 1.416975, 0.032226, 4.95 )
+STAR( "Per 32", 0.878955, 0.756241, 4.95 )
+STAR( "Tau Phi", 1.136013, 0.477362, 4.95 )
+STAR( "UMi Eta", 4.265170, 1.322179, 4.95 )
+STAR( "Vul 12", 5.197016, 0.394619, 4.95 )
+STAR( "Her 95", 4.718963, 0.376914, 4.96 )
+STAR( "Lib 42", 4.102753, -0.415703, 4.96 )
+STAR( "Phe Nu", 0.328056, -0.794673, 4.96 )
+STAR( "Sgr 43", 5.051136, -0.330793, 4.96 )
+STAR( "Tel Delta1", 4.850954, -0.801368, 4.96 )
+STAR( "UMi Theta", 4.064065, 1.350002, 4.96 )
+STAR( "Vir 16", 3.230386, 0.057814, 4.96 )
+STAR( "Col Xi", 1.551154, -0.647881, 4.97 )
+STAR( "Cyg 2", 5.079461, 0.516991, 4.97 )
+STAR( "Cyg 29", 5.299401, 0.642393, 4.97 )
+STAR( "Gem Phi", 2.066019, 0.467152, 4.97 )
+STAR( "Her 104", 4.764327, 0.548125, 4.97 )
+STAR( "Hya 52", 3.788121, -0.514727, 4.97 )
+STAR( "Hya Omega", 2.382258, 0.088876, 4.97 )
+STAR( "Leo Xi", 2.495581, 0.197217, 4.97 )
+STAR( "Per 40", 0.970294, 0.592801, 4.97 )
+STAR( "Ret Iota", 1.052884, -1.066028, 4.97 )
+STAR( "Tau 75", 1.171290, 0.285531, 4.97 )
+STAR( "Vir 89", 3.620998, -0.316501, 4.97 )
+STAR( "And Chi", 0.433496, 0.774684, 4.98 )
+STAR( "Aqr Psi3", 6.104122, -0.167741, 4.98 )
+STAR( "Ari 14", 0.564709, 0.452734, 4.98 )
+STAR( "CMa 29", 1.914066, -0.428633, 4.98 )
+STAR( "Cas 4", 6.129764, 1.087040, 4.98 )
+STAR( "Cas Phi", 0.349422, 1.016334, 4.98 )
+STAR( "Dra 39", 4.816709, 1.026263, 4.98 )
+STAR( "Hya 6", 2.269037, -0.217735, 4.98 )
+STAR( "Lyn 1", 1.648958, 1.073644, 4.98 )
+STAR( "Peg 72", 6.169535, 0.546729, 4.98 )
+STAR( "Ser Theta2", 4.957797, 0.073338, 4.98 )
+STAR( "Sgr 11", 4.763542, -0.413662, 4.98 )
+STAR( "Vir 70", 3.527441, 0.240487, 4.98 )
+STAR( "Aur Sigma", 1.416567, 0.652501, 4.99 )
+STAR( "Aur Xi", 1.548311, 0.972270, 4.99 )
+STAR( "CMi Epsilon", 1.944508, 0.161899, 4.99 )
+STAR( "Cas Omega", 0.506145, 1.198784, 4.99 )
+STAR( "CrA Gamma", 5.002194, -0.646877, 4.99 )
+STAR( "CrB Iota", 4.195088, 0.521000, 4.99 )
+STAR( "Cyg 17", 5.176763, 0.588661, 4.99 )
+STAR( "Dra 54", 5.034926, 1.007142, 4.99 )
+STAR( "Hor Beta", 0.780148, -1.118257, 4.99 )
+STAR( "Leo 59", 2.883051, 0.106489, 4.99 )
+STAR( "Lyn 24", 2.020248, 1.024688, 4.99 )
+STAR( "Mon 19", 1.845308, -0.073987, 4.99 )
+STAR( "Nor Gamma1", 4.263032, -0.873857, 4.99 )
+STAR( "PsA Upsilon", 5.796384, -0.594178, 4.99 )
+STAR( "Pup 20", 2.152573, -0.275558, 4.99 )
+STAR( "Sgr Nu2", 4.952888, -0.395690, 4.99 )
+STAR( "Tau 111", 1.415564, 0.303396, 4.99 )
+STAR( "UMa 56", 2.979393, 0.758918, 4.99 )
+STAR( "Aqr Omega1", 6.194981, -0.248215, 5 )
+STAR( "Aur 9", 1.338129, 0.900551, 5 )
+STAR( "CMa Mu", 1.815622, -0.245107, 5 )
+STAR( "Com 16", 3.259351, 0.468194, 5 )
+STAR( "Cyg 68", 5.578305, 0.766999, 5 )
+STAR( "Dra 15", 4.310891, 1.200229, 5 )
+STAR( "For Delta", 0.969741, -0.557429, 5 )
+STAR( "Gem 51", 1.890941, 0.282026, 5 )
+STAR( "Her Kappa", 4.224024, 0.297525, 5 )
+STAR( "Leo 10", 2.518561, 0.119308, 5 )
+STAR( "Lup Nu1", 4.023588, -0.836498, 5 )
+STAR( "Ori 23", 1.408626, 0.061862, 5 )
+STAR( "Sge Zeta", 5.187897, 0.334095, 5 )
+STAR( "Tau 104", 1.341504, 0.325417, 5 )
+STAR( "Tuc Eta", 6.272655, -1.122218, 5 )
+STAR( "Vul 9", 5.125079, 0.345110, 5 )
+STAR( "Aql 26", 5.063847, -0.094524, 5.01 )
+STAR( "Boo 9", 3.650225, 0.479825, 5.01 )
+STAR( "Cyg 74", 5.659012, 0.705351, 5.01 )
+STAR( "Dor Eta2", 1.619884, -1.144752, 5.01 )
+STAR( "Gem 65", 1.962674, 0.487228, 5.01 )
+STAR( "Hyi Kappa", 0.623395, -1.285362, 5.01 )
+STAR( "Lyr 16", 4.980472, 0.819165, 5.01 )
+STAR( "Peg 31", 5.853478, 0.213022, 5.01 )
+STAR( "PsA Theta", 5.706078, -0.539278, 5.01 )
+STAR( "Scl Zeta", 0.010174, -0.518717, 5.01 )
+STAR( "Vir 82", 3.584964, -0.151897, 5.01 )
+STAR( "Vul 32", 5.474051, 0.489696, 5.01 )
+STAR( "Aql 4", 4.908004, 0.035954, 5.02 )
+STAR( "Aur 14", 1.376221, 0.570509, 5.02 )
+STAR( "Aur Psi4", 1.758783, 0.777098, 5.02 )
+STAR( "Aur Psi7", 1.792300, 0.729223, 5.02 )
+STAR( "Boo Nu1", 4.061948, 0.712671, 5.02 )
+STAR( "Boo Nu2", 4.065672, 0.713830, 5.02 )
+STAR( "CVn 6", 3.254377, 0.681003, 5.02 )
+STAR( "Col Theta", 1.603638, -0.650188, 5.02 )
+STAR( "Com 24", 3.294876, 0.320738, 5.02 )
+STAR( "Dra 30", 4.664705, 0.886298, 5.02 )
+STAR( "Oph Rho", 4.300433, -0.409231, 5.02 )
+STAR( "Pav Omicron", 5.556001, -1.223936, 5.02 )
+STAR( "Sgr 61", 5.227043, -0.270376, 5.02 )
+STAR( "UMi 11", 4.001596, 1.253563, 5.02 )
+STAR( "And 22", 0.045037, 0.804112, 5.03 )
+STAR( "And 41", 0.296771, 0.766932, 5.03 )
+STAR( "Aql 36", 5.107982, -0.048675, 5.03 )
+STAR( "Aqr Kappa", 5.924331, -0.073793, 5.03 )
+STAR( "Ari Kappa", 0.552244, 0.395288, 5.03 )
+STAR( "Aur 19", 1.396329, 0.592680, 5.03 )
+STAR( "Cep 16", 5.756314, 1.277232, 5.03 )
+STAR( "Cyg 20", 5.195096, 0.924816, 5.03 )
+STAR( "Dra 36", 4.773025, 1.123944, 5.03 )
+STAR( "Eri 60", 1.266207, -0.283044, 5.03 )
+STAR( "Gem 57", 1.935025, 0.437215, 5.03 )
+STAR( "Lib Lambda", 4.159709, -0.351984, 5.03 )
+STAR( "Mon 2", 1.566746, -0.166824, 5.03 )
+STAR( "Per 31", 0.868854, 0.874323, 5.03 )
+STAR( "Pic Eta2", 1.330668, -0.865295, 5.03 )
+STAR( "Sgr Chi1", 5.084471, -0.427756, 5.03 )
+STAR( "Tau 79", 1.173021, 0.227722, 5.03 )
+STAR( "Tri 10", 0.606284, 0.499906, 5.03 )
+STAR( "UMa 46", 2.861206, 0.584807, 5.03 )
+STAR( "Cep Lambda", 5.809816, 1.036978, 5.04 )
+STAR( "Cha Kappa", 3.162428, -1.335511, 5.04 )
+STAR( "Cyg 56", 5.454510, 0.768982, 5.04 )
+STAR( "Dra 35", 4.666356, 1.343254, 5.04 )
+STAR( "Dra 46", 4.898405, 0.969346, 5.04 )
+STAR( "Her 30", 4.313763, 0.730973, 5.04 )
+STAR( "Her 51", 4.414614, 0.430335, 5.04 )
+STAR( "Her 99", 4.743041, 0.533407, 5.04 )
+STAR( "Ori 74", 1.642544, 0.214191, 5.04 )
+STAR( "Peg 14", 5.715277, 0.526639, 5.04 )
+STAR( "Per 4", 0.533642, 0.950986, 5.04 )
+STAR( "Psc 19", 6.223808, 0.060854, 5.04 )
+STAR( "Pup 4", 2.033083, -0.254188, 5.04 )
+STAR( "Vir 53", 3.456006, -0.282719, 5.04 )
+STAR( "Vul 28", 5.404114, 0.420906, 5.04 )
+STAR( "Cae Beta", 1.230712, -0.648293, 5.05 )
+STAR( "Cam 3", 1.221345, 0.926416, 5.05 )
+STAR( "Cyg 26", 5.241922, 0.874492, 5.05 )
+STAR( "Del Kappa", 5.406725, 0.176036, 5.05 )
+STAR( "Dra 27", 4.590063, 1.189180, 5.05 )
+STAR( "Gem 64", 1.960616, 0.490753, 5.05 )
+STAR( "Gem 74", 2.004845, 0.308482, 5.05 )
+STAR( "Ind Iota", 5.460706, -0.900735, 5.05 )
+STAR( "Mus Iota1", 3.512991, -1.307038, 5.05 )
+STAR( "Psc 7", 6.110150, 0.093923, 5.05 )
+STAR( "Sex Gamma", 2.585298, -0.141459, 5.05 )
+STAR( "Tel Eta", 5.073898, -0.949871, 5.05 )
+STAR( "UMa 47", 2.877466, 0.705641, 5.05 )
+STAR( "Aps Epsilon", 3.762835, -1.398164, 5.06 )
+STAR( "Aqr Chi", 6.094901, -0.134856, 5.06 )
+STAR( "Cet 94", 0.841132, -0.020876, 5.06 )
+STAR( "Dor Nu", 1.608917, -1.201543, 5.06 )
+STAR( "Her 98", 4.738707, 0.387793, 5.06 )
+STAR( "Hya Kappa", 2.532066, -0.250144, 5.06 )
+STAR( "Lyr Epsilon1", 4.905859, 0.692372, 5.06 )
+STAR( "Mon 10", 1.692795, -0.083116, 5.06 )
+STAR( "Peg 77", 6.210638, 0.180317, 5.06 )
+STAR( "Psc 47", 0.122384, 0.312293, 5.06 )
+STAR( "Ser 5", 4.011261, 0.030810, 5.06 )
+STAR( "Sgr 55", 5.159710, -0.281415, 5.06 )
+STAR( "Aur Phi", 1.429636, 0.601717, 5.07 )
+STAR( "Cae Delta", 1.181741, -0.784593, 5.07 )
+STAR( "CrB Zeta2", 4.098811, 0.639416, 5.07 )
+STAR( "Hyi Lambda", 0.212014, -1.307659, 5.07 )
+STAR( "Leo 6", 2.495646, 0.169573, 5.07 )
+STAR( "Oph 36", 4.517552, -0.464282, 5.07 )
+STAR( "Psc 64", 0.213708, 0.295668, 5.07 )
+STAR( "Sco Xi", 4.207851, -0.198497, 5.07 )
+STAR( "Tau 30", 0.996023, 0.194488, 5.07 )
+STAR( "Tau Sigma1", 1.218036, 0.275757, 5.07 )
+STAR( "Tel Delta2", 4.852161, -0.798614, 5.07 )
+STAR( "Vul 17", 5.266051, 0.412150, 5.07 )
+STAR( "Aqr 94", 6.104776, -0.234902, 5.08 )
+STAR( "Cam 11", 1.335795, 1.029264, 5.08 )
+STAR( "Cap Mu", 5.730338, -0.236521, 5.08 )
+STAR( "Cep 31", 5.915655, 1.285314, 5.08 )
+STAR( "Dra 17", 4.346866, 0.923706, 5.08 )
+STAR( "Hya 44", 2.766412, -0.414433, 5.08 )
+STAR( "Hya 50", 3.720897, -0.475796, 5.08 )
+STAR( "LMi 41", 2.807435, 0.404713, 5.08 )
+STAR( "Lac 13", 5.951973, 0.729882, 5.08 )
+STAR( "Leo 48", 2.769838, 0.121363, 5.08 )
+STAR( "Ori 27", 1.415818, -0.015558, 5.08 )
+STAR( "Ori Theta2", 1.463379, -0.094529, 5.08 )
+STAR( "Peg 16", 5.729320, 0.452477, 5.08 )
+STAR( "Peg 66", 6.122077, 0.214918, 5.08 )
+STAR( "Peg Phi", 6.250409, 0.333712, 5.08 )
+STAR( "Sgr Xi1", 4.962589, -0.360522, 5.08 )
+STAR( "UMa 49", 2.883458, 0.684382, 5.08 )
+STAR( "Aql 18", 5.004630, 0.193232, 5.09 )
+STAR( "Ari Tau2", 0.884678, 0.362015, 5.09 )
+STAR( "Cap 46", 5.694159, -0.158520, 5.09 )
+STAR( "Cir Delta", 4.000927, -1.063909, 5.09 )
+STAR( "Crt Lambda", 2.981742, -0.327773, 5.09 )
+STAR( "Men Alpha", 1.615477, -1.304687, 5.09 )
+STAR( "Sex Beta", 2.750166, -0.011117, 5.09 )
+STAR( "Tau 28", 1.000015, 0.421264, 5.09 )
+STAR( "TrA Kappa", 4.169126, -1.197349, 5.09 )
+STAR( "Tuc Beta3", 0.142812, -1.100100, 5.09 )
+STAR( "And 2", 6.032752, 0.746264, 5.1 )
+STAR( "Aql 23", 5.055092, 0.018942, 5.1 )
+STAR( "Aqr 25", 5.670378, 0.039158, 5.1 )
+STAR( "Ari Iota", 0.512043, 0.310974, 5.1 )
+STAR( "Cap Upsilon", 5.410739, -0.316578, 5.1 )
+STAR( "Com 6", 3.211420, 0.260035, 5.1 )
+STAR( "Gem 56", 1.928356, 0.356808, 5.1 )
+STAR( "Gru Mu2", 5.831334, -0.726537, 5.1 )
+STAR( "Her 101", 4.751143, 0.349856, 5.1 )
+STAR( "Oct Epsilon", 5.846962, -1.403938, 5.1 )
+STAR( "Psc 29", 0.007956, -0.052840, 5.1 )
+STAR( "Sge Eta", 5.258495, 0.348911, 5.1 )
+STAR( "Tau 97", 1.271363, 0.328815, 5.1 )
+STAR( "UMa 44", 2.851759, 0.952688, 5.1 )
+STAR( "Aql Omicron", 5.196834, 0.181786, 5.11 )
+STAR( "Cep 19", 5.782050, 1.086991, 5.11 )
+STAR( "Cha Zeta", 2.504053, -1.412694, 5.11 )
+STAR( "Cir Theta", 3.912737, -1.095732, 5.11 )
+STAR( "CrB Mu", 4.080798, 0.680853, 5.11 )
+STAR( "Cyg 75", 5.673127, 0.755272, 5.11 )
+STAR( "Cyg Beta2", 5.108382, 0.488086, 5.11 )
+STAR( "Dor Epsilon", 1.526698, -1.167645, 5.11 )
+STAR( "Eri 47", 1.196394, -0.143665, 5.11 )
+STAR( "Hor Mu", 0.801164, -1.042621, 5.11 )
+STAR( "Mic Iota", 5.447551, -0.767746, 5.11 )
+STAR( "Mic Nu", 5.383984, -0.776953, 5.11 )
+STAR( "Oct Gamma1", 6.248744, -1.431500, 5.11 )
+STAR( "Oph 36", 4.517567, -0.464306, 5.11 )
+STAR( "Per 21", 0.773566, 0.557356, 5.11 )
+STAR( "Per 42", 1.001572, 0.577554, 5.11 )
+STAR( "Phe Phi", 0.499019, -0.741712, 5.11 )
+STAR( "PsA Pi", 6.036643, -0.606492, 5.11 )
+STAR( "Pup 12", 2.090446, -0.406846, 5.11 )
+STAR( "Ser 36", 4.150655, -0.053940, 5.11 )
+STAR( "Aql 37", 5.127436, -0.184312, 5.12 )
+STAR( "Boo Epsilon", 3.861483, 0.472548, 5.12 )
+STAR( "Cam 43", 1.805121, 1.202328, 5.12 )
+STAR( "Cet 48", 0.390961, -0.377505, 5.12 )
+STAR( "Cnc 8", 2.116539, 0.228953, 5.12 )
+STAR( "Com 27", 3.345120, 0.289332, 5.12 )
+STAR( "Cyg 19", 5.194827, 0.675835, 5.12 )
+STAR( "Dra 53", 5.025130, 0.992380, 5.12 )
+STAR( "Eri 66", 1.338500, -0.081245, 5.12 )
+STAR( "Eri 68", 1.347074, -0.077774, 5.12 )
+STAR( "Her 107", 4.804091, 0.503877, 5.12 )
+STAR( "Her 5", 4.194193, 0.310989, 5.12 )
+STAR( "Her 70", 4.541798, 0.427596, 5.12 )
+STAR( "Her 87", 4.663607, 0.447202, 5.12 )
+STAR( "Lup Xi1", 4.175228, -0.592825, 5.12 )
+STAR( "Lyr Mu", 4.818112, 0.689531, 5.12 )
+STAR( "Pav Phi2", 5.410710, -1.056777, 5.12 )
+STAR( "Peg 57", 6.062947, 0.151446, 5.12 )
+STAR( "Tau 66", 1.151328, 0.165123, 5.12 )
+STAR( "UMa 38", 2.801006, 1.146967, 5.12 )
+STAR( "Aqr 47", 5.853805, -0.376962, 5.13 )
+STAR( "Aur 65", 1.928778, 0.641593, 5.13 )
+STAR( "Cen Omicron1", 3.018409, -1.037462, 5.13 )
+STAR( "Cet 37", 0.324631, -0.138283, 5.13 )
+STAR( "CrA Lambda", 4.903423, -0.668873, 5.13 )
+STAR( "Dra 59", 5.014171, 1.336234, 5.13 )
+STAR( "Mon 25", 1.995253, -0.071752, 5.13 )
+STAR( "Ori Theta1", 1.462913, -0.094068, 5.13 )
+STAR( "Phe Pi", 6.278517, -0.920588, 5.13 )
+STAR( "UMa 16", 2.418779, 1.072039, 5.13 )
+STAR( "CMi Zeta", 2.058180, 0.030839, 5.14 )
+STAR( "Cam 42", 1.793115, 1.179353, 5.14 )
+STAR( "Cnc Chi", 2.181945, 0.475040, 5.14 )
+STAR( "Cnc Xi", 2.397028, 0.384768, 5.14 )
+STAR( "Cyg 23", 5.206710, 1.003976, 5.14 )
+STAR( "Del Gamma1", 5.439515, 0.281425, 5.14 )
+STAR( "Dor Lambda", 1.423847, -1.028217, 5.14 )
+STAR( "For Phi", 0.645895, -0.590115, 5.14 )
+STAR( "Gem Pi", 2.039875, 0.583211, 5.14 )
+STAR( "LMi 19", 2.607893, 0.716555, 5.14 )
+STAR( "Lyr Epsilon2", 4.906041, 0.691378, 5.14 )
+STAR( "Nor Theta", 4.255353, -0.826801, 5.14 )
+STAR( "Ori 64", 1.585872, 0.343665, 5.14 )
+STAR( "Pav Omega", 4.968109, -1.050698, 5.14 )
+STAR( "Phe Chi", 0.531046, -0.780400, 5.14 )
+STAR( "Tau 4", 0.918080, 0.197857, 5.14 )
+STAR( "UMa Sigma1", 2.392817, 1.167160, 5.14 )
+STAR( "Vir Upsilon", 3.750458, -0.039541, 5.14 )
+STAR( "Aql 21", 5.034017, 0.040031, 5.15 )
+STAR( "Ara Mu", 4.643208, -0.904677, 5.15 )
+STAR( "CVn 21", 3.482986, 0.867114, 5.15 )
+STAR( "Cen Omicron2", 3.018605, -1.038747, 5.15 )
+STAR( "Cyg 4", 5.088297, 0.633865, 5.15 )
+STAR( "Her 43", 4.388769, 0.149793, 5.15 )
+STAR( "Hya 47", 3.658726, -0.435847, 5.15 )
+STAR( "Lib 36", 4.078056, -0.489512, 5.15 )
+STAR( "Lib Alpha1", 3.886354, -0.279204, 5.15 )
+STAR( "Lyn 35", 2.321055, 0.763174, 5.15 )
+STAR( "Mus Zeta2", 3.238117, -1.178480, 5.15 )
+STAR( "Oct Alpha", 5.518367, -1.344320, 5.15 )
+STAR( "Pav Upsilon", 5.419036, -1.165196, 5.15 )
+STAR( "Per 29", 0.866687, 0.876543, 5.15 )
+STAR( "Tri 14", 0.663676, 0.630888, 5.15 )
+STAR( "Vir 90", 3.642073, -0.026233, 5.15 )
+STAR( "Vul 22", 5.303634, 0.410303, 5.15 )
+STAR( "Aql 31", 5.083141, 0.208470, 5.16 )
+STAR( "Aqr 1", 5.407968, 0.008489, 5.16 )
+STAR( "Equ Beta", 5.597678, 0.118876, 5.16 )
+STAR( "Her 90", 4.683162, 0.698272, 5.16 )
+STAR( "Ind Mu", 5.520636, -0.955170, 5.16 )
+STAR( "Peg 59", 6.072597, 0.152193, 5.16 )
+STAR( "Peg Sigma", 5.988232, 0.171663, 5.16 )
+STAR( "Psc 82", 0.310290, 0.548465, 5.16 )
+STAR( "Psc 89", 0.339467, 0.063084, 5.16 )
+STAR( "Tel Rho", 5.001815, -0.913520, 5.16 )
+STAR( "UMa 37", 2.771416, 0.996282, 5.16 )
+STAR( "Vul 4", 5.085351, 0.345551, 5.16 )
+STAR( "Aql Sigma", 5.145202, 0.094209, 5.17 )
+STAR( "Cas Mu", 0.297899, 0.958540, 5.17 )
+STAR( "Cir Eta", 3.947949, -1.117563, 5.17 )
+STAR( "Col Mu", 1.509703, -0.563853, 5.17 )
+STAR( "Cru Mu2", 3.379888, -0.997776, 5.17 )
+STAR( "Cyg 35", 5.317371, 0.610565, 5.17 )
+STAR( "Del 17", 5.478639, 0.239483, 5.17 )
+STAR( "Eri Xi", 1.150521, -0.065372, 5.17 )
+STAR( "Per 9", 0.621148, 0.974689, 5.17 )
+STAR( "Pup 9", 2.058492, -0.242567, 5.17 )
+STAR( "Ser 10", 4.051942, 0.032153, 5.17 )
+STAR( "Ser Tau1", 4.039521, 0.269270, 5.17 )
+STAR( "Tel Kappa", 4.942162, -0.909447, 5.17 )
+STAR( "UMa 27", 2.543614, 1.261044, 5.17 )
+STAR( "And Rho", 0.092161, 0.662677, 5.18 )
+STAR( "Aqr 108", 6.245464, -0.330022, 5.18 )
+STAR( "Ari 38", 0.719774, 0.217221, 5.18 )
+STAR( "Cap 42", 5.679076, -0.245175, 5.18 )
+STAR( "Cas 42", 0.449124, 1.232595, 5.18 )
+STAR( "Cep 6", 5.582305, 1.132229, 5.18 )
+STAR( "Com 13", 3.247658, 0.455507, 5.18 )
+STAR( "Crt Eta", 3.124205, -0.299339, 5.18 )
+STAR( "Gem Omega", 1.843126, 0.422636, 5.18 )
+STAR( "Her 95", 4.718927, 0.376909, 5.18 )
+STAR( "Leo 75", 2.955235, 0.035091, 5.18 )
+STAR( "Phe Sigma", 6.227626, -0.876621, 5.18 )
+STAR( "Pup 6", 2.049395, -0.300691, 5.18 )
+STAR( "Scl Iota", 0.093899, -0.505826, 5.18 )
+STAR( "Tau 125", 1.482381, 0.451987, 5.18 )
+STAR( "Vul 21", 5.298129, 0.500817, 5.18 )
+STAR( "Vul 3", 5.073883, 0.458367, 5.18 )
+STAR( "And 64", 0.630129, 0.872781, 5.19 )
+STAR( "Aur 66", 1.937934, 0.709864, 5.19 )
+STAR( "Cep 30", 5.928229, 1.109758, 5.19 )
+STAR( "Cet Phi2", 0.218719, -0.185781, 5.19 )
+STAR( "Cyg 25", 5.235639, 0.646518, 5.19 )
+STAR( "Men Gamma", 1.448107, -1.332404, 5.19 )
+STAR( "Ori 6", 1.286228, 0.199423, 5.19 )
+STAR( "Vir 49", 3.437848, -0.187453, 5.19 )
+STAR( "Aqr 97", 6.120230, -0.262483, 5.2 )
+STAR( "Aqr Upsilon", 5.910965, -0.361429, 5.2 )
+STAR( "Aur Psi3", 1.740181, 0.696430, 5.2 )
+STAR( "CMa 10", 1.764848, -0.542283, 5.2 )
+STAR( "Cam 31", 1.548820, 1.045249, 5.2 )
+STAR( "Cet 13", 0.153800, -0.062706, 5.2 )
+STAR( "Cnc Omicron1", 2.344188, 0.267433, 5.2 )
+STAR( "Cnc Sigma3", 2.354202, 0.565812, 5.2 )
+STAR( "CrB Nu1", 4.286340, 0.589907, 5.2 )
+STAR( "Dra 2", 3.037077, 1.209911, 5.2 )
+STAR( "Dra 73", 5.373462, 1.308207, 5.2 )
+STAR( "For Kappa", 0.621963, -0.415674, 5.2 )
+STAR( "Lib Nu", 3.955905, -0.283737, 5.2 )
+STAR( "Lyn 18", 1.902038, 1.040871, 5.2 )
+STAR( "Oph Omicron", 4.529180, -0.423887, 5.2 )
+STAR( "Ori 71", 1.635584, 0.334342, 5.2 )
+STAR( "Tau 41", 1.076025, 0.481711, 5.2 )
+STAR( "Vol Theta", 2.264943, -1.228484, 5.2 )
+STAR( "Crv Zeta", 3.231310, -0.387739, 5.21 )
+STAR( "Cyg 61", 5.527938, 0.676242, 5.21 )
+STAR( "Gem 26", 1.755823, 0.307968, 5.21 )
+STAR( "Hor Zeta", 0.701011, -0.952077, 5.21 )
+STAR( "Lyn 5", 1.687799, 1.019573, 5.21 )
+STAR( "Phe Upsilon", 0.295826, -0.724084, 5.21 )
+STAR( "Ser 59", 4.831108, 0.003423, 5.21 )
+STAR( "Sex Delta", 2.746617, -0.047807, 5.21 )
+STAR( "UMa 67", 3.150814, 0.751287, 5.21 )
+STAR( "Vir 76", 3.547244, -0.177413, 5.21 )
+STAR( "And 14", 6.157914, 0.684804, 5.22 )
+STAR( "Aql 19", 5.013451, 0.106000, 5.22 )
+STAR( "Ari Pi", 0.738674, 0.304807, 5.22 )
+STAR( "Aur Psi6", 1.778752, 0.851536, 5.22 )
+STAR( "Cap Tau", 5.407350, -0.261009, 5.22 )
+STAR( "Cas 49", 0.547684, 1.328457, 5.22 )
+STAR( "Cnc Rho2", 2.337265, 0.487427, 5.22 )
+STAR( "Com Alpha", 3.446974, 0.305947, 5.22 )
+STAR( "Gem 63", 1.953634, 0.374286, 5.22 )
+STAR( "Ori 60", 1.565677, 0.009653, 5.22 )
+STAR( "Phe Rho", 0.221162, -0.889890, 5.22 )
+STAR( "Sco Chi", 4.249215, -0.206603, 5.22 )
+STAR( "Vir 32", 3.340640, 0.133925, 5.22 )
+STAR( "Vir 57", 3.473118, -0.348072, 5.22 )
+STAR( "Vir 59", 3.476587, 0.164483, 5.22 )
+STAR( "Vul 16", 5.244816, 0.435251, 5.22 )
+STAR( "And 28", 0.131431, 0.519265, 5.23 )
+STAR( "Ant Eta", 2.613071, -0.626418, 5.23 )
+STAR( "Aql 11", 4.970240, 0.237757, 5.23 )
+STAR( "Ara Kappa", 4.564036, -0.883723, 5.23 )
+STAR( "Aur Rho", 1.404146, 0.729625, 5.23 )
+STAR( "Dra 26", 4.603270, 1.079922, 5.23 )
+STAR( "Equ Epsilon", 5.493744, 0.074938, 5.23 )
+STAR( "Eri 20", 0.943743, -0.304856, 5.23 )
+STAR( "Eri 51", 1.211266, -0.043168, 5.23 )
+STAR( "Lyr 17", 5.006593, 0.567261, 5.23 )
+STAR( "Psc 91", 0.353967, 0.501574, 5.23 )
+STAR( "Psc Alpha", 0.532529, 0.048234, 5.23 )
+STAR( "Ser Omega", 4.146430, 0.038334, 5.23 )
+STAR( "Tau Psi", 1.077777, 0.506170, 5.23 )
+STAR( "Aqr 106", 6.214252, -0.318993, 5.24 )
+STAR( "Boo Phi", 4.092041, 0.704299, 5.24 )
+STAR( "Cap 41", 5.681105, -0.406012, 5.24 )
+STAR( "Cap Phi", 5.565993, -0.360440, 5.24 )
+STAR( "Cnc Kappa", 2.389996, 0.186193, 5.24 )
+STAR( "CrA Mu", 4.920709, -0.705220, 5.24 )
+STAR( "Cyg 71", 5.626287, 0.812286, 5.24 )
+STAR( "Dra 8", 3.383648, 1.142119, 5.24 )
+STAR( "Eri Tau7", 0.993354, -0.416693, 5.24 )
+STAR( "Her 45", 4.397241, 0.091572, 5.24 )
+STAR( "Hya 23", 2.429040, -0.110882, 5.24 )
+STAR( "Hya 56", 3.873526, -0.455313, 5.24 )
+STAR( "LMi 42", 2.818118, 0.535506, 5.24 )
+STAR( "Oph Tau", 4.725835, -0.142778, 5.24 )
+STAR( "Psc 107", 0.447226, 0.353754, 5.24 )
+STAR( "Psc Zeta", 0.321715, 0.132214, 5.24 )
+STAR( "Ret Eta", 1.142703, -1.106301, 5.24 )
+STAR( "Ret Zeta2", 0.864876, -1.090942, 5.24 )
+STAR( "Sex Epsilon", 2.694919, -0.140829, 5.24 )
+STAR( "Sgr 29", 4.929108, -0.354733, 5.24 )
+STAR( "Ara Iota", 4.552117, -0.828479, 5.25 )
+STAR( "Ara Pi", 4.616803, -0.951209, 5.25 )
+STAR( "Aur Psi5", 1.774731, 0.760571, 5.25 )
+STAR( "Boo 13", 3.701356, 0.863206, 5.25 )
+STAR( "CMi Delta1", 1.972651, 0.033413, 5.25 )
+STAR( "CMi Eta", 1.954921, 0.121160, 5.25 )
+STAR( "CVn 14", 3.428445, 0.624808, 5.25 )
+STAR( "Cap Pi", 5.355194, -0.317854, 5.25 )
+STAR( "Eri 24", 0.979602, -0.020299, 5.25 )
+STAR( "Gem 68", 1.979240, 0.276227, 5.25 )
+STAR( "Her 59", 4.457600, 0.585878, 5.25 )
+STAR( "Lac 12", 5.940563, 0.702068, 5.25 )
+STAR( "Lep 8", 1.411550, -0.243076, 5.25 )
+STAR( "Lyn 42", 2.523579, 0.702316, 5.25 )
+STAR( "Lyr Nu2", 4.930039, 0.568119, 5.25 )
+STAR( "Oph 23", 4.427006, -0.107406, 5.25 )
+STAR( "Scl Pi", 0.445684, -0.564212, 5.25 )
+STAR( "Scl Theta", 0.051196, -0.613187, 5.25 )
+STAR( "Vir 68", 3.519980, -0.221793, 5.25 )
+STAR( "Aqr 68", 5.967070, -0.342317, 5.26 )
+STAR( "Boo Chi", 3.990201, 0.509011, 5.26 )
+STAR( "Eri Rho3", 0.804044, -0.132660, 5.26 )
+STAR( "Hor Nu", 0.737511, -1.096183, 5.26 )
+STAR( "Leo 92", 3.057751, 0.372676, 5.26 )
+STAR( "Leo Nu", 2.610242, 0.217201, 5.26 )
+STAR( "Ori 45", 1.464586, -0.084750, 5.26 )
+STAR( "Ser 16", 4.086223, 0.174707, 5.26 )
+STAR( "Tau 58", 1.137104, 0.263462, 5.26 )
+STAR( "And 49", 0.393150, 0.820431, 5.27 )
+STAR( "Aps Delta2", 4.278006, -1.373002, 5.27 )
+STAR( "Aql Chi", 5.159920, 0.206414, 5.27 )
+STAR( "Ari Eta", 0.579457, 0.370199, 5.27 )
+STAR( "Aur 49", 1.724393, 0.489080, 5.27 )
+STAR( "Cep 20", 5.781440, 1.095815, 5.27 )
+STAR( "Dor Kappa", 1.240718, -1.042534, 5.27 )
+STAR( "Dra 64", 5.242424, 1.131342, 5.27 )
+STAR( "Gem 36", 1.795726, 0.379803, 5.27 )
+STAR( "Her 105", 4.796070, 0.426665, 5.27 )
+STAR( "Mon 7", 1.656812, -0.136538, 5.27 )
+STAR( "Ori 52", 1.518451, 0.112646, 5.27 )
+STAR( "Pyx Eta", 2.259634, -0.458236, 5.27 )
+STAR( "TrA Iota", 4.310767, -1.118024, 5.27 )
+STAR( "UMa 17", 2.425273, 0.990324, 5.27 )
+STAR( "UMa 31", 2.599304, 0.869523, 5.27 )
+STAR( "Aql Omega1", 5.051928, 0.202376, 5.28 )
+STAR( "Aql Phi", 5.219574, 0.199384, 5.28 )
+STAR( "Ari Tau1", 0.878017, 0.369084, 5.28 )
+STAR( "Cam 16", 1.411375, 1.004340, 5.28 )
+STAR( "Cap 29", 5.566502, -0.264791, 5.28 )
+STAR( "Cap Sigma", 5.320607, -0.333683, 5.28 )
+STAR( "Cas 40", 0.429853, 1.274788, 5.28 )
+STAR( "Cet 69", 0.619345, 0.006909, 5.28 )
+STAR( "Eri 35", 1.053888, -0.027048, 5.28 )
+STAR( "For Mu", 0.579922, -0.536233, 5.28 )
+STAR( "Her 96", 4.722796, 0.363615, 5.28 )
+STAR( "Hyi Mu", 0.661807, -1.380720, 5.28 )
+STAR( "Lyr Iota", 5.006048, 0.630069, 5.28 )
+STAR( "Oct Chi", 4.951419, -1.529010, 5.28 )
+STAR( "Oct Gamma3", 0.043786, -1.435078, 5.28 )
+STAR( "Per 43", 1.032399, 0.884800, 5.28 )
+STAR( "Tau Kappa2", 1.158099, 0.387458, 5.28 )
+STAR( "Tri 7", 0.593136, 0.582222, 5.28 )
+STAR( "Aqr 107", 6.222164, -0.325994, 5.29 )
+STAR( "Ara Epsilon2", 4.464320, -0.929160, 5.29 )
+STAR( "Boo 15", 3.729972, 0.176288, 5.29 )
+STAR( "CMa 11", 1.775225, -0.251778, 5.29 )
+STAR( "CMi 14", 2.087167, 0.038829, 5.29 )
+STAR( "CVn 3", 3.228037, 0.854935, 5.29 )
+STAR( "Cas 31", 0.308291, 1.200413, 5.29 )
+STAR( "Cep 18", 5.776523, 1.101647, 5.29 )
+STAR( "Com 17", 3.267744, 0.452263, 5.29 )
+STAR( "Gru Xi", 5.637843, -0.718712, 5.29 )
+STAR( "Ind Nu", 5.866982, -1.261097, 5.29 )
+STAR( "Oct Lambda", 5.719902, -1.443722, 5.29 )
+STAR( "Peg 12", 5.698820, 0.400534, 5.29 )
+STAR( "Peg 13", 5.716586, 0.301690, 5.29 )
+STAR( "Per 59", 1.234406, 0.756862, 5.29 )
+STAR( "Tau 133", 1.517193, 0.242596, 5.29 )
+STAR( "Tau 46", 1.106328, 0.134672, 5.29 )
+STAR( "Tri 12", 0.646499, 0.517829, 5.29 )
+STAR( "Vol Eta", 2.190708, -1.281072, 5.29 )
+STAR( "And 18", 6.192159, 0.880897, 5.3 )
+STAR( "And 62", 0.607724, 0.826937, 5.3 )
+STAR( "Aqr 32", 5.780487, -0.015824, 5.3 )
+STAR( "Ari 33", 0.701121, 0.472301, 5.3 )
+STAR( "CMi 1", 1.941548, 0.203675, 5.3 )
+STAR( "CMi 11", 2.034487, 0.187943, 5.3 )
+STAR( "Cam 4", 1.256659, 0.990600, 5.3 )
+STAR( "Cap Chi", 5.535137, -0.369898, 5.3 )
+STAR( "Cnc Mu2", 2.128269, 0.376671, 5.3 )
+STAR( "Dra 3", 3.065118, 1.164920, 5.3 )
+STAR( "Lep Nu", 1.396198, -0.214947, 5.3 )
+STAR( "Lib 12", 3.902273, -0.430088, 5.3 )
+STAR( "Mic Zeta", 5.510732, -0.674250, 5.3 )
+STAR( "Ori 72", 1.638071, 0.281749, 5.3 )
+STAR( "Peg 7", 5.682174, 0.099135, 5.3 )
+STAR( "Peg 82", 6.250977, 0.191070, 5.3 )
+STAR( "Sgr Theta2", 5.235355, -0.605590, 5.3 )
+STAR( "Tau 106", 1.343060, 0.356367, 5.3 )
+STAR( "Cet Phi3", 0.244455, -0.196640, 5.31 )
+STAR( "Col Nu2", 1.473683, -0.500725, 5.31 )
+STAR( "Cyg 70", 5.617153, 0.647808, 5.31 )
+STAR( "Gem 76", 2.025084, 0.450019, 5.31 )
+STAR( "Hor Eta", 0.686816, -0.917049, 5.31 )
+STAR( "Hya 14", 2.309776, -0.060093, 5.31 )
+STAR( "Lep 19", 1.604365, -0.334507, 5.31 )
+STAR( "Lib Mu", 3.880383, -0.246945, 5.31 )
+STAR( "Men Beta", 1.320851, -1.244672, 5.31 )
+STAR( "Pav Mu2", 5.244162, -1.168396, 5.31 )
+STAR( "Per 36", 0.926937, 0.803845, 5.31 )
+STAR( "Pic Lambda", 1.233831, -0.881066, 5.31 )
+STAR( "Scl Epsilon", 0.460971, -0.437249, 5.31 )
+STAR( "Scl Mu", 6.198697, -0.559780, 5.31 )
+STAR( "UMa 57", 3.006635, 0.686559, 5.31 )
+STAR( "Vul 33", 5.490253, 0.389659, 5.31 )
+STAR( "Aqr 41", 5.821982, -0.367814, 5.32 )
+STAR( "Cam 36", 1.626872, 1.147001, 5.32 )
+STAR( "Dra 9", 3.403036, 1.162341, 5.32 )
+STAR( "Eri Rho2", 0.797201, -0.134133, 5.32 )
+STAR( "Her 53", 4.419908, 0.553298, 5.32 )
+STAR( "Leo 22", 2.582578, 0.425778, 5.32 )
+STAR( "Leo 73", 2.949017, 0.232260, 5.32 )
+STAR( "Lyn 36", 2.416423, 0.754293, 5.32 )
+STAR( "Peg 64", 6.117008, 0.555233, 5.32 )
+STAR( "Peg 71", 6.167419, 0.392680, 5.32 )
+STAR( "Vir 4", 3.088862, 0.143917, 5.32 )
+STAR( "Vul 24", 5.309226, 0.430592, 5.32 )
+STAR( "And 32", 0.179420, 0.688683, 5.33 )
+STAR( "And 4", 6.054787, 0.809610, 5.33 )
+STAR( "Cnc Eta", 2.237112, 0.356765, 5.33 )
+STAR( "Lyn 14", 1.802423, 1.037574, 5.33 )
+STAR( "Oph 37", 4.504971, 0.184748, 5.33 )
+STAR( "Ori 5", 1.280112, 0.043774, 5.33 )
+STAR( "Ori 73", 1.639519, 0.219058, 5.33 )
+STAR( "Per 20", 0.757953, 0.669116, 5.33 )
+STAR( "Ser 3", 3.993270, 0.086210, 5.33 )
+STAR( "Ser Chi", 4.109334, 0.224231, 5.33 )
+STAR( "Tau 40", 1.063531, 0.094868, 5.33 )
+STAR( "UMa 61", 3.058908, 0.596932, 5.33 )
+STAR( "Vir 55", 3.465271, -0.347859, 5.33 )
+STAR( "Aql 20", 5.029508, -0.138569, 5.34 )
+STAR( "Aqr 103", 6.202791, -0.314634, 5.34 )
+STAR( "Aqr 42", 5.832898, -0.223950, 5.34 )
+STAR( "Cnc Pi2", 2.422648, 0.260776, 5.34 )
+STAR( "Leo 53", 2.832917, 0.184050, 5.34 )
+STAR( "Ori 14", 1.343387, 0.148324, 5.34 )
+STAR( "Ori 21", 1.392715, 0.045306, 5.34 )
+STAR( "Psc Psi1", 0.286590, 0.374780, 5.34 )
+STAR( "Sgr 7", 4.724832, -0.423805, 5.34 )
+STAR( "Cam 2", 1.221592, 0.933281, 5.35 )
+STAR( "Cam 40", 1.639199, 1.047183, 5.35 )
+STAR( "Cet 75", 0.663909, -0.018064, 5.35 )
+STAR( "Cnc Theta", 2.232254, 0.315808, 5.35 )
+STAR( "Dra 50", 4.914716, 1.316570, 5.35 )
+STAR( "For Pi", 0.529031, -0.523628, 5.35 )
+STAR( "Gem 85", 2.075480, 0.347039, 5.35 )
+STAR( "Her 54", 4.430387, 0.321722, 5.35 )
+STAR( "Hor Lambda", 0.632238, -1.052642, 5.35 )
+STAR( "LMi 23", 2.688854, 0.511566, 5.35 )
+STAR( "Leo Psi", 2.547010, 0.244724, 5.35 )
+STAR( "Lyn 13", 1.775109, 0.997790, 5.35 )
+STAR( "Oct Xi", 5.979418, -1.398431, 5.35 )
+STAR( "Oph 43", 4.552517, -0.491189, 5.35 )
+STAR( "Ori 55", 1.533126, -0.131215, 5.35 )
+STAR( "Ser 6", 4.018766, 0.012484, 5.35 )
+STAR( "Tau 29", 0.984686, 0.105592, 5.35 )
+STAR( "Tau 53", 1.131999, 0.369001, 5.35 )
+STAR( "Tel Nu", 5.183715, -0.983711, 5.35 )
+STAR( "Tri 15", 0.679718, 0.605411, 5.35 )
+STAR( "UMa 74", 3.272296, 1.019374, 5.35 )
+STAR( "Aur 40", 1.599529, 0.671651, 5.36 )
+STAR( "Aur 45", 1.665779, 0.932917, 5.36 )
+STAR( "Cam 37", 1.614364, 1.028624, 5.36 )
+STAR( "Cha Iota", 2.461576, -1.409998, 5.36 )
+STAR( "Cyg 27", 5.263753, 0.627839, 5.36 )
+STAR( "LMi 20", 2.622408, 0.557172, 5.36 )
+STAR( "Lyn 22", 1.963205, 0.866949, 5.36 )
+STAR( "Ori 38", 1.458564, 0.065746, 5.36 )
+STAR( "Psc 55", 0.174213, 0.374170, 5.36 )
+STAR( "Sge 10", 5.218629, 0.290331, 5.36 )
+STAR( "Vir 84", 3.591284, 0.061751, 5.36 )
+STAR( "Vir Omega", 3.047607, 0.141968, 5.36 )
+STAR( "Aqr Rho", 5.847718, -0.136504, 5.37 )
+STAR( "Boo 50", 4.022155, 0.574805, 5.37 )
+STAR( "Cyg 60", 5.502943, 0.805571, 5.37 )
+STAR( "Gru Kappa", 6.041719, -0.941867, 5.37 )
+STAR( "Her 2", 4.165366, 0.752911, 5.37 )
+STAR( "Her 82", 4.610404, 0.847978, 5.37 )
+STAR( "LMi 8", 2.493814, 0.612664, 5.37 )
+STAR( "Lup Upsilon", 4.034976, -0.693075, 5.37 )
+STAR( "Lyn 34", 2.273371, 0.799952, 5.37 )
+STAR( "Lyr Epsilon2", 4.906041, 0.691373, 5.37 )
+STAR( "Peg 30", 5.848860, 0.101045, 5.37 )
+STAR( "Psc 41", 0.089877, 0.142947, 5.37 )
+STAR( "Sge 13", 5.236228, 0.305724, 5.37 )
+STAR( "Sgr 28", 4.914600, -0.390818, 5.37 )
+STAR( "Tau Chi", 1.145729, 0.447313, 5.37 )
+STAR( "Tuc Iota", 0.293703, -1.078182, 5.37 )
+STAR( "Vir 63", 3.503828, -0.309539, 5.37 )
+STAR( "Vir 7", 3.141367, 0.063797, 5.37 )
+STAR( "Vol Kappa1", 2.180862, -1.248172, 5.37 )
+STAR( "Cas 47", 0.545954, 1.348815, 5.38 )
+STAR( "Cet 95", 0.865567, -0.016236, 5.38 )
+STAR( "Cyg 9", 5.126243, 0.514227, 5.38 )
+STAR( "Del Eta", 5.384123, 0.227368, 5.38 )
+STAR( "Dor Pi2", 1.681959, -1.216325, 5.38 )
+STAR( "Dra 51", 4.995656, 0.931948, 5.38 )
+STAR( "Eri 63", 1.308299, -0.179129, 5.38 )
+STAR( "Lib 41", 4.096760, -0.336882, 5.38 )
+STAR( "Pic Eta1", 1.321258, -0.857854, 5.38 )
+STAR( "Psc 52", 0.142208, 0.354205, 5.38 )
+STAR( "Psc 57", 0.203113, 0.270099, 5.38 )
+STAR( "Psc Rho", 0.376358, 0.334618, 5.38 )
+STAR( "Sgr 15", 4.778777, -0.361778, 5.38 )
+STAR( "Tau 121", 1.463684, 0.419567, 5.38 )
+STAR( "Tau 56", 1.132770, 0.380021, 5.38 )
+STAR( "Aql 51", 5.195758, -0.187860, 5.39 )
+STAR( "Boo 22", 3.780630, 0.335573, 5.39 )
+STAR( "Boo 33", 3.834648, 0.775004, 5.39 )
+STAR( "Cnc 57", 2.331084, 0.533712, 5.39 )
+STAR( "CrB Nu2", 4.286907, 0.588239, 5.39 )
+STAR( "Cyg 51", 5.420164, 0.878599, 5.39 )
+STAR( "Dra 66", 5.260190, 1.082027, 5.39 )
+STAR( "For Gamma2", 0.741343, -0.487674, 5.39 )
+STAR( "Her 72", 4.540736, 0.566670, 5.39 )
+STAR( "Her Alpha2", 4.514527, 0.251153, 5.39 )
+STAR( "Leo 79", 2.984680, 0.024570, 5.39 )
+STAR( "Ori 75", 1.645453, 0.173529, 5.39 )
+STAR( "Peg 58", 6.065128, 0.171425, 5.39 )
+STAR( "Ser 60", 4.841907, -0.034650, 5.39 )
+STAR( "Tuc Rho", 0.185325, -1.142633, 5.39 )
+STAR( "And 55", 0.494314, 0.710868, 5.4 )
+STAR( "Aur 26", 1.477574, 0.532195, 5.4 )
+STAR( "Cas 12", 0.108174, 1.079156, 5.4 )
+STAR( "Cyg 14", 5.146285, 0.747321, 5.4 )
+STAR( "Mon Beta", 1.696569, -0.122774, 5.4 )
+STAR( "Psc 5", 6.059267, 0.037137, 5.4 )
+STAR( "Ser 25", 4.128111, -0.031493, 5.4 )
+STAR( "Tau 83", 1.180810, 0.239537, 5.4 )
+STAR( "Vol Iota", 1.795289, -1.238544, 5.4 )
+STAR( "Aps Iota", 4.547012, -1.223883, 5.41 )
+STAR( "Boo 18", 3.749280, 0.226966, 5.41 )
+STAR( "Cap 33", 5.603205, -0.363935, 5.41 )
+STAR( "Cas 23", 0.208429, 1.306335, 5.41 )
+STAR( "Cet 39", 0.334252, -0.043638, 5.41 )
+STAR( "Cet 57", 0.522588, -0.363455, 5.41 )
+STAR( "Cnc 60", 2.338421, 0.202914, 5.41 )
+STAR( "CrB Rho", 4.193350, 0.581258, 5.41 )
+STAR( "Hor Iota", 0.709295, -0.886632, 5.41 )
+STAR( "LMi 11", 2.511791, 0.625007, 5.41 )
+STAR( "Leo 37", 2.690767, 0.239605, 5.41 )
+STAR( "Leo Omega", 2.480367, 0.158069, 5.41 )
+STAR( "Lib Eta", 4.119297, -0.273542, 5.41 )
+STAR( "Pav Sigma", 5.451107, -1.200374, 5.41 )
+STAR( "Scl Kappa2", 0.050498, -0.485197, 5.41 )
+STAR( "Tau 44", 1.094460, 0.462178, 5.41 )
+STAR( "Vul 35", 5.618513, 0.481861, 5.41 )
+STAR( "Aql 14", 4.986878, -0.064558, 5.42 )
+STAR( "Aql 15", 4.995830, -0.070361, 5.42 )
+STAR( "Cam 17", 1.440638, 1.100731, 5.42 )
+STAR( "Cet 50", 0.418806, -0.268786, 5.42 )
+STAR( "Cet 70", 0.620494, -0.015446, 5.42 )
+STAR( "Leo 69", 2.939833, -0.001217, 5.42 )
+STAR( "Oct Zeta", 2.341730, -1.495102, 5.42 )
+STAR( "PsA Eta", 5.763237, -0.496609, 5.42 )
+STAR( "Psc 68", 0.252360, 0.506010, 5.42 )
+STAR( "Scl Kappa1", 0.040797, -0.488479, 5.42 )
+STAR( "Tau 115", 1.427541, 0.313500, 5.42 )
+STAR( "Vir 106", 3.790397, -0.120437, 5.42 )
+STAR( "Aqr 83", 6.043915, -0.134279, 5.43 )
+STAR( "Ari Nu", 0.692968, 0.383299, 5.43 )
+STAR( "Cap 30", 5.576131, -0.313902, 5.43 )
+STAR( "Cas 6", 6.234476, 1.085847, 5.43 )
+STAR( "Cet 25", 0.275078, -0.084416, 5.43 )
+STAR( "Cet 60", 0.537540, 0.002240, 5.43 )
+STAR( "Cnc Tau", 2.391108, 0.517563, 5.43 )
+STAR( "Del Iota", 5.401001, 0.198580, 5.43 )
+STAR( "Dra 7", 3.349170, 1.165710, 5.43 )
+STAR( "Ori 16", 1.349692, 0.171556, 5.43 )
+STAR( "Per 14", 0.715963, 0.773128, 5.43 )
+STAR( "PsA Lambda", 5.822040, -0.484625, 5.43 )
+STAR( "Psc 2", 6.019015, 0.016804, 5.43 )
+STAR( "Sco 16", 4.241681, -0.149182, 5.43 )
+STAR( "Sgr Chi3", 5.085431, -0.418220, 5.43 )
+STAR( "Vir 87", 3.610315, -0.311716, 5.43 )
+STAR( "Vul 2", 5.051536, 0.401872, 5.43 )
+STAR( "And 11", 6.106456, 0.848671, 5.44 )
+STAR( "Cep 7", 5.618949, 1.166040, 5.44 )
+STAR( "Cyg Omega2", 5.372618, 0.859056, 5.44 )
+STAR( "Eri 37", 1.092467, -0.120845, 5.44 )
+STAR( "Gem 28", 1.766091, 0.505636, 5.44 )
+STAR( "Gem 45", 1.869102, 0.278045, 5.44 )
+STAR( "Sgr 14", 4.774632, -0.378964, 5.44 )
+STAR( "Cha Nu", 2.558405, -1.339996, 5.45 )
+STAR( "Cnc Nu", 2.368143, 0.426781, 5.45 )
+STAR( "Cnc Sigma2", 2.342857, 0.574393, 5.45 )
+STAR( "CrB Lambda", 4.170435, 0.662299, 5.45 )
+STAR( "Dra Psi2", 4.691387, 1.256724, 5.45 )
+STAR( "Eri 4", 0.774032, -0.416469, 5.45 )
+STAR( "Lyn 19", 1.932378, 0.964842, 5.45 )
+STAR( "Lyn 26", 2.071320, 0.830161, 5.45 )
+STAR( "Men Theta", 1.817644, -1.386145, 5.45 )
+STAR( "Mon 21", 1.882309, -0.005270, 5.45 )
+STAR( "Nor Lambda", 4.272981, -0.744800, 5.45 )
+STAR( "Peg 5", 5.662532, 0.337173, 5.45 )
+STAR( "Pic Zeta", 1.393507, -0.883243, 5.45 )
+STAR( "Tuc Lambda2", 0.240005, -1.213474, 5.45 )
+STAR( "Aql 42", 5.139071, -0.081114, 5.46 )
+STAR( "Aqr 38", 5.805947, -0.201847, 5.46 )
+STAR( "Cep 26", 5.877782, 1.136772, 5.46 )
+STAR( "Com 21", 3.276899, 0.428779, 5.46 )
+STAR( "Com 26", 3.312293, 0.367610, 5.46 )
+STAR( "Crv 3", 3.189873, -0.411941, 5.46 )
+STAR( "Dra 75", 5.359223, 1.421096, 5.46 )
+STAR( "Her 89", 4.692405, 0.454658, 5.46 )
+STAR( "Hya 20", 2.398046, -0.153376, 5.46 )
+STAR( "Leo 46", 2.758478, 0.246741, 5.46 )
+STAR( "Lib Xi2", 3.912890, -0.199137, 5.46 )
+STAR( "Oct Iota", 3.381474, -1.485682, 5.46 )
+STAR( "Ori 33", 1.445314, 0.057460, 5.46 )
+STAR( "Tau 16", 0.980890, 0.423931, 5.46 )
+STAR( "Tau 93", 1.221978, 0.212891, 5.46 )
+STAR( "UMa 82", 3.575772, 0.923652, 5.46 )
+STAR( "Vir 95", 3.694484, -0.162548, 5.46 )
+STAR( "And 36", 0.239837, 0.412392, 5.47 )
+STAR( "Aql 66", 5.293722, -0.017618, 5.47 )
+STAR( "Ari Xi", 0.631882, 0.185189, 5.47 )
+STAR( "Aur Omicron", 1.509273, 0.869635, 5.47 )
+STAR( "Cha Delta1", 2.815485, -1.404462, 5.47 )
+STAR( "Cha Eta", 2.274709, -1.378170, 5.47 )
+STAR( "For Eta3", 0.744703, -0.622666, 5.47 )
+STAR( "Gru Nu", 5.884610, -0.682981, 5.47 )
+STAR( "Her Rho", 4.553906, 0.648332, 5.47 )
+STAR( "Hya 24", 2.429011, -0.152624, 5.47 )
+STAR( "Lib 49", 4.190216, -0.288561, 5.47 )
+STAR( "Men Eta", 1.287995, -1.307896, 5.47 )
+STAR( "Men Kappa", 1.528378, -1.385118, 5.47 )
+STAR( "Oct Phi", 4.815371, -1.309768, 5.47 )
+STAR( "Oct Sigma", 5.536053, -1.552582, 5.47 )
+STAR( "Per 30", 0.863022, 0.768381, 5.47 )
+STAR( "Tau 118", 1.436733, 0.438960, 5.47 )
+STAR( "Tau 36", 1.066229, 0.420726, 5.47 )
+STAR( "UMa 2", 2.245381, 1.136995, 5.47 )
+STAR( "Com 18", 3.270085, 0.420779, 5.48 )
+STAR( "Crt Iota", 3.048516, -0.230417, 5.48 )
+STAR( "Del 18", 5.490944, 0.189179, 5.48 )
+STAR( "Dra 49", 4.977345, 0.971421, 5.48 )
+STAR( "Eri 30", 1.015316, -0.093574, 5.48 )
+STAR( "Her 112", 4.940474, 0.373942, 5.48 )
+STAR( "Her 9", 4.246633, 0.087635, 5.48 )
+STAR( "Leo 52", 2.820547, 0.247745, 5.48 )
+STAR( "Peg 37", 5.890341, 0.077347, 5.48 )
+STAR( "Pup 5", 2.041795, -0.212809, 5.48 )
+STAR( "Sco 27", 4.438307, -0.580487, 5.48 )
+STAR( "Tau 81", 1.180926, 0.273876, 5.48 )
+STAR( "UMi 19", 4.236023, 1.324312, 5.48 )
+STAR( "Vir 21", 3.288986, -0.164968, 5.48 )
+STAR( "Aps Kappa1", 4.064494, -1.280887, 5.49 )
+STAR( "Aql 27", 5.064051, -0.015572, 5.49 )
+STAR( "Aqr 18", 5.603343, -0.224764, 5.49 )
+STAR( "Aqr 21", 5.608106, -0.062076, 5.49 )
+STAR( "Ari Sigma", 0.748281, 0.263230, 5.49 )
+STAR( "CrA Eta1", 4.925501, -0.762360, 5.49 )
+STAR( "Her 47", 4.408367, 0.126498, 5.49 )
+STAR( "Leo 51", 2.820488, 0.329717, 5.49 )
+STAR( "Oct Tau", 6.143828, -1.526853, 5.49 )
+STAR( "Pav Iota", 4.757920, -1.082143, 5.49 )
+STAR( "Peg 51", 6.010325, 0.362485, 5.49 )
+STAR( "Psc 20", 6.230571, -0.048200, 5.49 )
+STAR( "Sgr 24", 4.860269, -0.419446, 5.49 )
+STAR( "Tau 130", 1.515978, 0.309432, 5.49 )
+STAR( "Vul 10", 5.164931, 0.449805, 5.49 )
+STAR( "Vul 19", 5.287475, 0.467903, 5.49 )
+STAR( "Aps Theta", 3.688448, -1.340355, 5.5 )
+STAR( "Ari 64", 0.891463, 0.431518, 5.5 )
+STAR( "Cep Rho2", 5.889970, 1.375741, 5.5 )
+STAR( "Cnc 27", 2.211034, 0.220862, 5.5 )
+STAR( "Col Pi2", 1.605187, -0.735724, 5.5 )
+STAR( "Col Sigma", 1.554863, -0.547728, 5.5 )
+STAR( "LMi 28", 2.723339, 0.588501, 5.5 )
+STAR( "Lib Zeta4", 4.070631, -0.294136, 5.5 )
+STAR( "Psc 58", 0.205185, 0.208984, 5.5 )
+STAR( "Psc 94", 0.378278, 0.335806, 5.5 )
+STAR( "Psc Sigma", 0.274097, 0.555092, 5.5 )
+STAR( "Scl Sigma", 0.272446, -0.550685, 5.5 )
+STAR( "Sco 18", 4.256953, -0.146074, 5.5 )
+STAR( "Tau 103", 1.344383, 0.423509, 5.5 )
+STAR( "Tau 116", 1.430123, 0.277056, 5.5 )
+STAR( "Tau Omega1", 1.087195, 0.342245, 5.5 )
+STAR( "Tri Epsilon", 0.536543, 0.580913, 5.5 )
+STAR( "Aqr 7", 5.484261, -0.169253, 5.51 )
+STAR( "Cet 67", 0.597703, -0.112089, 5.51 )
+STAR( "CrB Omicron", 4.014875, 0.516899, 5.51 )
+STAR( "Cyg 49", 5.415073, 0.563867, 5.51 )
+STAR( "Eri 58", 1.254914, -0.295562, 5.51 )
+STAR( "Eri 62", 1.293304, -0.090258, 5.51 )
+STAR( "LMi 40", 2.805748, 0.459468, 5.51 )
+STAR( "Mus Theta", 3.438808, -1.139812, 5.51 )
+STAR( "Oct Psi", 5.837435, -1.352834, 5.51 )
+STAR( "Oph 21", 4.413130, 0.021225, 5.51 )
+STAR( "Peg 86", 0.024871, 0.233806, 5.51 )
+STAR( "Per 50", 1.084766, 0.663918, 5.51 )
+STAR( "Phe Lambda2", 0.155705, -0.837773, 5.51 )
+STAR( "Psc 34", 0.043800, 0.194527, 5.51 )
+STAR( "Ser 11", 4.070828, -0.020706, 5.51 )
+STAR( "Tuc Pi", 0.090103, -1.215185, 5.51 )
+STAR( "Vir 86", 3.603836, -0.216886, 5.51 )
+STAR( "Aql Tau", 5.254045, 0.127026, 5.52 )
+STAR( "Ari 62", 0.882257, 0.481842, 5.52 )
+STAR( "Cam 5", 1.287406, 0.964454, 5.52 )
+STAR( "Cep 12", 5.704703, 1.059289, 5.52 )
+STAR( "Cha Mu1", 2.621172, -1.434918, 5.52 )
+STAR( "Gru Omicron", 6.137494, -0.920167, 5.52 )
+STAR( "Her 83", 4.635914, 0.428726, 5.52 )
+STAR( "Hyi Iota", 0.855037, -1.350681, 5.52 )
+STAR( "Leo 65", 2.909915, 0.034131, 5.52 )
+STAR( "Leo 86", 3.012802, 0.321310, 5.52 )
+STAR( "Per 1", 0.488641, 0.962505, 5.52 )
+STAR( "Psc 80", 0.298320, 0.098606, 5.52 )
+STAR( "Tau 135", 1.529265, 0.249679, 5.52 )
+STAR( "TrA Theta", 4.344764, -1.143108, 5.52 )
+STAR( "Vul 18", 5.282057, 0.469566, 5.52 )
+STAR( "Aql 28", 5.059949, 0.215980, 5.53 )
+STAR( "Aqr 49", 5.862190, -0.432187, 5.53 )
+STAR( "Cet 80", 0.680678, -0.136688, 5.53 )
+STAR( "Dra 16", 4.346706, 0.923284, 5.53 )
+STAR( "Eri 22", 0.962716, -0.090941, 5.53 )
+STAR( "Gru Phi", 6.100646, -0.712521, 5.53 )
+STAR( "Hyi Theta", 0.795245, -1.254935, 5.53 )
+STAR( "Ind Omicron", 5.719379, -1.215263, 5.53 )
+STAR( "Leo 95", 3.122721, 0.273086, 5.53 )
+STAR( "Men Epsilon", 1.944442, -1.380454, 5.53 )
+STAR( "Mic Eta", 5.525821, -0.722324, 5.53 )
+STAR( "Peg 15", 5.726854, 0.502538, 5.53 )
+STAR( "Peg 75", 6.186959, 0.321150, 5.53 )
+STAR( "Peg 87", 0.039444, 0.317858, 5.53 )
+STAR( "Sge 11", 5.226199, 0.293026, 5.53 )
+STAR( "Tau 72", 1.166280, 0.401363, 5.53 )
+STAR( "Aqr 30", 5.773869, -0.113839, 5.54 )
+STAR( "Boo 14", 3.726656, 0.226185, 5.54 )
+STAR( "Cet 66", 0.579413, -0.041776, 5.54 )
+STAR( "For Rho", 0.994547, -0.526527, 5.54 )
+STAR( "Her 25", 4.299633, 0.652646, 5.54 )
+STAR( "Hya 15", 2.319433, -0.125266, 5.54 )
+STAR( "Men Mu", 1.235104, -1.237981, 5.54 )
+STAR( "Peg 17", 5.746235, 0.210773, 5.54 )
+STAR( "Pup 18", 2.140923, -0.240841, 5.54 )
+STAR( "Ret Zeta1", 0.862934, -1.092145, 5.54 )
+STAR( "Ser Phi", 4.176762, 0.251580, 5.54 )
+STAR( "Tau 122", 1.470716, 0.297409, 5.54 )
+STAR( "Tri 11", 0.643423, 0.555039, 5.54 )
+STAR( "Vul 25", 5.332228, 0.426665, 5.54 )
+STAR( "Aqr 5", 5.463513, -0.096114, 5.55 )
+STAR( "Aqr 96", 6.106034, -0.089438, 5.55 )
+STAR( "Aur 48", 1.695449, 0.532204, 5.55 )
+STAR( "Cnc 3", 2.097835, 0.302092, 5.55 )
+STAR( "Eri 25", 0.981493, -0.005178, 5.55 )
+STAR( "Hyi Pi1", 0.585754, -1.184060, 5.55 )
+STAR( "Lep 10", 1.444813, -0.364139, 5.55 )
+STAR( "Lib 50", 4.192252, -0.146806, 5.55 )
+STAR( "Psc 22", 6.248126, 0.051143, 5.55 )
+STAR( "Psc Psi2", 0.296502, 0.361967, 5.55 )
+STAR( "Psc Psi3", 0.304647, 0.343107, 5.55 )
+STAR( "UMa 70", 3.232553, 1.009915, 5.55 )
+STAR( "Vir 75", 3.546778, -0.268136, 5.55 )
+STAR( "Ant Delta", 2.747105, -0.534197, 5.56 )
+STAR( "Aqr 77", 5.998515, -0.283999, 5.56 )
+STAR( "Boo 32", 3.847251, 0.203515, 5.56 )
+STAR( "Cep 14", 5.768648, 1.012301, 5.56 )
+STAR( "CrB Pi", 4.118926, 0.567508, 5.56 )
+STAR( "Dor Pi1", 1.669567, -1.221454, 5.56 )
+STAR( "Eri 5", 0.784031, -0.043022, 5.56 )
+STAR( "Gem 70", 2.000787, 0.611714, 5.56 )
+STAR( "Hya 33", 2.506925, -0.103236, 5.56 )
+STAR( "Ori 18", 1.379108, 0.197945, 5.56 )
+STAR( "Psc Psi1", 0.286649, 0.374640, 5.56 )
+STAR( "Boo 47", 3.950684, 0.840395, 5.57 )
+STAR( "Cas 32", 0.312807, 1.134794, 5.57 )
+STAR( "Cnc Phi1", 2.209856, 0.486835, 5.57 )
+STAR( "Com 5", 3.194629, 0.358525, 5.57 )
+STAR( "Leo 81", 2.991523, 0.287218, 5.57 )
+STAR( "Nor Iota2", 4.229413, -1.011147, 5.57 )
+STAR( "Oct Rho", 4.115835, -1.474197, 5.57 )
+STAR( "Peg 67", 6.129800, 0.565225, 5.57 )
+STAR( "Psc Pi", 0.423671, 0.211912, 5.57 )
+STAR( "Ser 64", 4.962306, 0.044249, 5.57 )
+STAR( "Tau 12", 0.959284, 0.053354, 5.57 )
+STAR( "And 47", 0.365108, 0.658251, 5.58 )
+STAR( "Aqr 28", 5.764313, 0.010559, 5.58 )
+STAR( "Ari 21", 0.592161, 0.437084, 5.58 )
+STAR( "Cap Lambda", 5.700834, -0.198371, 5.58 )
+STAR( "Cas 53", 0.536711, 1.123818, 5.58 )
+STAR( "Cep 4", 5.424411, 1.163393, 5.58 )
+STAR( "Cet 28", 0.288350, -0.171731, 5.58 )
+STAR( "CrB Eta", 4.028242, 0.528621, 5.58 )
+STAR( "Cyg 36", 5.316607, 0.645772, 5.58 )
+STAR( "Del 13", 5.444576, 0.104865, 5.58 )
+STAR( "Del 16", 5.478778, 0.219364, 5.58 )
+STAR( "LMi 34", 2.764231, 0.610666, 5.58 )
+STAR( "Lyr Delta1", 4.946816, 0.645277, 5.58 )
+STAR( "Oct Kappa", 3.581961, -1.497250, 5.58 )
+STAR( "Oph 24", 4.436627, -0.404044, 5.58 )
+STAR( "Peg 36", 5.886705, 0.159329, 5.58 )
+STAR( "Peg Pi1", 5.799845, 0.578964, 5.58 )
+STAR( "Tau 80", 1.178723, 0.272936, 5.58 )
+STAR( "UMa 42", 2.842247, 1.035329, 5.58 )
+STAR( "UMa 6", 2.341468, 1.127551, 5.58 )
+STAR( "Vir 6", 3.120001, 0.147374, 5.58 )
+STAR( "And 15", 6.172466, 0.702257, 5.59 )
+STAR( "And 63", 0.615098, 0.875307, 5.59 )
+STAR( "Aql 22", 5.046256, 0.084382, 5.59 )
+STAR( "Boo 24", 3.790113, 0.869955, 5.59 )
+STAR( "CMi Delta2", 1.977429, 0.057426, 5.59 )
+STAR( "Cas 10", 0.028107, 1.120434, 5.59 )
+STAR( "Cas 43", 0.446550, 1.187575, 5.59 )
+STAR( "Her 74", 4.539390, 0.807055, 5.59 )
+STAR( "Hya 2", 2.209820, -0.069595, 5.59 )
+STAR( "Hya 28", 2.467023, -0.089317, 5.59 )
+STAR( "Lac 16", 6.005649, 0.726125, 5.59 )
+STAR( "Peg 63", 6.112259, 0.530842, 5.59 )
+STAR( "Pyx Epsilon", 2.399566, -0.529974, 5.59 )
+STAR( "Scl Xi", 0.267494, -0.679224, 5.59 )
+STAR( "Sgr 50", 5.089031, -0.380075, 5.59 )
+STAR( "Sgr Kappa1", 5.333981, -0.733906, 5.59 )
+STAR( "Tau 137", 1.537511, 0.247342, 5.59 )
+STAR( "Tau 57", 1.134297, 0.244962, 5.59 )
+STAR( "UMa 59", 3.047098, 0.761410, 5.59 )
+STAR( "Vir 31", 3.324641, 0.118799, 5.59 )
+STAR( "Vul 27", 5.397773, 0.461848, 5.59 )
+STAR( "CVn 23", 3.492040, 0.700759, 5.6 )
+STAR( "CVn Alpha1", 3.385968, 0.668718, 5.6 )
+STAR( "Com 40", 3.431215, 0.394726, 5.6 )
+STAR( "Hya 19", 2.394170, -0.149914, 5.6 )
+STAR( "Mon Beta", 1.696569, -0.122774, 5.6 )
+STAR( "Peg 20", 5.764343, 0.228982, 5.6 )
+STAR( "Sgr 18", 4.821581, -0.536805, 5.6 )
+STAR( "UMa 81", 3.552276, 0.966016, 5.6 )
+STAR( "Vir 83", 3.597545, -0.282380, 5.6 )
+STAR( "Aql 58", 5.213066, 0.004775, 5.61 )
+STAR( "Cet 93", 0.795761, 0.075970, 5.61 )
+STAR( "Cet Phi4", 0.256265, -0.198618, 5.61 )
+STAR( "CrA Eta2", 4.928737, -0.758064, 5.61 )
+STAR( "Equ 3", 5.517764, 0.096042, 5.61 )
+STAR( "Gru Upsilon", 6.051464, -0.678797, 5.61 )
+STAR( "Hya 1", 2.201660, -0.065469, 5.61 )
+STAR( "Leo 44", 2.728182, 0.153322, 5.61 )
+STAR( "Ori Lambda", 1.462331, 0.173398, 5.61 )
+STAR( "Pic Iota", 1.269378, -0.933077, 5.61 )
+STAR( "Pic Nu", 1.670847, -0.983842, 5.61 )
+STAR( "Ari Theta", 0.602684, 0.347340, 5.62 )
+STAR( "Boo 2", 3.582456, 0.392626, 5.62 )
+STAR( "Cyg 40", 5.356292, 0.670909, 5.62 )
+STAR( "Gru Pi2", 5.860525, -0.801605, 5.62 )
+STAR( "Her 78", 4.589460, 0.495804, 5.62 )
+STAR( "Ind Kappa2", 5.785105, -1.040846, 5.62 )
+STAR( "Lup Xi2", 4.175278, -0.592787, 5.62 )
+STAR( "Lyn 43", 2.539476, 0.693904, 5.62 )
+STAR( "Sco 4", 4.169163, -0.458425, 5.62 )
+STAR( "And 59", 0.571072, 0.681367, 5.63 )
+STAR( "Ari 10", 0.539547, 0.452661, 5.63 )
+STAR( "Ari Rho3", 0.769843, 0.314562, 5.63 )
+STAR( "Cet 49", 0.412901, -0.273600, 5.63 )
+STAR( "Cet 64", 0.573130, 0.149570, 5.63 )
+STAR( "Cnc Zeta1", 2.147679, 0.308012, 5.63 )
+STAR( "Her 108", 4.803808, 0.521136, 5.63 )
+STAR( "Her 28", 4.331013, 0.096362, 5.63 )
+STAR( "Hya 55", 3.871904, -0.447231, 5.63 )
+STAR( "Leo 18", 2.558602, 0.206123, 5.63 )
+STAR( "Ori 66", 1.592497, 0.072581, 5.63 )
+STAR( "Peg 73", 6.172517, 0.584637, 5.63 )
+STAR( "Psc 32", 0.010886, 0.148101, 5.63 )
+STAR( "Ser 4", 3.996011, 0.006497, 5.63 )
+STAR( "Ser 45", 4.222061, 0.172642, 5.63 )
+STAR( "Tau 32", 1.033533, 0.392316, 5.63 )
+STAR( "Vul 5", 5.088595, 0.350772, 5.63 )
+STAR( "Boo 40", 3.925311, 0.685308, 5.64 )
+STAR( "Cnc 15", 2.151766, 0.517606, 5.64 )
+STAR( "Cnc 45", 2.282912, 0.221322, 5.64 )
+STAR( "CrB Sigma", 4.252844, 0.590944, 5.64 )
+STAR( "Leo 15", 2.546239, 0.523153, 5.64 )
+STAR( "Lib Zeta1", 4.050284, -0.291756, 5.64 )
+STAR( "Lyn 29", 2.172237, 1.039712, 5.64 )
+STAR( "Men Zeta", 1.745526, -1.410464, 5.64 )
+STAR( "Ori 35", 1.456935, 0.249679, 5.64 )
+STAR( "Peg 11", 5.703881, 0.046881, 5.64 )
+STAR( "Sge 1", 5.040904, 0.370572, 5.64 )
+STAR( "Sgr Kappa2", 5.340213, -0.740417, 5.64 )
+STAR( "Tau 18", 0.982453, 0.433525, 5.64 )
+STAR( "Tau 63", 1.149372, 0.292818, 5.64 )
+STAR( "UMa Pi1", 2.265416, 1.134828, 5.64 )
+STAR( "And 44", 0.306800, 0.734459, 5.65 )
+STAR( "Aps Kappa2", 4.103065, -1.281886, 5.65 )
+STAR( "Cet 81", 0.688082, -0.059273, 5.65 )
+STAR( "Cha Pi", 3.042371, -1.324647, 5.65 )
+STAR( "CrA Kappa2", 4.858059, -0.675898, 5.65 )
+STAR( "Cyg 79", 5.687279, 0.668180, 5.65 )
+STAR( "Gem 35", 1.790817, 0.234107, 5.65 )
+STAR( "Hya 59", 3.921115, -0.482710, 5.65 )
+STAR( "Lup Nu2", 4.022126, -0.843304, 5.65 )
+STAR( "Men Pi", 1.471153, -1.404452, 5.65 )
+STAR( "Oct Pi1", 3.935048, -1.452599, 5.65 )
+STAR( "Oct Pi2", 3.947840, -1.449292, 5.65 )
+STAR( "Peg 19", 5.764619, 0.144116, 5.65 )
+STAR( "Peg 38", 5.890617, 0.568497, 5.65 )
+STAR( "Sex 18", 2.665685, -0.146928, 5.65 )
+STAR( "Sgr 51", 5.131392, -0.431431, 5.65 )
+STAR( "Tau 51", 1.127425, 0.376628, 5.65 )
+STAR( "Vir 71", 3.530874, 0.188816, 5.65 )
+STAR( "Vol Kappa2", 2.181712, -1.248003, 5.65 )
+STAR( "Aqr Tau1", 5.967775, -0.245330, 5.66 )
+STAR( "CVn 2", 3.211959, 0.709656, 5.66 )
+STAR( "Cas 21", 0.199186, 1.308788, 5.66 )
+STAR( "Cet 47", 0.378998, -0.227882, 5.66 )
+STAR( "Cnc 49", 2.289654, 0.175958, 5.66 )
+STAR( "Cnc Sigma1", 2.323804, 0.566781, 5.66 )
+STAR( "Com 4", 3.193313, 0.451522, 5.66 )
+STAR( "Dra 48", 4.960008, 1.009062, 5.66 )
+STAR( "Sge Epsilon", 5.136897, 0.287330, 5.66 )
+STAR( "And 56", 0.506822, 0.650164, 5.67 )
+STAR( "Aql 45", 5.151870, -0.010840, 5.67 )
+STAR( "Aqr 26", 5.681781, 0.022432, 5.67 )
+STAR( "Boo 46", 3.963628, 0.459041, 5.67 )
+STAR( "Cnc Omicron2", 2.345664, 0.271947, 5.67 )
+STAR( "Leo 49", 2.770870, 0.150976, 5.67 )
+STAR( "Ori 63", 1.592482, 0.094597, 5.67 )
+STAR( "Peg 4", 5.665913, 0.100735, 5.67 )
+STAR( "Psc 51", 0.141357, 0.121397, 5.67 )
+STAR( "Sco 12", 4.242306, -0.495979, 5.67 )
+STAR( "Tau 31", 1.012306, 0.114052, 5.67 )
+STAR( "UMa 43", 2.841331, 0.987546, 5.67 )
+STAR( "Vir 33", 3.343942, 0.166504, 5.67 )
+STAR( "Vul 14", 5.232388, 0.403195, 5.67 )
+STAR( "Aql 62", 5.255128, -0.012382, 5.68 )
+STAR( "Ari 31", 0.683435, 0.217250, 5.68 )
+STAR( "Com 25", 3.302912, 0.298267, 5.68 )
+STAR( "Crv 6", 3.243520, -0.433549, 5.68 )
+STAR( "Dra 41", 4.713058, 1.396336, 5.68 )
+STAR( "Gem 41", 1.833745, 0.280630, 5.68 )
+STAR( "Leo 67", 2.918271, 0.430369, 5.68 )
+STAR( "Mic Delta", 5.524054, -0.525780, 5.68 )
+STAR( "Psc 16", 6.180160, 0.036691, 5.68 )
+STAR( "Psc 72", 0.284009, 0.260859, 5.68 )
+STAR( "Ari Mu", 0.708458, 0.349269, 5.69 )
+STAR( "Aur 51", 1.739475, 0.687500, 5.69 )
+STAR( "Boo 39", 3.881998, 0.850334, 5.69 )
+STAR( "Cap 37", 5.649849, -0.350540, 5.69 )
+STAR( "Cet Kappa2", 0.877522, 0.064151, 5.69 )
+STAR( "Com 20", 3.271271, 0.364706, 5.69 )
+STAR( "Cyg 43", 5.353965, 0.861902, 5.69 )
+STAR( "Cyg 77", 5.682712, 0.716933, 5.69 )
+STAR( "Her 16", 4.256327, 0.328267, 5.69 )
+STAR( "Hyi Pi2", 0.591121, -1.182398, 5.69 )
+STAR( "Leo 8", 2.517827, 0.286893, 5.69 )
+STAR( "Lup Kappa2", 3.979176, -0.850737, 5.69 )
+STAR( "Men Delta", 1.125672, -1.399996, 5.69 )
+STAR( "Per 3", 0.517316, 0.858775, 5.69 )
+STAR( "Pup 10", 2.060863, -0.259118, 5.69 )
+STAR( "Scl Tau", 0.419490, -0.521984, 5.69 )
+STAR( "Sgr 33", 4.948016, -0.372797, 5.69 )
+STAR( "Tau 120", 1.455285, 0.323589, 5.69 )
+STAR( "Tau 13", 0.970032, 0.343835, 5.69 )
+STAR( "Vir 108", 3.863737, 0.012518, 5.69 )
+STAR( "Vol Gamma1", 1.870571, -1.230409, 5.69 )
+STAR( "And 5", 6.055231, 0.860375, 5.7 )
+STAR( "Aqr 19", 5.607823, -0.170145, 5.7 )
+STAR( "Ari 15", 0.569966, 0.340344, 5.7 )
+STAR( "Boo 7", 3.635586, 0.312986, 5.7 )
+STAR( "CMa Nu1", 1.729534, -0.325678, 5.7 )
+STAR( "Cas 2", 6.063863, 1.035557, 5.7 )
+STAR( "Cet 38", 0.326464, -0.016998, 5.7 )
+STAR( "Com 29", 3.354974, 0.246484, 5.7 )
+STAR( "Gru Tau3", 6.007409, -0.837220, 5.7 )
+STAR( "Her 10", 4.239550, 0.410060, 5.7 )
+STAR( "Peg 23", 5.783927, 0.505515, 5.7 )
+STAR( "Phe Xi", 0.182271, -0.986140, 5.7 )
+STAR( "Pic Mu", 1.710306, -1.025454, 5.7 )
+STAR( "UMa 73", 3.261955, 0.972371, 5.7 )
+STAR( "UMa 84", 3.606701, 0.950031, 5.7 )
+STAR( "UMa 86", 3.638357, 0.937741, 5.7 )
+STAR( "Aql 57", 5.212542, -0.143592, 5.71 )
+STAR( "Ari 19", 0.580562, 0.266681, 5.71 )
+STAR( "Cet 84", 0.703506, -0.012145, 5.71 )
+STAR( "Dor Eta1", 1.597660, -1.152611, 5.71 )
+STAR( "For Chi2", 0.905637, -0.622758, 5.71 )
+STAR( "For Zeta", 0.783660, -0.441117, 5.71 )
+STAR( "Gem 53", 1.902198, 0.486903, 5.71 )
+STAR( "Her 84", 4.639783, 0.424600, 5.71 )
+STAR( "Hya Chi2", 2.905799, -0.476262, 5.71 )
+STAR( "Leo 3", 2.480491, 0.142913, 5.71 )
+STAR( "Phe Tau", 0.004691, -0.851895, 5.71 )
+STAR( "Ser Upsilon", 4.133325, 0.246358, 5.71 )
+STAR( "Sgr 63", 5.244613, -0.238010, 5.71 )
+STAR( "And 23", 0.058963, 0.716201, 5.72 )
+STAR( "Aql Pi", 5.186689, 0.206225, 5.72 )
+STAR( "Ari 55", 0.827337, 0.507488, 5.72 )
+STAR( "Cet 12", 0.131074, -0.069067, 5.72 )
+STAR( "Del Theta", 5.404987, 0.232391, 5.72 )
+STAR( "Dra 71", 5.321560, 1.086598, 5.72 )
+STAR( "Eri 46", 1.195172, -0.117616, 5.72 )
+STAR( "Her 50", 4.409793, 0.520224, 5.72 )
+STAR( "Hya 3", 2.249162, -0.139316, 5.72 )
+STAR( "Tau 131", 1.515033, 0.252869, 5.72 )
+STAR( "Tau 45", 1.096670, 0.096396, 5.72 )
+STAR( "Tau 60", 1.143445, 0.245694, 5.72 )
+STAR( "UMa 22", 2.508445, 1.260225, 5.72 )
+STAR( "Vir 11", 3.185473, 0.101350, 5.72 )
+STAR( "Aur 36", 1.575058, 0.836047, 5.73 )
+STAR( "Cnc Psi", 2.140006, 0.445185, 5.73 )
+STAR( "Gem 37", 1.812132, 0.442887, 5.73 )
+STAR( "Lac 8", 5.916106, 0.691747, 5.73 )
+STAR( "Lib 4", 3.853803, -0.436289, 5.73 )
+STAR( "Lyr Zeta2", 4.907880, 0.656147, 5.73 )
+STAR( "Oct Gamma2", 6.272473, -1.434137, 5.73 )
+STAR( "Oph 73", 4.754117, 0.069697, 5.73 )
+STAR( "Pav Theta", 4.924577, -1.135821, 5.73 )
+STAR( "Per 55", 1.154041, 0.595691, 5.73 )
+STAR( "PsA 8", 5.655667, -0.456777, 5.73 )
+STAR( "Ser 47", 4.225733, 0.148949, 5.73 )
+STAR( "UMa 5", 2.327295, 1.081445, 5.73 )
+STAR( "UMa 62", 3.061184, 0.554074, 5.73 )
+STAR( "Vir 80", 3.558385, -0.094180, 5.73 )
+STAR( "Ari 7", 0.505491, 0.411500, 5.74 )
+STAR( "Boo 38", 3.880354, 0.804878, 5.74 )
+STAR( "CMa 17", 1.810975, -0.356130, 5.74 )
+STAR( "Her 73", 4.555789, 0.400732, 5.74 )
+STAR( "Hor Gamma", 0.721948, -1.111852, 5.74 )
+STAR( "Leo 85", 3.009377, 0.269013, 5.74 )
+STAR( "Mus Zeta1", 3.238451, -1.192191, 5.74 )
+STAR( "Oph 14", 4.370777, 0.020614, 5.74 )
+STAR( "Psc 66", 0.238179, 0.334900, 5.74 )
+STAR( "And 13", 6.139734, 0.748955, 5.75 )
+STAR( "Aqr 44", 5.834236, -0.094025, 5.75 )
+STAR( "Boo 1", 3.580870, 0.348290, 5.75 )
+STAR( "Cep 25", 5.839050, 1.096144, 5.75 )
+STAR( "Cet 77", 0.675057, -0.137173, 5.75 )
+STAR( "Cnc Upsilon1", 2.231876, 0.420295, 5.75 )
+STAR( "Cyg Iota1", 5.093882, 0.913166, 5.75 )
+STAR( "Dra 68", 5.286522, 1.083476, 5.75 )
+STAR( "Dra 76", 5.421807, 1.440440, 5.75 )
+STAR( "Eri Rho1", 0.790489, -0.133741, 5.75 )
+STAR( "For Iota1", 0.681355, -0.524379, 5.75 )
+STAR( "Gem 3", 1.613266, 0.403404, 5.75 )
+STAR( "Her 4", 4.169199, 0.742919, 5.75 )
+STAR( "Lep 1", 1.320989, -0.397848, 5.75 )
+STAR( "Oph 12", 4.347433, -0.040574, 5.75 )
+STAR( "Oph 26", 4.451280, -0.436143, 5.75 )
+STAR( "Ori 68", 1.623251, 0.345410, 5.75 )
+STAR( "Peg 34", 5.875753, 0.076683, 5.75 )
+STAR( "Peg 52", 6.017881, 0.204708, 5.75 )
+STAR( "Peg 85", 0.009468, 0.472669, 5.75 )
+STAR( "Per 8", 0.602131, 1.010541, 5.75 )
+STAR( "Vir 66", 3.510526, -0.090127, 5.75 )
+STAR( "Aqr 50", 5.866277, -0.236133, 5.76 )
+STAR( "Boo 10", 3.659294, 0.378669, 5.76 )
+STAR( "Gem 59", 1.939744, 0.482375, 5.76 )
+STAR( "Pav Mu1", 5.237660, -1.168488, 5.76 )
+STAR( "Per 56", 1.154637, 0.592709, 5.76 )
+STAR( "Tau 21", 0.985704, 0.428561, 5.76 )
+STAR( "And 12", 6.112528, 0.666405, 5.77 )
+STAR( "Ari Omicron", 0.717978, 0.267239, 5.77 )
+STAR( "Cam 1", 1.186955, 0.940922, 5.77 )
+STAR( "Eri 59", 1.259001, -0.285003, 5.77 )
+STAR( "Her 37", 4.366137, 0.073648, 5.77 )
+STAR( "Her 79", 4.614294, 0.424290, 5.77 )
+STAR( "Hya 48", 3.665199, -0.436512, 5.77 )
+STAR( "Hya 57", 3.874449, -0.465067, 5.77 )
+STAR( "LMi 32", 2.749359, 0.679374, 5.77 )
+STAR( "Leo 89", 3.029746, 0.053407, 5.77 )
+STAR( "Mic Theta2", 5.604310, -0.715701, 5.77 )
+STAR( "Oct Upsilon", 5.897569, -1.500411, 5.77 )
+STAR( "Per 11", 0.711425, 0.961778, 5.77 )
+STAR( "Psc 21", 6.237189, 0.018782, 5.77 )
+STAR( "Psc 44", 0.110843, 0.033855, 5.77 )
+STAR( "Sex 19", 2.673866, 0.080542, 5.77 )
+STAR( "Tau 117", 1.431286, 0.300875, 5.77 )
+STAR( "Tau 6", 0.927642, 0.163600, 5.77 )
+STAR( "Aqr 51", 5.864808, -0.084421, 5.78 )
+STAR( "Aur 64", 1.911296, 0.713549, 5.78 )
+STAR( "Cap 19", 5.475091, -0.312816, 5.78 )
+STAR( "Cap 35", 5.616673, -0.369942, 5.78 )
+STAR( "Cas 44", 0.450855, 1.056816, 5.78 )
+STAR( "Cnc 1", 2.081261, 0.275592, 5.78 )
+STAR( "Com 30", 3.356661, 0.480877, 5.78 )
+STAR( "CrB Upsilon", 4.261861, 0.508768, 5.78 )
+STAR( "Gem 47", 1.882272, 0.468737, 5.78 )
+STAR( "Lyn 33", 2.245933, 0.635639, 5.78 )
+STAR( "Peg 25", 5.793788, 0.378785, 5.78 )
+STAR( "Sco 11", 4.221981, -0.222452, 5.78 )
+STAR( "And 10", 6.108100, 0.734401, 5.79 )
+STAR( "Aql 56", 5.210404, -0.149647, 5.79 )
+STAR( "Ari 20", 0.592394, 0.449999, 5.79 )
+STAR( "Ari 56", 0.838791, 0.475723, 5.79 )
+STAR( "Aur 53", 1.738275, 0.505869, 5.79 )
+STAR( "CVn 19", 3.471169, 0.713059, 5.79 )
+STAR( "Dra Psi1", 4.633704, 1.259376, 5.79 )
+STAR( "For Lambda2", 0.684940, -0.603506, 5.79 )
+STAR( "Men Nu", 1.138675, -1.423840, 5.79 )
+STAR( "Peg 80", 6.245457, 0.162548, 5.79 )
+STAR( "Per 2", 0.489376, 0.886501, 5.79 )
+STAR( "Psc 35", 0.065363, 0.153953, 5.79 )
+STAR( "Sex 35", 2.807137, 0.082864, 5.79 )
+STAR( "Sex 41", 2.837476, -0.155296, 5.79 )
+STAR( "Tau 89", 1.213687, 0.279834, 5.79 )
+STAR( "Tau 99", 1.299449, 0.417982, 5.79 )
+STAR( "UMi 24", 4.584980, 1.517879, 5.79 )
+STAR( "Vir 44", 3.401901, -0.066531, 5.79 )
+STAR( "Aql 35", 5.100797, 0.034039, 5.8 )
+STAR( "Aqr 74", 5.992930, -0.202749, 5.8 )
+STAR( "Ari 47", 0.777050, 0.360735, 5.8 )
+STAR( "Cep 13", 5.737275, 0.988055, 5.8 )
+STAR( "Dra Mu", 4.473839, 0.950686, 5.8 )
+STAR( "Gem 5", 1.621142, 0.426214, 5.8 )
+STAR( "Lib Xi1", 3.902476, -0.207665, 5.8 )
+STAR( "Peg 21", 5.774058, 0.198730, 5.8 )
+STAR( "Sge 15", 5.253892, 0.297928, 5.8 )
+STAR( "UMa 39", 2.808766, 0.998314, 5.8 )
+STAR( "And 45", 0.310545, 0.658411, 5.81 )
+STAR( "Aqr 35", 5.798784, -0.323230, 5.81 )
+STAR( "CMi Delta3", 1.982098, 0.058842, 5.81 )
+STAR( "Cas 38", 0.398066, 1.226351, 5.81 )
+STAR( "Leo 56", 2.862449, 0.107953, 5.81 )
+STAR( "Nor Zeta", 4.247157, -0.969370, 5.81 )
+STAR( "Oph 53", 4.601611, 0.167319, 5.81 )
+STAR( "Ser Tau7", 4.109865, 0.322256, 5.81 )
+STAR( "Tau 98", 1.300954, 0.437210, 5.81 )
+STAR( "UMa 71", 3.250908, 0.990954, 5.81 )
+STAR( "Vul 8", 5.100507, 0.432294, 5.81 )
+STAR( "Aqr 15", 5.577134, -0.078879, 5.82 )
+STAR( "Ari 40", 0.735373, 0.319109, 5.82 )
+STAR( "Cet 30", 0.295702, -0.170790, 5.82 )
+STAR( "Cnc 66", 2.362310, 0.562912, 5.82 )
+STAR( "Equ 9", 5.589766, 0.128359, 5.82 )
+STAR( "Gem 52", 1.896729, 0.434325, 5.82 )
+STAR( "Leo 39", 2.693232, 0.403278, 5.82 )
+STAR( "Lib Zeta3", 4.060828, -0.289889, 5.82 )
+STAR( "Peg 40", 5.929218, 0.340727, 5.82 )
+STAR( "UMa 32", 2.696679, 1.136355, 5.82 )
+STAR( "Cep Rho1", 5.876124, 1.375072, 5.83 )
+STAR( "Cnc Omega1", 2.098460, 0.443188, 5.83 )
+STAR( "Dra Mu", 4.473846, 0.950686, 5.83 )
+STAR( "For Iota2", 0.690765, -0.526988, 5.83 )
+STAR( "Ari 4", 0.472032, 0.295930, 5.84 )
+STAR( "Eri 6", 0.777086, -0.412004, 5.84 )
+STAR( "Mon 12", 1.711819, 0.084750, 5.84 )
+STAR( "UMa 66", 3.124023, 0.987832, 5.84 )
+STAR( "Cap Xi2", 5.290231, -0.220217, 5.85 )
+STAR( "Gem 33", 1.788221, 0.282792, 5.85 )
+STAR( "Gem 48", 1.886875, 0.421119, 5.85 )
+STAR( "Her 21", 4.294295, 0.121266, 5.85 )
+STAR( "Her 77", 4.567250, 0.842296, 5.85 )
+STAR( "Hya 60", 3.936183, -0.489749, 5.85 )
+STAR( "LMi 38", 2.788716, 0.661654, 5.85 )
+STAR( "LMi 7", 2.490236, 0.587400, 5.85 )
+STAR( "Lyn 11", 1.735039, 0.992351, 5.85 )
+STAR( "Men Xi", 1.303972, -1.439383, 5.85 )
+STAR( "Vir 12", 3.200199, 0.179110, 5.85 )
+STAR( "Ari 1", 0.480584, 0.388777, 5.86 )
+STAR( "Gru Sigma2", 5.920942, -0.708449, 5.86 )
+STAR( "Her 100", 4.746532, 0.455555, 5.86 )
+STAR( "Aqr 16", 5.589730, -0.079587, 5.87 )
+STAR( "Aur 39", 1.592860, 0.750172, 5.87 )
+STAR( "Aur Psi9", 1.817491, 0.807637, 5.87 )
+STAR( "Cap 4", 5.314629, -0.380656, 5.87 )
+STAR( "Cet 42", 0.348215, -0.008882, 5.87 )
+STAR( "Cnc 50", 2.299180, 0.211359, 5.87 )
+STAR( "Com 2", 3.160253, 0.374533, 5.87 )
+STAR( "Lep 12", 1.493267, -0.390493, 5.87 )
+STAR( "Lib 18", 3.922162, -0.194502, 5.87 )
+STAR( "Psc 14", 6.170393, -0.021773, 5.87 )
+STAR( "Psc 54", 0.171755, 0.370892, 5.87 )
+STAR( "Ret Theta", 1.124297, -1.104018, 5.87 )
+STAR( "Sco 3", 4.165483, -0.440584, 5.87 )
+STAR( "Sgr Rho2", 5.069520, -0.319541, 5.87 )
+STAR( "Vir 25", 3.302119, -0.101787, 5.87 )
+STAR( "Vir 64", 3.500091, 0.089967, 5.87 )
+STAR( "Boo Pi2", 3.842917, 0.286544, 5.88 )
+STAR( "Cap 44", 5.685730, -0.251323, 5.88 )
+STAR( "Cas 9", 0.018442, 1.087127, 5.88 )
+STAR( "Cnc 36", 2.256260, 0.168521, 5.88 )
+STAR( "Cyg 42", 5.364008, 0.636255, 5.88 )
+STAR( "Lyn 6", 1.705129, 1.015132, 5.88 )
+STAR( "Psc 112", 0.524268, 0.054057, 5.88 )
+STAR( "Ser Psi", 4.119108, 0.043895, 5.88 )
+STAR( "Aql 10", 4.968872, 0.242717, 5.89 )
+STAR( "Aqr 12", 5.515582, -0.101631, 5.89 )
+STAR( "Aqr 60", 5.908150, -0.027474, 5.89 )
+STAR( "For Epsilon", 0.792503, -0.490292, 5.89 )
+STAR( "Lyn 30", 2.183560, 1.007811, 5.89 )
+STAR( "Psc 53", 0.160519, 0.265843, 5.89 )
+STAR( "Tau 105", 1.343576, 0.378819, 5.89 )
+STAR( "Tri 13", 0.649299, 0.522411, 5.89 )
+STAR( "Vir 65", 3.505123, -0.085948, 5.89 )
+STAR( "Aql 5", 4.915174, -0.016784, 5.9 )
+STAR( "Ari 49", 0.793696, 0.461853, 5.9 )
+STAR( "Ari 59", 0.872359, 0.472480, 5.9 )
+STAR( "Aur 47", 1.701914, 0.814817, 5.9 )
+STAR( "Cru Kappa", 3.376419, -1.053776, 5.9 )
+STAR( "Eri 56", 1.239569, -0.148416, 5.9 )
+STAR( "For Lambda1", 0.668097, -0.604757, 5.9 )
+STAR( "For Sigma", 0.988104, -0.512046, 5.9 )
+STAR( "Her 100", 4.746532, 0.455487, 5.9 )
+STAR( "LMi 27", 2.718808, 0.591807, 5.9 )
+STAR( "LMi 33", 2.756995, 0.565128, 5.9 )
+STAR( "Ori 59", 1.563844, 0.032061, 5.9 )
+STAR( "Scl Lambda2", 0.192866, -0.670585, 5.9 )
+STAR( "Tau 39", 1.070483, 0.384128, 5.9 )
+STAR( "Tau 76", 1.171072, 0.257276, 5.9 )
+STAR( "Vir 13", 3.223063, -0.013740, 5.9 )
+STAR( "Aql Upsilon", 5.173440, 0.132878, 5.91 )
+STAR( "Ari Rho2", 0.767109, 0.319948, 5.91 )
+STAR( "CVn 17", 3.447258, 0.671932, 5.91 )
+STAR( "Leo 55", 2.861060, 0.012862, 5.91 )
+STAR( "Leo 76", 2.962333, 0.028808, 5.91 )
+STAR( "Lyr Nu1", 4.929530, 0.572691, 5.91 )
+STAR( "Oct Omega", 3.975591, -1.479821, 5.91 )
+STAR( "Sex 17", 2.662173, -0.146753, 5.91 )
+STAR( "TrA Eta1", 4.369381, -1.191992, 5.91 )
+STAR( "Vir 92", 3.649767, 0.018336, 5.91 )
+STAR( "Boo 26", 3.807181, 0.388510, 5.92 )
+STAR( "CMa 26", 1.885843, -0.452782, 5.92 )
+STAR( "Cam 51", 2.036225, 1.142420, 5.92 )
+STAR( "For Eta2", 0.742841, -0.625589, 5.92 )
+STAR( "For Psi", 0.757357, -0.670851, 5.92 )
+STAR( "Her 39", 4.370355, 0.469789, 5.92 )
+STAR( "Lac 14", 5.979338, 0.732229, 5.92 )
+STAR( "Oph Rho", 4.300426, -0.409212, 5.92 )
+STAR( "Ori 57", 1.548740, 0.344698, 5.92 )
+STAR( "Sgr 57", 5.201954, -0.332398, 5.92 )
+STAR( "Tau 7", 0.935686, 0.426985, 5.92 )
+STAR( "Vul 20", 5.288399, 0.462144, 5.92 )
+STAR( "Ant Zeta2", 2.493799, -0.556270, 5.93 )
+STAR( "Cap 17", 5.437428, -0.375493, 5.93 )
+STAR( "Cet 14", 0.155102, -0.008824, 5.93 )
+STAR( "Cet 61", 0.540194, -0.005939, 5.93 )
+STAR( "Cet 63", 0.574199, -0.031857, 5.93 )
+STAR( "Gem 61", 1.950136, 0.353555, 5.93 )
+STAR( "Mon 16", 1.773865, 0.149875, 5.93 )
+STAR( "Psc 24", 6.252322, -0.055075, 5.93 )
+STAR( "Psc 62", 0.210705, 0.127409, 5.93 )
+STAR( "Ser Tau5", 4.086201, 0.281328, 5.93 )
+STAR( "And 6", 6.066997, 0.759989, 5.94 )
+STAR( "Cam 26", 1.511921, 0.979401, 5.94 )
+STAR( "Cap Omicron", 5.366444, -0.324340, 5.94 )
+STAR( "Cet 34", 0.312959, -0.039289, 5.94 )
+STAR( "Crt Kappa", 2.998294, -0.215665, 5.94 )
+STAR( "Cyg 69", 5.610288, 0.639969, 5.94 )
+STAR( "Equ 4", 5.521545, 0.103993, 5.94 )
+STAR( "Lib 47", 4.166995, -0.338298, 5.94 )
+STAR( "Lyn 4", 1.667051, 1.036241, 5.94 )
+STAR( "Lyn 8", 1.735250, 1.073048, 5.94 )
+STAR( "Oph Tau", 4.725843, -0.142773, 5.94 )
+STAR( "Ser 61", 4.851797, -0.017507, 5.94 )
+STAR( "UMa 58", 3.012955, 0.753517, 5.94 )
+STAR( "Vir 50", 3.445956, -0.180283, 5.94 )
+STAR( "Aqr 45", 5.842548, -0.232216, 5.95 )
+STAR( "Aur 5", 1.310328, 0.687568, 5.95 )
+STAR( "Boo 3", 3.607254, 0.448588, 5.95 )
+STAR( "CVn 10", 3.337906, 0.685546, 5.95 )
+STAR( "Cet 33", 0.307876, 0.042683, 5.95 )
+STAR( "Cnc 20", 2.196337, 0.319958, 5.95 )
+STAR( "Cnc 29", 2.219281, 0.248026, 5.95 )
+STAR( "Cnc Rho1", 2.323891, 0.494466, 5.95 )
+STAR( "Dra 37", 4.779075, 1.200016, 5.95 )
+STAR( "Leo 62", 2.895545, -0.000015, 5.95 )
+STAR( "Leo 90", 3.031237, 0.293162, 5.95 )
+STAR( "Sgr 16", 4.778777, -0.355839, 5.95 )
+STAR( "Vir 10", 3.183866, 0.033122, 5.95 )
+STAR( "Com 38", 3.408453, 0.298854, 5.96 )
+STAR( "Cyg 16", 5.156641, 0.881832, 5.96 )
+STAR( "Dra 74", 5.364524, 1.415312, 5.96 )
+STAR( "Eri 21", 0.955648, -0.098194, 5.96 )
+STAR( "Leo 35", 2.690156, 0.410206, 5.97 )
+STAR( "Peg 79", 6.238054, 0.503397, 5.97 )
+STAR( "PsA 21", 5.983636, -0.515502, 5.97 )
+STAR( "PsA 6", 5.638475, -0.592447, 5.97 )
+STAR( "Psc 105", 0.434936, 0.286336, 5.97 )
+STAR( "Sex 25", 2.720277, -0.071108, 5.97 )
+STAR( "Sgr 9", 4.729290, -0.425172, 5.97 )
+STAR( "And 39", 0.274475, 0.721606, 5.98 )
+STAR( "Cnc 75", 2.394541, 0.464767, 5.98 )
+STAR( "Cnc Lambda", 2.183996, 0.419267, 5.98 )
+STAR( "Del 15", 5.452539, 0.218956, 5.98 )
+STAR( "Lyr 19", 5.025530, 0.545997, 5.98 )
+STAR( "Peg 69", 6.142134, 0.439251, 5.98 )
+STAR( "Per 7", 0.602466, 1.003855, 5.98 )
+STAR( "Psc 87", 0.323439, 0.281585, 5.98 )
+STAR( "Aql 64", 5.271025, -0.011839, 5.99 )
+STAR( "Aqr 17", 5.597875, -0.162655, 5.99 )
+STAR( "Aqr 4", 5.460386, -0.098199, 5.99 )
+STAR( "Cap 45", 5.689846, -0.257426, 5.99 )
+STAR( "Cnc 5", 2.100962, 0.287199, 5.99 )
+STAR( "Cnc Mu1", 2.121913, 0.395065, 5.99 )
+STAR( "Com 39", 3.431114, 0.369195, 5.99 )
+STAR( "Del 10", 5.416062, 0.254522, 5.99 )
+STAR( "Psc 60", 0.206792, 0.117650, 5.99 )
+STAR( "Vir 46", 3.406003, -0.058793, 5.99 )
+STAR( "Aur 62", 1.828436, 0.664137, 6 )
+STAR( "Cap 47", 5.699685, -0.161894, 6 )
+STAR( "Cas 52", 0.536158, 1.132743, 6 )
+STAR( "CrB Zeta1", 4.098775, 0.639430, 6 )
+STAR( "Oct Mu1", 5.419458, -1.329602, 6 )
+STAR( "Peg 18", 5.760161, 0.117242, 6 )
+STAR( "Psc 73", 0.283078, 0.098723, 6 )
+STAR( "Tau 129", 1.513019, 0.276155, 6 )
+STAR( "UMa 51", 2.899515, 0.667438, 6 )
+STAR( "Cam 53", 2.101842, 1.052860, 6.01 )
+STAR( "Cnc 79", 2.401348, 0.383909, 6.01 )
+STAR( "For Tau", 0.954673, -0.487698, 6.01 )
+STAR( "Ser Tau6", 4.105829, 0.279684, 6.01 )
+STAR( "Sex 6", 2.579742, -0.074060, 6.01 )
+STAR( "Vir 73", 3.543222, -0.326881, 6.01 )
+STAR( "And 9", 6.101627, 0.729087, 6.02 )
+STAR( "Aql Omega2", 5.060946, 0.201324, 6.02 )
+STAR( "Ari 16", 0.572468, 0.452685, 6.02 )
+STAR( "Cnc Zeta1", 2.147679, 0.308012, 6.02 )
+STAR( "Gem 44", 1.855750, 0.395094, 6.02 )
+STAR( "Gem 58", 1.935003, 0.400471, 6.02 )
+STAR( "Lyr Epsilon1", 4.905851, 0.692392, 6.02 )
+STAR( "Psc 97", 0.392183, 0.320365, 6.02 )
+STAR( "Sex 7", 2.583975, 0.042833, 6.02 )
+STAR( "Tau 85", 1.186228, 0.276664, 6.02 )
+STAR( "Vir 37", 3.366806, 0.053349, 6.02 )
+STAR( "Aqr 39", 5.813823, -0.247730, 6.03 )
+STAR( "Ari 66", 0.909506, 0.398008, 6.03 )
+STAR( "Aur 54", 1.743373, 0.493283, 6.03 )
+STAR( "Cyg 61", 5.527989, 0.676199, 6.03 )
+STAR( "Hya Phi2", 2.776288, -0.285264, 6.03 )
+STAR( "Oph 16", 4.387300, 0.017807, 6.03 )
+STAR( "Psc 88", 0.325969, 0.122091, 6.03 )
+STAR( "Ari 29", 0.667159, 0.262405, 6.04 )
+STAR( "Cet 26", 0.278453, 0.023853, 6.04 )
+STAR( "Dra 40", 4.712636, 1.396278, 6.04 )
+STAR( "Gru Tau1", 5.993599, -0.848196, 6.04 )
+STAR( "LMi 44", 2.835702, 0.488236, 6.04 )
+STAR( "Leo 45", 2.738640, 0.170388, 6.04 )
+STAR( "Mic Beta", 5.462793, -0.579052, 6.04 )
+STAR( "Peg 33", 5.862823, 0.363872, 6.04 )
+STAR( "Cam 24", 1.496736, 0.987536, 6.05 )
+STAR( "Cyg 11", 5.130417, 0.644802, 6.05 )
+STAR( "Ind Rho", 5.998071, -1.223015, 6.05 )
+STAR( "Men Iota", 1.464353, -1.375683, 6.05 )
+STAR( "CVn 4", 3.245367, 0.742512, 6.06 )
+STAR( "Cen 3", 3.629565, -0.575867, 6.06 )
+STAR( "Hyi Tau2", 0.470257, -1.399347, 6.06 )
+STAR( "Lyn 23", 2.010728, 0.996282, 6.06 )
+STAR( "Psc 48", 0.123097, 0.287019, 6.06 )
+STAR( "Scl Lambda1", 0.186379, -0.671312, 6.06 )
+STAR( "Tau 33", 1.034384, 0.404490, 6.06 )
+STAR( "Cas 55", 0.586802, 1.161071, 6.07 )
+STAR( "Cnc 67", 2.364114, 0.486995, 6.07 )
+STAR( "Equ 6", 5.543689, 0.175386, 6.07 )
+STAR( "Leo 43", 2.718379, 0.114188, 6.07 )
+STAR( "Pup 2", 2.031061, -0.256403, 6.07 )
+STAR( "UMa 76", 3.322954, 1.094549, 6.07 )
+STAR( "Vir 34", 3.347658, 0.208707, 6.07 )
+STAR( "Ari 65", 0.892016, 0.363092, 6.08 )
+STAR( "CMa 12", 1.775982, -0.366791, 6.08 )
+STAR( "Cam 12", 1.336064, 1.030113, 6.08 )
+STAR( "Cam 8", 1.308001, 0.927739, 6.08 )
+STAR( "Cnc 21", 2.198766, 0.185562, 6.08 )
+STAR( "CrB Eta", 4.028242, 0.528621, 6.08 )
+STAR( "Cyg Mu2", 5.690377, 0.501661, 6.08 )
+STAR( "Del 1", 5.368196, 0.190168, 6.08 )
+STAR( "Gem 8", 1.641991, 0.418355, 6.08 )
+STAR( "Her 56", 4.428926, 0.449083, 6.08 )
+STAR( "Lib Iota2", 3.985110, -0.342914, 6.08 )
+STAR( "Ser 43", 4.205204, 0.087034, 6.08 )
+STAR( "Tau 110", 1.412095, 0.291460, 6.08 )
+STAR( "Tau 96", 1.264207, 0.277580, 6.08 )
+STAR( "UMa 75", 3.272805, 1.025686, 6.08 )
+STAR( "Aur 41", 1.621455, 0.850169, 6.09 )
+STAR( "Cir Zeta", 3.903894, -1.151767, 6.09 )
+STAR( "Leo 20", 2.573641, 0.369651, 6.09 )
+STAR( "Per 49", 1.083217, 0.658474, 6.09 )
+STAR( "Per 57", 1.192998, 0.751607, 6.09 )
+STAR( "Phe Theta", 6.193592, -0.813983, 6.09 )
+STAR( "Psc 67", 0.244237, 0.474894, 6.09 )
+STAR( "Vir 72", 3.536161, -0.112928, 6.09 )
+STAR( "And 59", 0.571137, 0.681430, 6.1 )
+STAR( "Aql 8", 4.936526, -0.057906, 6.1 )
+STAR( "Aur 38", 1.585195, 0.748950, 6.1 )
+STAR( "Cnc 28", 2.219244, 0.421405, 6.1 )
+STAR( "Gem 39", 1.827316, 0.455201, 6.1 )
+STAR( "Oph 19", 4.394579, 0.036031, 6.1 )
+STAR( "Ser 39", 4.159127, 0.230325, 6.1 )
+STAR( "UMa 60", 3.048036, 0.817410, 6.1 )
+STAR( "And 26", 0.081601, 0.764299, 6.11 )
+STAR( "Ari 53", 0.817810, 0.312065, 6.11 )
+STAR( "Cyg 76", 5.679178, 0.712186, 6.11 )
+STAR( "Eri 7", 0.789107, -0.050241, 6.11 )
+STAR( "Hya 21", 2.410445, -0.124088, 6.11 )
+STAR( "Phe Omega", 0.270657, -0.994881, 6.11 )
+STAR( "Pic Kappa", 1.406597, -0.979731, 6.11 )
+STAR( "PsA 7", 5.658423, -0.576797, 6.11 )
+STAR( "Psc 1", 5.999533, 0.018583, 6.11 )
+STAR( "Psc 36", 0.072293, 0.143815, 6.11 )
+STAR( "Pup 22", 2.193792, -0.227848, 6.11 )
+STAR( "Tau 11", 0.963298, 0.442082, 6.11 )
+STAR( "Vir 38", 3.373663, -0.062013, 6.11 )
+STAR( "And 66", 0.645176, 0.882608, 6.12 )
+STAR( "Ari 60", 0.874526, 0.447900, 6.12 )
+STAR( "Aur 59", 1.802162, 0.678395, 6.12 )
+STAR( "Cet 27", 0.286292, -0.174169, 6.12 )
+STAR( "Col Pi1", 1.599958, -0.738250, 6.12 )
+STAR( "Ind Gamma", 5.612353, -0.954007, 6.12 )
+STAR( "Ind Kappa1", 5.753049, -1.029958, 6.12 )
+STAR( "Leo 42", 2.713282, 0.261373, 6.12 )
+STAR( "Mon 1", 1.566506, -0.163751, 6.12 )
+STAR( "Psc 75", 0.290423, 0.226127, 6.12 )
+STAR( "Ser 8", 4.030525, -0.017846, 6.12 )
+STAR( "Ser Tau3", 4.082121, 0.308148, 6.12 )
+STAR( "Aql 68", 5.359972, -0.058604, 6.13 )
+STAR( "Cam 15", 1.393922, 1.014337, 6.13 )
+STAR( "Cnc 46", 2.292301, 0.535777, 6.13 )
+STAR( "Crt Psi", 2.934364, -0.322886, 6.13 )
+STAR( "Hya 10", 2.290839, 0.099144, 6.13 )
+STAR( "Psc 59", 0.206065, 0.341716, 6.13 )
+STAR( "Pup 14", 2.114866, -0.344320, 6.13 )
+STAR( "Sge 18", 5.307234, 0.376967, 6.13 )
+STAR( "Tau 95", 1.235824, 0.420430, 6.13 )
+STAR( "Tuc Theta", 0.145684, -1.243828, 6.13 )
+STAR( "Aur 17", 1.388911, 0.589349, 6.14 )
+STAR( "Cam 30", 1.537155, 1.029119, 6.14 )
+STAR( "Cnc 25", 2.207107, 0.297511, 6.14 )
+STAR( "Eri 14", 0.857808, -0.159775, 6.14 )
+STAR( "Eri 32", 1.022283, -0.051536, 6.14 )
+STAR( "For Gamma1", 0.741110, -0.428658, 6.14 )
+STAR( "Her 8", 4.227086, 0.300298, 6.14 )
+STAR( "LMi 13", 2.542559, 0.612494, 6.14 )
+STAR( "Ser Tau8", 4.122039, 0.301317, 6.14 )
+STAR( "Tau 14", 0.976454, 0.343219, 6.14 )
+STAR( "Aqr 82", 6.032483, -0.114741, 6.15 )
+STAR( "Ari 11", 0.553357, 0.448632, 6.15 )
+STAR( "Ari 26", 0.657291, 0.346540, 6.15 )
+STAR( "Cam 19", 1.471538, 1.119711, 6.15 )
+STAR( "Cam 23", 1.501609, 1.072970, 6.15 )
+STAR( "Cet 18", 0.198437, -0.224813, 6.15 )
+STAR( "LMi 43", 2.831593, 0.513403, 6.15 )
+STAR( "Cet 21", 0.236899, -0.152556, 6.16 )
+STAR( "Col Nu1", 1.471640, -0.486448, 6.16 )
+STAR( "Hyi Sigma", 0.505455, -1.367436, 6.16 )
+STAR( "Pup 21", 2.170251, -0.284227, 6.16 )
+STAR( "Lib 26", 3.990528, -0.310121, 6.17 )
+STAR( "Lib 28", 4.018162, -0.316928, 6.17 )
+STAR( "Oph 61", 4.645048, 0.045020, 6.17 )
+STAR( "Ori 13", 1.342325, 0.165317, 6.17 )
+STAR( "Peg 60", 6.072960, 0.468572, 6.17 )
+STAR( "PsA 19", 5.944453, -0.512443, 6.17 )
+STAR( "Vir 104", 3.784776, -0.106819, 6.17 )
+STAR( "Ant Zeta1", 2.490447, -0.556576, 6.18 )
+STAR( "Cas 13", 0.137103, 1.160983, 6.18 )
+STAR( "Gem 82", 2.044479, 0.403889, 6.18 )
+STAR( "LMi 9", 2.502388, 0.636817, 6.18 )
+STAR( "Peg 3", 5.662408, 0.115512, 6.18 )
+STAR( "Aqr 70", 5.971222, -0.184229, 6.19 )
+STAR( "Aqr 78", 5.997686, -0.125746, 6.19 )
+STAR( "Cet 10", 0.116166, -0.000868, 6.19 )
+STAR( "Cyg 44", 5.371193, 0.644652, 6.19 )
+STAR( "Her 63", 4.498819, 0.423029, 6.19 )
+STAR( "Ind Pi", 5.743151, -1.010536, 6.19 )
+STAR( "Oct Eta", 2.876434, -1.476442, 6.19 )
+STAR( "Vir 27", 3.322991, 0.181975, 6.19 )
+STAR( "Vir 85", 3.602294, -0.275195, 6.19 )
+STAR( "Cnc Zeta2", 2.147722, 0.308012, 6.2 )
+STAR( "Dra 69", 5.234286, 1.334852, 6.2 )
+STAR( "LMi 48", 2.856682, 0.444899, 6.2 )
+STAR( "Leo 88", 3.018322, 0.250707, 6.2 )
+STAR( "Sgr 54", 5.151877, -0.284372, 6.2 )
+STAR( "Aqr 11", 5.500245, -0.082559, 6.21 )
+STAR( "Aqr 81", 6.027465, -0.123240, 6.21 )
+STAR( "CVn 7", 3.272703, 0.899465, 6.21 )
+STAR( "Car Eta", 2.814605, -1.041685, 6.21 )
+STAR( "Cet 44", 0.366701, -0.139757, 6.21 )
+STAR( "Her 97", 4.723305, 0.400083, 6.21 )
+STAR( "Lib 2", 3.767410, -0.204451, 6.21 )
+STAR( "Peg 41", 5.933174, 0.343500, 6.21 )
+STAR( "Psc 26", 6.261936, 0.123414, 6.21 )
+STAR( "Psc 3", 6.024142, 0.003243, 6.21 )
+STAR( "Sex 14", 2.647621, 0.097937, 6.21 )
+STAR( "Gem 16", 1.692722, 0.357725, 6.22 )
+STAR( "Psc 101", 0.417890, 0.255890, 6.22 )
+STAR( "Ser Tau2", 4.067323, 0.280232, 6.22 )
+STAR( "Tuc Lambda1", 0.228660, -1.213081, 6.22 )
+STAR( "Ari 27", 0.658455, 0.308991, 6.23 )
+STAR( "Boo 11", 3.670318, 0.477988, 6.23 )
+STAR( "Cnc 53", 2.323368, 0.493216, 6.23 )
+STAR( "Psc 42", 0.097848, 0.235314, 6.23 )
+STAR( "Sge 9", 5.202667, 0.325887, 6.23 )
+STAR( "Sgr 26", 4.895038, -0.415970, 6.23 )
+STAR( "Tri 5", 0.573413, 0.550239, 6.23 )
+STAR( "Leo 13", 2.537891, 0.452263, 6.24 )
+STAR( "Lyn 32", 2.239970, 0.635935, 6.24 )
+STAR( "Sex 4", 2.576550, 0.075810, 6.24 )
+STAR( "Cap 20", 5.496049, -0.332228, 6.25 )
+STAR( "Cap 27", 5.539457, -0.358777, 6.25 )
+STAR( "Dra 55", 5.016789, 1.151544, 6.25 )
+STAR( "Gem 9", 1.644878, 0.414356, 6.25 )
+STAR( "Her Kappa", 4.224053, 0.297656, 6.25 )
+STAR( "Lyn 25", 2.070346, 0.827044, 6.25 )
+STAR( "Peg 45", 5.957987, 0.338012, 6.25 )
+STAR( "Per 10", 0.633845, 0.988031, 6.25 )
+STAR( "Psc 78", 0.296801, 0.558719, 6.25 )
+STAR( "Psc 9", 6.140272, 0.019591, 6.25 )
+STAR( "Sge 2", 5.080515, 0.295620, 6.25 )
+STAR( "Tau 113", 1.422858, 0.291475, 6.25 )
+STAR( "Vir 41", 3.376463, 0.216746, 6.25 )
+STAR( "Aql Psi", 5.168654, 0.232177, 6.26 )
+STAR( "Car Upsilon", 2.561758, -1.135729, 6.26 )
+STAR( "Cet 1", 6.276000, -0.276591, 6.26 )
+STAR( "Lyn 28", 2.125658, 0.755034, 6.26 )
+STAR( "Oph 29", 4.458676, -0.329615, 6.26 )
+STAR( "Peg 74", 6.185723, 0.293661, 6.26 )
+STAR( "Sex 33", 2.798650, -0.030398, 6.26 )
+STAR( "Vir 20", 3.285793, 0.179691, 6.26 )
+STAR( "Ari 54", 0.821846, 0.328035, 6.27 )
+STAR( "CVn 11", 3.354072, 0.845908, 6.27 )
+STAR( "Cnc 12", 2.132385, 0.238077, 6.27 )
+STAR( "Com 8", 3.225885, 0.402032, 6.27 )
+STAR( "Pav Tau", 5.046074, -1.207603, 6.27 )
+STAR( "Pic Theta", 1.417076, -0.913093, 6.27 )
+STAR( "Psc 109", 0.457843, 0.350515, 6.27 )
+STAR( "Tau 108", 1.376461, 0.388942, 6.27 )
+STAR( "CVn 15", 3.445716, 0.672543, 6.28 )
+STAR( "Gru Sigma1", 5.918797, -0.708303, 6.28 )
+STAR( "Her 57", 4.439754, 0.442489, 6.28 )
+STAR( "LMi 35", 2.776630, 0.634025, 6.28 )
+STAR( "Psc 25", 6.252991, 0.036487, 6.28 )
+STAR( "Ser 7", 4.024671, 0.219344, 6.28 )
+STAR( "Sex 36", 2.815027, 0.043425, 6.28 )
+STAR( "Sgr 6", 4.718432, -0.299445, 6.28 )
+STAR( "Vir 54", 3.462064, -0.328587, 6.28 )
+STAR( "Aqr 100", 6.159711, -0.372967, 6.29 )
+STAR( "Cnc 61", 2.347373, 0.527676, 6.29 )
+STAR( "Com 22", 3.288069, 0.423819, 6.29 )
+STAR( "Peg 65", 6.120324, 0.363528, 6.29 )
+STAR( "Ser 40", 4.165541, 0.149754, 6.29 )
+STAR( "Aur 60", 1.803027, 0.670871, 6.3 )
+STAR( "Cnc Epsilon", 2.270892, 0.341125, 6.3 )
+STAR( "Cnc Phi2", 2.211259, 0.470109, 6.3 )
+STAR( "Leo 54", 2.860689, 0.431950, 6.3 )
+STAR( "Lib Omicron", 4.018722, -0.271370, 6.3 )
+STAR( "Psc Zeta", 0.321817, 0.132267, 6.3 )
+STAR( "Sco Nu", 4.241048, -0.339462, 6.3 )
+STAR( "Tel Mu", 5.107597, -0.961851, 6.3 )
+STAR( "Cnc Omega2", 2.101944, 0.437898, 6.31 )
+STAR( "Hya 37", 2.529811, -0.184486, 6.31 )
+STAR( "Cap 3", 5.307459, -0.215320, 6.32 )
+STAR( "Cnc Phi2", 2.211245, 0.470095, 6.32 )
+STAR( "Com 32", 3.369380, 0.297996, 6.32 )
+STAR( "CrA Kappa1", 4.858073, -0.675796, 6.32 )
+STAR( "Cyg 48", 5.399743, 0.551044, 6.32 )
+STAR( "Psc 31", 0.010487, 0.156328, 6.32 )
+STAR( "Tau 48", 1.116014, 0.268790, 6.32 )
+STAR( "UMa 35", 2.748479, 1.145392, 6.32 )
+STAR( "Cet 71", 0.632565, -0.048520, 6.33 )
+STAR( "Com 9", 3.226648, 0.491431, 6.33 )
+STAR( "Del 14", 5.453303, 0.137256, 6.33 )
+STAR( "Gem 79", 2.029622, 0.354588, 6.33 )
+STAR( "Hyi Tau1", 0.442245, -1.381399, 6.33 )
+STAR( "Lib 5", 3.865744, -0.269823, 6.33 )
+STAR( "Vul 7", 5.102245, 0.353948, 6.33 )
+STAR( "Aql 46", 5.158379, 0.212814, 6.34 )
+STAR( "Cae Gamma2", 1.328348, -0.623175, 6.34 )
+STAR( "Cap Xi1", 5.288195, -0.216290, 6.34 )
+STAR( "Cas 35", 0.353807, 1.128501, 6.34 )
+STAR( "Sgr 53", 5.147950, -0.408892, 6.34 )
+STAR( "UMa 28", 2.556573, 1.110960, 6.34 )
+STAR( "UMa 41", 2.820343, 1.001223, 6.34 )
+STAR( "Aqr 53", 5.875535, -0.292212, 6.35 )
+STAR( "Cam 47", 1.929840, 1.045486, 6.35 )
+STAR( "LMi 50", 2.864842, 0.445059, 6.35 )
+STAR( "Psc 77", 0.287194, 0.085667, 6.35 )
+STAR( "Aqr 20", 5.606267, -0.059312, 6.36 )
+STAR( "Cnc Upsilon2", 2.238392, 0.420358, 6.36 )
+STAR( "Leo 7", 2.512758, 0.250973, 6.36 )
+STAR( "Per 5", 0.573704, 1.006110, 6.36 )
+STAR( "Pup 8", 2.058100, -0.223742, 6.36 )
+STAR( "Tau 62", 1.151903, 0.424134, 6.36 )
+STAR( "Aqr 29", 5.770248, -0.296081, 6.37 )
+STAR( "Aqr 56", 5.891752, -0.254571, 6.37 )
+STAR( "CVn 9", 3.310766, 0.713394, 6.37 )
+STAR( "Cae Zeta", 1.255881, -0.523953, 6.37 )
+STAR( "Leo 80", 2.992512, 0.067370, 6.37 )
+STAR( "Aqr 58", 5.897853, -0.190338, 6.38 )
+STAR( "Aur 43", 1.650565, 0.809144, 6.38 )
+STAR( "Cnc 54", 2.317034, 0.267918, 6.38 )
+STAR( "Cnc 70", 2.374368, 0.486918, 6.38 )
+STAR( "Psc 13", 6.160838, -0.018951, 6.38 )
+STAR( "UMi Lambda", 4.524533, 1.554002, 6.38 )
+STAR( "Cet 9", 0.099760, -0.213095, 6.39 )
+STAR( "Cnc 39", 2.269393, 0.349202, 6.39 )
+STAR( "Com 3", 3.187524, 0.293375, 6.39 )
+STAR( "For Chi1", 0.898539, -0.626937, 6.39 )
+STAR( "Gem 6", 1.624545, 0.399826, 6.39 )
+STAR( "UMi 20", 4.243492, 1.312672, 6.39 )
+STAR( "Cet 32", 0.306305, -0.155441, 6.4 )
+STAR( "Gem 19", 1.708779, 0.277566, 6.4 )
+STAR( "Gem 40", 1.830261, 0.452288, 6.4 )
+STAR( "Hya 34", 2.521383, -0.164488, 6.4 )
+STAR( "Vir 17", 3.239913, 0.092599, 6.4 )
+STAR( "Aql 24", 5.056430, 0.005920, 6.41 )
+STAR( "Aqr 67", 5.948249, -0.121523, 6.41 )
+STAR( "Dra 20", 4.434969, 1.135148, 6.41 )
+STAR( "Mon 24", 1.899449, -0.002817, 6.41 )
+STAR( "Vir 35", 3.350407, 0.062357, 6.41 )
+STAR( "Vul 26", 5.393671, 0.451735, 6.41 )
+STAR( "Cru Gamma", 3.278070, -0.996253, 6.42 )
+STAR( "Gem 25", 1.751220, 0.492120, 6.42 )
+STAR( "Peg 39", 5.901795, 0.353080, 6.42 )
+STAR( "Pic Iota", 1.269458, -0.933048, 6.42 )
+STAR( "PsA Zeta", 5.894391, -0.455070, 6.43 )
+STAR( "Tau 22", 0.986322, 0.428095, 6.43 )
+STAR( "UMa 68", 3.192854, 0.995788, 6.43 )
+STAR( "Leo 34", 2.668768, 0.233089, 6.44 )
+STAR( "Her 34", 4.320126, 0.854528, 6.45 )
+STAR( "Leo 19", 2.563154, 0.201906, 6.45 )
+STAR( "Lib 23", 3.985801, -0.441728, 6.45 )
+STAR( "Lyn 7", 1.721535, 0.966093, 6.45 )
+STAR( "Mon 14", 1.722524, 0.132165, 6.45 )
+STAR( "Sex 13", 2.636058, 0.055870, 6.45 )
+STAR( "UMi 3", 3.695473, 1.301904, 6.45 )
+STAR( "Ari 36", 0.716974, 0.310038, 6.46 )
+STAR( "Aur 22", 1.411019, 0.505040, 6.46 )
+STAR( "Cnc 34", 2.236923, 0.175687, 6.46 )
+STAR( "Gem 32", 1.771087, 0.221545, 6.46 )
+STAR( "LMi 22", 2.683902, 0.549221, 6.46 )
+STAR( "Leo 23", 2.578869, 0.228047, 6.46 )
+STAR( "Leo 64", 2.913224, 0.407074, 6.46 )
+STAR( "Peg 28", 5.805416, 0.366136, 6.46 )
+STAR( "Tau 70", 1.158993, 0.278220, 6.46 )
+STAR( "PsA 13", 5.778778, -0.522144, 6.47 )
+STAR( "Vir 96", 3.704505, -0.180370, 6.47 )
+STAR( "Aur Psi8", 1.806198, 0.672039, 6.48 )
+STAR( "Cam 18", 1.451081, 0.998697, 6.48 )
+STAR( "Cas 16", 0.150164, 1.165012, 6.48 )
+STAR( "Sge Theta", 5.279374, 0.365040, 6.48 )
+STAR( "Aql 57", 5.212579, -0.143767, 6.49 )
+STAR( "Aur 18", 1.393616, 0.593160, 6.49 )
+STAR( "Cam 49", 2.035301, 1.096600, 6.49 )
+STAR( "Cet 43", 0.360323, -0.007849, 6.49 )
+STAR( "LMi 24", 2.689851, 0.500604, 6.49 )
+STAR( "Peg 61", 6.090203, 0.493017, 6.49 )
+STAR( "Ari 30", 0.685078, 0.430180, 6.5 )
+STAR( "Boo Mu2", 4.033958, 0.651842, 6.5 )
+STAR( "Cam 14", 1.367996, 1.094171, 6.5 )
+STAR( "For Chi3", 0.908408, -0.625759, 6.5 )
+STAR( "Leo 83", 2.996534, 0.052588, 6.5 )
+STAR( "PsA 5", 5.624600, -0.545217, 6.5 )
+STAR( "Cnc Pi1", 2.409834, 0.261732, 6.51 )
+STAR( "For Eta1", 0.731126, -0.620479, 6.51 )
+STAR( "Ser 14", 4.086521, -0.009803, 6.51 )
+STAR( "Sgr 25", 4.863127, -0.422762, 6.51 )
+STAR( "Aur 42", 1.647496, 0.810255, 6.52 )
+STAR( "Her 49", 4.416039, 0.261349, 6.52 )
+STAR( "Cnc 37", 2.260580, 0.167110, 6.53 )
+STAR( "Dra 17", 4.346895, 0.923701, 6.53 )
+STAR( "Lyn 19", 1.932290, 0.964896, 6.53 )
+STAR( "Men Lambda", 1.517571, -1.268893, 6.53 )
+STAR( "Cam 29", 1.529636, 0.993422, 6.54 )
+STAR( "Hya 29", 2.475066, -0.160982, 6.54 )
+STAR( "Psc 61", 0.209061, 0.365215, 6.54 )
+STAR( "UMa 65", 3.120191, 0.811176, 6.54 )
+STAR( "Oct Mu2", 5.418062, -1.315115, 6.55 )
+STAR( "Sgr 65", 5.259724, -0.221051, 6.55 )
+STAR( "Com 24", 3.294767, 0.320743, 6.56 )
+STAR( "Com 28", 3.352072, 0.236545, 6.56 )
+STAR( "Aqr 53", 5.875520, -0.292192, 6.57 )
+STAR( "Cnc Iota", 2.298017, 0.502049, 6.57 )
+STAR( "Dra 65", 5.246191, 1.128084, 6.57 )
+STAR( "Oph 52", 4.604651, -0.384738, 6.57 )
+STAR( "Aur 6", 1.310684, 0.692110, 6.58 )
+STAR( "Cnc 35", 2.248522, 0.341910, 6.58 )
+STAR( "Vir 48", 3.420438, -0.063937, 6.59 )
+STAR( "Cha Mu2", 2.636000, -1.423592, 6.6 )
+STAR( "Lib 17", 3.919239, -0.194691, 6.6 )
+STAR( "Sex 40", 2.833055, -0.070235, 6.61 )
+STAR( "Sgr 30", 4.934228, -0.386804, 6.61 )
+STAR( "Gru Pi1", 5.858772, -0.801940, 6.62 )
+STAR( "Mus Iota2", 3.522533, -1.303620, 6.63 )
+STAR( "CrB Sigma", 4.252844, 0.590939, 6.66 )
+STAR( "Sex 23", 2.709769, 0.039963, 6.66 )
+STAR( "Hya 17", 2.336530, -0.139122, 6.67 )
+STAR( "Her 88", 4.668996, 0.844638, 6.68 )
+STAR( "Boo Kappa1", 3.723929, 0.903867, 6.69 )
+STAR( "Her 61", 4.465876, 0.618094, 6.69 )
+STAR( "Eri 55", 1.237373, -0.153521, 6.7 )
+STAR( "Ori Theta1", 1.462971, -0.094034, 6.7 )
+STAR( "Sex 12", 2.616765, 0.059075, 6.7 )
+STAR( "Sco 25", 4.393234, -0.445558, 6.71 )
+STAR( "Ori Theta1", 1.462870, -0.094025, 6.73 )
+STAR( "Cap Omicron", 5.366342, -0.324399, 6.74 )
+STAR( "Mon 6", 1.647533, -0.187191, 6.75 )
+STAR( "Ari 52", 0.809156, 0.440788, 6.8 )
+STAR( "Oph Omicron", 4.529166, -0.423839, 6.8 )
+STAR( "Aur 41", 1.621447, 0.850203, 6.82 )
+STAR( "Eri 55", 1.237337, -0.153477, 6.82 )
+STAR( "Ori Delta", 1.448660, -0.004964, 6.85 )
+STAR( "Pup 2", 2.031032, -0.256321, 6.89 )
+STAR( "Hya 17", 2.336523, -0.139108, 6.91 )
+STAR( "Her 36", 4.365876, 0.073430, 6.93 )
+STAR( "Ant Zeta1", 2.490396, -0.556610, 7 )
+STAR( "Ari 52", 0.809156, 0.440788, 7 )
+STAR( "Psc 65", 0.217643, 0.483645, 7 )
+STAR( "Cnc 24", 2.210736, 0.428202, 7.02 )
+STAR( "UMa 65", 3.120591, 0.811050, 7.03 )
+STAR( "Cap 31", 5.577469, -0.304773, 7.05 )
+STAR( "Ari 30", 0.684874, 0.430195, 7.09 )
+STAR( "Psc 65", 0.217672, 0.483636, 7.1 )
+STAR( "Psc 77", 0.287354, 0.085686, 7.25 )
+STAR( "Aqr 12", 5.515575, -0.101636, 7.31 )
+STAR( "Cnc 24", 2.210758, 0.428221, 7.81 )
+STAR( "Ori Theta1", 1.462884, -0.093991, 7.96 )